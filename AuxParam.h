@@ -38,6 +38,7 @@
 #include <random>
 #include <fstream>
 #include <iostream>
+#include <limits>
 
 namespace AuxPort
 {
@@ -225,42 +226,108 @@ namespace AuxPort
             }
         }
         
+/***********************************************************************************/
+/*
+	[Function] Call once every parameter an earlier release saved has been added. Sessions are
+	stored by position, all ints then all floats then all bools, so anything added later is
+	written in a tagged section after those three and older sessions still line up
+*/
+/***********************************************************************************/
+        void beginAppendedParameters() {
+            appendedInts = intParameters.size();
+            appendedFloats = floatParameters.size();
+            appendedBools = boolParameters.size();
+        }
+        
+        const std::vector<juce::AudioParameterInt*>& getIntParameters() const { return intParameters; }
+        const std::vector<juce::AudioParameterFloat*>& getFloatParameters() const { return floatParameters; }
+        const std::vector<juce::AudioParameterBool*>& getBoolParameters() const { return boolParameters; }
+        
         void writeParams(juce::MemoryBlock& destData) {
             auto outStream = juce::MemoryOutputStream(destData, true);
-            for (uint32_t i = 0; i < intParameters.size(); i++)
+            const size_t ints = std::min(appendedInts, intParameters.size());
+            const size_t floats = std::min(appendedFloats, floatParameters.size());
+            const size_t bools = std::min(appendedBools, boolParameters.size());
+            for (uint32_t i = 0; i < ints; i++)
             {
                 auto* p = intParameters[i];
                 outStream.writeInt(*p);
             }
-            for (uint32_t i = 0; i < floatParameters.size(); i++)
+            for (uint32_t i = 0; i < floats; i++)
             {
                 auto* p = floatParameters[i];
                 outStream.writeFloat(*p);
             }
-            for (uint32_t i = 0; i < boolParameters.size(); i++)
+            for (uint32_t i = 0; i < bools; i++)
             {
                 auto* p = boolParameters[i];
                 outStream.writeBool(*p);
             }
+            if (ints == intParameters.size() && floats == floatParameters.size() && bools == boolParameters.size())
+                return;
+            
+            /// The appended section: its tag, how many of each type follow, then the values
+            outStream.writeInt(APPENDED_SECTION_TAG);
+            outStream.writeInt(static_cast<int>(intParameters.size() - ints));
+            outStream.writeInt(static_cast<int>(floatParameters.size() - floats));
+            outStream.writeInt(static_cast<int>(boolParameters.size() - bools));
+            for (size_t i = ints; i < intParameters.size(); i++)
+                outStream.writeInt(*intParameters[i]);
+            for (size_t i = floats; i < floatParameters.size(); i++)
+                outStream.writeFloat(*floatParameters[i]);
+            for (size_t i = bools; i < boolParameters.size(); i++)
+                outStream.writeBool(*boolParameters[i]);
         }
         
         void readParams(const void* data, int sizeInBytes) {
             auto inStream = juce::MemoryInputStream(data, static_cast<size_t>(sizeInBytes), false);
-            for (uint32_t i = 0; i < intParameters.size(); i++)
+            const size_t ints = std::min(appendedInts, intParameters.size());
+            const size_t floats = std::min(appendedFloats, floatParameters.size());
+            const size_t bools = std::min(appendedBools, boolParameters.size());
+            for (uint32_t i = 0; i < ints; i++)
             {
                 auto* p = intParameters[i];
                 *p = inStream.readInt();
             }
-            for (uint32_t i = 0; i < floatParameters.size(); i++)
+            for (uint32_t i = 0; i < floats; i++)
             {
                 auto* p = floatParameters[i];
                 *p = inStream.readFloat();
             }
-            for (uint32_t i = 0; i < boolParameters.size(); i++)
+            for (uint32_t i = 0; i < bools; i++)
             {
                 auto* p = boolParameters[i];
                 *p = inStream.readBool();
             }
+            
+            /// Parameters the data has no value for get their defaults. A later version's extra appended values are read
+            /// and dropped, and counts that run past the end of the data leave the section unread
+            for (size_t i = ints; i < intParameters.size(); i++) *intParameters[i] = intInit[i];
+            for (size_t i = floats; i < floatParameters.size(); i++) *floatParameters[i] = floatInit[i];
+            for (size_t i = bools; i < boolParameters.size(); i++) *boolParameters[i] = boolInit[i];
+            if (inStream.getNumBytesRemaining() < 16 || inStream.readInt() != APPENDED_SECTION_TAG)
+                return;
+            const int savedInts = inStream.readInt();
+            const int savedFloats = inStream.readInt();
+            const int savedBools = inStream.readInt();
+            if (savedInts < 0 || savedFloats < 0 || savedBools < 0
+                || (static_cast<juce::int64>(savedInts) + savedFloats) * 4 + savedBools > inStream.getNumBytesRemaining())
+                return;
+            for (int i = 0; i < savedInts; i++)
+            {
+                const int value = inStream.readInt();
+                if (ints + static_cast<size_t>(i) < intParameters.size()) *intParameters[ints + static_cast<size_t>(i)] = value;
+            }
+            for (int i = 0; i < savedFloats; i++)
+            {
+                const float value = inStream.readFloat();
+                if (floats + static_cast<size_t>(i) < floatParameters.size()) *floatParameters[floats + static_cast<size_t>(i)] = value;
+            }
+            for (int i = 0; i < savedBools; i++)
+            {
+                const bool value = inStream.readBool();
+                if (bools + static_cast<size_t>(i) < boolParameters.size()) *boolParameters[bools + static_cast<size_t>(i)] = value;
+            }
         }
         
         void init() {
@@ -401,6 +468,12 @@ namespace AuxPort
         
         std::mutex idk;
         
+        static constexpr int APPENDED_SECTION_TAG = 0x41505044; /// data saved before the section existed ends where it would start
+        /// How many of each type the positional sections hold, all of them until beginAppendedParameters() is called
+        size_t appendedInts = std::numeric_limits<size_t>::max();
+        size_t appendedFloats = std::numeric_limits<size_t>::max();
+        size_t appendedBools = std::numeric_limits<size_t>::max();
+        
 		juce::AudioProcessor* audioProcessor;
 		std::vector<juce::AudioParameterBool*> boolParameters;
 		std::vector<juce::AudioParameterFloat*> floatParameters;
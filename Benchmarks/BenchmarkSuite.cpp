@@ -0,0 +1,507 @@
+/*
+  ==============================================================================
+
+    BenchmarkSuite.cpp
+    Author:  Colin Raab
+
+    Regression benchmark for the DSP, written as JSON so runs from different
+    releases can be diffed or plotted.
+
+    processBlock: held chords from synthetic MIDI, swept over block size
+    (16 - 4096), polyphony (1 - VoiceManager::MAX_VOICES), every
+    Distortion_Type on every source and the main bus, FM on/off and the
+    sampler on/off. Timing starts once the attack is over.
+
+    polyphonyScaling: one patch at a 512 block with the processor's
+    polyphony set to each voice count from 1 to MAX_VOICES, the cost per
+    voice and a least squares line through ns/sample against voices. The
+    per-voice cost should stay flat and r2 close to 1.
+
+    controlRate: one enveloped, distorted, filtered note rendered at host
+    blocks of 1 - 2048 samples. Cost per sample, and the largest sample
+    difference from the 16 sample render, which stays near zero because
+    envelopes and modulation move on the CONTROL_BLOCK grid rather than per
+    host block. Configure with -DCAPSTONE_CONTROL_BLOCK=<n> and compare runs
+    for the cost / resolution trade-off.
+
+    kernels: Distortion::processBuffer (the waveshaper for arbitrary) and
+    the per sample Distortion::processSample it replaced, Auxshape::process,
+    WavetableOscillator::renderBlock, Unison::render for a 7 copy stack,
+    NoiseGenerator::render for every noise type, Voice::processFilter for
+    every filter type and SamplerVoice::renderVoice, over the same block
+    sizes. The oscillator and sampler run once per
+    interpolation tier, the variant names the tier.
+
+    Every result has nsPerSample (per stereo frame, the whole block for
+    processBlock) and realtimeFactor (audio seconds / wall seconds).
+
+      BenchmarkSuite [--out=results.json] [--seconds=0.5] [--rate=48000]
+                     [--threads=1] [--quick]
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "../Source/PluginProcessor.h"
+#include "../Synth/WavetableVectors.h"
+
+namespace
+{
+
+struct Options {
+    double sampleRate = 48000.0;
+    double seconds = 0.5; /// audio timed per result
+    int threads = 1;
+    bool quick = false;
+    juce::File out;
+};
+
+struct Timing {
+    double nsPerSample = 0.0;
+    double realtimeFactor = 0.0;
+};
+
+const Colin::Distortion_Type distortionTypes[] = {
+    Colin::Distortion_Type::none, Colin::Distortion_Type::arbitrary, Colin::Distortion_Type::exponential,
+    Colin::Distortion_Type::softClip, Colin::Distortion_Type::fuzz, Colin::Distortion_Type::bitcrush
+};
+
+const char* distortionName(Colin::Distortion_Type type) {
+    switch(type) {
+        case Colin::Distortion_Type::none: return "none";
+        case Colin::Distortion_Type::arbitrary: return "arbitrary";
+        case Colin::Distortion_Type::exponential: return "exponential";
+        case Colin::Distortion_Type::softClip: return "softClip";
+        case Colin::Distortion_Type::fuzz: return "fuzz";
+        case Colin::Distortion_Type::bitcrush: return "bitcrush";
+        default: return "unknown";
+    }
+}
+
+const char* noiseName(Colin::Noise_Type type) {
+    const char* names[] = { "white", "binary", "lp", "hp", "pink", "brown", "velvet" };
+    return names[static_cast<int>(type) - 1];
+}
+
+const char* filterName(int type) {
+    const char* names[] = { "tptLowpass", "tptHighpass", "tptBandpass", "ladderLPF12", "ladderLPF24", "ladderHPF12", "ladderHPF24" };
+    return names[type - 1];
+}
+
+juce::Array<int> getBlockSizes(const Options& o) {
+    if(o.quick) return { 64, 512 };
+    return { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+}
+
+juce::Array<int> getPolyphonies(const Options& o) {
+    if(o.quick) return { 1, Colin::VoiceManager::MAX_VOICES };
+    juce::Array<int> p;
+    for(int n=1; n<=Colin::VoiceManager::MAX_VOICES; n*=2) p.add(n);
+    return p;
+}
+
+/// Calls fn(blockIndex) enough times to cover o.seconds of audio and times it
+template <typename Fn>
+Timing timeBlocks(const Options& o, int blockSize, Fn&& fn) {
+    const int numBlocks = juce::jmax(1, static_cast<int>(std::ceil(o.seconds * o.sampleRate / blockSize)));
+    const auto start = juce::Time::getHighResolutionTicks();
+    for(int i=0; i<numBlocks; i++) fn(i);
+    const auto end = juce::Time::getHighResolutionTicks();
+
+    const double wall = juce::Time::highResolutionTicksToSeconds(end - start);
+    const double samples = static_cast<double>(numBlocks) * blockSize;
+    Timing t;
+    t.nsPerSample = wall * 1.0e9 / samples;
+    t.realtimeFactor = wall > 0.0 ? (samples / o.sampleRate) / wall : 0.0;
+    return t;
+}
+
+juce::var result(const Timing& t, std::initializer_list<std::pair<const char*, juce::var>> fields) {
+    auto* obj = new juce::DynamicObject();
+    for(const auto& f : fields) obj->setProperty(f.first, f.second);
+    obj->setProperty("nsPerSample", t.nsPerSample);
+    obj->setProperty("realtimeFactor", t.realtimeFactor);
+    return juce::var(obj);
+}
+
+void fillSine(juce::AudioBuffer<float>& buffer, double sampleRate, float freq, float gain) {
+    for(int ch=0; ch<buffer.getNumChannels(); ch++) {
+        auto* w = buffer.getWritePointer(ch);
+        for(int i=0; i<buffer.getNumSamples(); i++) w[i] = gain * std::sin(juce::MathConstants<float>::twoPi * freq * i / static_cast<float>(sampleRate));
+    }
+}
+
+/// Two seconds of a decaying saw for the sampler, so no file has to ship with the benchmark
+juce::AudioBuffer<float> makeSample(double sampleRate) {
+    juce::AudioBuffer<float> sample(1, static_cast<int>(2.0 * sampleRate));
+    auto* w = sample.getWritePointer(0);
+    for(int i=0; i<sample.getNumSamples(); i++) {
+        const float phase = std::fmod(220.f * i / static_cast<float>(sampleRate), 1.f);
+        w[i] = (2.f * phase - 1.f) * std::exp(-1.5f * i / static_cast<float>(sampleRate));
+    }
+    return sample;
+}
+
+void setBezier(AuxPort::Bezier& b) {
+    const juce::Point<float> mid { .5f, .8f };
+    const float slope = .5f;
+    b.setPoint(juce::Point<float>(0.f, 0.f), 0);
+    b.setPoint(mid * (1 - slope), 1);
+    b.setPoint(mid, 2);
+    b.setPoint(mid * (1 + slope), 3);
+    b.setPoint(juce::Point<float>(1.f, 1.f), 4);
+    b.calcPoints();
+    b.drawWaveshaper();
+}
+
+//==============================================================================
+
+void setSynthParameters(CapstoneAudioProcessor& p, Colin::Distortion_Type type, bool fm, bool sampler) {
+    auto& map = p.parameterMap;
+    for(auto* tab : { "osc1", "osc2", "noise", "sampler", "main" }) {
+        const juce::String t(tab);
+        *map.getIntParameter(t + "DistSel") = static_cast<int>(type);
+        *map.getFloatParameter(t + "Drive") = 60.f;
+        *map.getFloatParameter(t + "DCoeff") = 40.f;
+    }
+    *map.getFloatParameter("osc1Vol") = 80.f;
+    *map.getFloatParameter("osc2Vol") = 60.f;
+    *map.getFloatParameter("noiseVol") = 30.f;
+    *map.getFloatParameter("samplerVol") = sampler ? 60.f : 0.f;
+    *map.getBoolParameter("samplerLoop") = true;
+    *map.getFloatParameter("FMDepth1") = fm ? 50.f : 0.f;
+    *map.getFloatParameter("FMDepth2") = fm ? 50.f : 0.f;
+}
+
+Timing benchProcessBlock(CapstoneAudioProcessor& p, const Options& o, int blockSize, int polyphony) {
+    p.setPolyphony(polyphony);
+    p.setPlayConfigDetails(0, 2, o.sampleRate, blockSize);
+    p.prepareToPlay(o.sampleRate, blockSize);
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+    for(int i=0; i<polyphony; i++) midi.addEvent(juce::MidiMessage::noteOn(1, 24 + (i * 7) % 84, static_cast<juce::uint8>(100)), 0);
+    p.processBlock(buffer, midi);
+    midi.clear();
+
+    /// Past the attack and into the sustain, where a held chord spends its time
+    const int warmupBlocks = static_cast<int>(std::ceil(0.1 * o.sampleRate / blockSize));
+    for(int i=0; i<warmupBlocks; i++) p.processBlock(buffer, midi);
+
+    return timeBlocks(o, blockSize, [&](int) { p.processBlock(buffer, midi); });
+}
+
+juce::Array<juce::var> runProcessBlock(const Options& o) {
+    juce::Array<juce::var> results;
+    CapstoneAudioProcessor processor;
+    processor.setNonRealtime(true);
+    processor.setRenderThreads(o.threads);
+    processor.sampler->loadBuffer(makeSample(o.sampleRate), o.sampleRate);
+
+    for(auto type : distortionTypes) {
+        for(bool fm : { false, true }) {
+            for(bool sampler : { false, true }) {
+                setSynthParameters(processor, type, fm, sampler);
+                for(int blockSize : getBlockSizes(o)) {
+                    for(int polyphony : getPolyphonies(o)) {
+                        const auto t = benchProcessBlock(processor, o, blockSize, polyphony);
+                        results.add(result(t, { { "blockSize", blockSize }, { "polyphony", polyphony }, { "distortion", distortionName(type) },
+                                                { "fm", fm }, { "sampler", sampler } }));
+                        std::fprintf(stderr, "processBlock %-11s fm %d sampler %d block %4d voices %2d: %8.2f ns/sample %8.1fx\n",
+                                     distortionName(type), fm, sampler, blockSize, polyphony, t.nsPerSample, t.realtimeFactor);
+                    }
+                }
+            }
+        }
+    }
+    processor.releaseResources();
+    return results;
+}
+
+/// Every voice count holds as many notes as it has voices, so nothing is stolen and the cost should be linear in voices
+juce::var runPolyphonyScaling(const Options& o) {
+    const int blockSize = 512;
+    juce::Array<int> counts { 1, 2, 4, 8, 16, 24, 32, 48, Colin::VoiceManager::MAX_VOICES };
+    if(o.quick) counts = { 1, 8, Colin::VoiceManager::MAX_VOICES };
+
+    CapstoneAudioProcessor processor;
+    processor.setNonRealtime(true);
+    processor.setRenderThreads(o.threads);
+    processor.sampler->loadBuffer(makeSample(o.sampleRate), o.sampleRate);
+    setSynthParameters(processor, Colin::Distortion_Type::softClip, true, true);
+
+    juce::Array<juce::var> results;
+    std::vector<double> x, y;
+    for(int voices : counts) {
+        const auto t = benchProcessBlock(processor, o, blockSize, voices);
+        const double perVoice = t.nsPerSample / voices;
+        results.add(result(t, { { "polyphony", voices }, { "nsPerVoiceSample", perVoice } }));
+        std::fprintf(stderr, "polyphony %2d: %8.2f ns/sample %7.2f ns/voice/sample %8.1fx\n", voices, t.nsPerSample, perVoice, t.realtimeFactor);
+        x.push_back(voices);
+        y.push_back(t.nsPerSample);
+    }
+    processor.releaseResources();
+
+    /// Least squares fit of ns/sample = intercept + slope * voices
+    const double n = static_cast<double>(x.size());
+    double sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0, syy = 0.0;
+    for(size_t i=0; i<x.size(); i++) {
+        sx += x[i]; sy += y[i]; sxx += x[i] * x[i]; sxy += x[i] * y[i]; syy += y[i] * y[i];
+    }
+    const double denom = n * sxx - sx * sx;
+    const double slope = denom != 0.0 ? (n * sxy - sx * sy) / denom : 0.0;
+    const double intercept = (sy - slope * sx) / n;
+    const double r = std::sqrt(denom * (n * syy - sy * sy));
+    const double r2 = r != 0.0 ? std::pow((n * sxy - sx * sy) / r, 2.0) : 0.0;
+    std::fprintf(stderr, "polyphony fit: %.2f ns/sample + %.2f ns/voice/sample, r2 %.4f\n", intercept, slope, r2);
+
+    auto* fit = new juce::DynamicObject();
+    fit->setProperty("nsPerVoiceSample", slope);
+    fit->setProperty("nsPerSampleFixed", intercept);
+    fit->setProperty("r2", r2);
+    auto* scaling = new juce::DynamicObject();
+    scaling->setProperty("blockSize", blockSize);
+    scaling->setProperty("results", results);
+    scaling->setProperty("fit", juce::var(fit));
+    return juce::var(scaling);
+}
+
+/// Note-on at 0 and note-off at noteOffSample, fed to processBlock in blocks of blockSize
+juce::AudioBuffer<float> renderNote(CapstoneAudioProcessor& p, const Options& o, int blockSize, int numSamples, int noteOffSample, double& seconds) {
+    p.setPlayConfigDetails(0, 2, o.sampleRate, blockSize);
+    p.prepareToPlay(o.sampleRate, blockSize);
+    juce::AudioBuffer<float> out(2, numSamples);
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+
+    const auto start = juce::Time::getHighResolutionTicks();
+    for(int pos=0; pos<numSamples; pos+=blockSize) {
+        const int n = juce::jmin(blockSize, numSamples - pos);
+        midi.clear();
+        if(pos == 0) midi.addEvent(juce::MidiMessage::noteOn(1, 48, static_cast<juce::uint8>(100)), 0);
+        if(noteOffSample >= pos && noteOffSample < pos + n) midi.addEvent(juce::MidiMessage::noteOff(1, 48), noteOffSample - pos);
+        juce::AudioBuffer<float> view(buffer.getArrayOfWritePointers(), 2, 0, n);
+        p.processBlock(view, midi);
+        for(int ch=0; ch<2; ch++) out.copyFrom(ch, pos, view, ch, 0, n);
+    }
+    seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+    return out;
+}
+
+juce::var runControlRate(const Options& o) {
+    CapstoneAudioProcessor processor;
+    processor.setNonRealtime(true);
+    setSynthParameters(processor, Colin::Distortion_Type::softClip, false, false);
+    auto& map = processor.parameterMap;
+    processor.setNoiseSeed(1); /// seeded noise comes out the same at any block size, so it stays in
+    for(auto* tab : { "osc1", "osc2" }) {
+        const juce::String t(tab);
+        *map.getBoolParameter(t + "envToVol") = true;
+        *map.getBoolParameter(t + "envToDist") = true;
+        *map.getBoolParameter(t + "envToFilt") = true;
+        *map.getIntParameter(t + "Filter") = 5;
+        *map.getFloatParameter(t + "Cutoff") = 1500.f;
+        *map.getFloatParameter(t + "Depth") = 80.f;
+        *map.getFloatParameter(t + "Atk") = 2.f;
+        *map.getFloatParameter(t + "Dec") = 20.f;
+    }
+
+    const int numSamples = juce::jmax(1, static_cast<int>(o.seconds * o.sampleRate));
+    const int noteOffSample = numSamples / 2 + 17; /// off the control grid on purpose
+    /// 1 and 17 split the control grid into 1 sample segments, which must move the envelope as far as any other split
+    const juce::Array<int> blockSizes = o.quick ? juce::Array<int> { 16, 17, 2048 } : juce::Array<int> { 16, 1, 17, 64, 256, 512, 1024, 2048 };
+
+    juce::Array<juce::var> results;
+    juce::AudioBuffer<float> reference;
+    for(int blockSize : blockSizes) {
+        double seconds = 0.0;
+        const auto out = renderNote(processor, o, blockSize, numSamples, noteOffSample, seconds);
+        if(reference.getNumSamples() == 0) reference.makeCopyOf(out);
+        float deviation = 0.f;
+        for(int ch=0; ch<2; ch++) {
+            for(int i=0; i<numSamples; i++) deviation = juce::jmax(deviation, std::abs(out.getSample(ch, i) - reference.getSample(ch, i)));
+        }
+        Timing t;
+        t.nsPerSample = seconds * 1.0e9 / numSamples;
+        t.realtimeFactor = seconds > 0.0 ? (numSamples / o.sampleRate) / seconds : 0.0;
+        results.add(result(t, { { "blockSize", blockSize }, { "maxDeviation", deviation } }));
+        std::fprintf(stderr, "controlRate block %4d: %8.2f ns/sample %8.1fx, max deviation from block %d %.2e\n",
+                     blockSize, t.nsPerSample, t.realtimeFactor, blockSizes[0], deviation);
+    }
+    processor.releaseResources();
+
+    auto* section = new juce::DynamicObject();
+    section->setProperty("controlBlock", Colin::CONTROL_BLOCK);
+    section->setProperty("updateIntervalMs", 1000.0 * Colin::CONTROL_BLOCK / o.sampleRate);
+    section->setProperty("results", results);
+    return juce::var(section);
+}
+
+//==============================================================================
+
+juce::Array<juce::var> runKernels(const Options& o) {
+    juce::Array<juce::var> results;
+    const auto report = [&](const char* kernel, const juce::String& variant, int blockSize, const Timing& t) {
+        results.add(result(t, { { "kernel", kernel }, { "variant", variant }, { "blockSize", blockSize } }));
+        std::fprintf(stderr, "%-34s %-12s block %4d: %8.2f ns/sample %8.1fx\n", kernel, variant.toRawUTF8(), blockSize, t.nsPerSample, t.realtimeFactor);
+    };
+
+    AuxPort::Bezier bezier(4096, AuxPort::Bezier::FourthOrder);
+    setBezier(bezier);
+    const auto sample = makeSample(o.sampleRate);
+
+    for(int blockSize : getBlockSizes(o)) {
+        juce::dsp::ProcessSpec spec { o.sampleRate, static_cast<juce::uint32>(blockSize), 2 };
+        juce::AudioBuffer<float> input(2, blockSize), buffer(2, blockSize);
+        fillSine(input, o.sampleRate, 110.f, .8f);
+
+        /// Distortion kernels overwrite their input, so each block starts from a fresh copy of the sine
+        for(auto type : distortionTypes) {
+            Colin::Distortion dist;
+            dist.setType(type);
+            dist.setInputGain(12.f);
+            dist.setOutputGain(0.f);
+            dist.setCoeff(.5f);
+            dist.setMix(1.f);
+            const bool waveshaper = type == Colin::Distortion_Type::arbitrary;
+            const auto t = timeBlocks(o, blockSize, [&](int) {
+                buffer.makeCopyOf(input, true);
+                if(waveshaper) dist.processBufferWaveshaper(buffer, &bezier);
+                else dist.processBuffer(buffer);
+            });
+            report(waveshaper ? "Distortion::processBufferWaveshaper" : "Distortion::processBuffer", distortionName(type), blockSize, t);
+            if(waveshaper) continue;
+
+            const auto perSample = timeBlocks(o, blockSize, [&](int) {
+                buffer.makeCopyOf(input, true);
+                for(int channel = 0; channel < buffer.getNumChannels(); channel++) {
+                    auto* samples = buffer.getWritePointer(channel);
+                    for(int i = 0; i < blockSize; i++) samples[i] = dist.processSample(samples[i]);
+                }
+            });
+            report("Distortion::processSample", distortionName(type), blockSize, perSample);
+        }
+
+        {
+            AuxPort::Auxshape shaper;
+            const auto t = timeBlocks(o, blockSize, [&](int) {
+                buffer.makeCopyOf(input, true);
+                shaper.process(buffer, bezier, 4.f, 1.f, 1.f);
+            });
+            report("Auxshape::process", "fourthOrder", blockSize, t);
+        }
+
+        for(int q = static_cast<int>(Colin::Interpolation::draft); q < static_cast<int>(Colin::Interpolation::end); q++) {
+            const auto quality = static_cast<Colin::Interpolation>(q);
+            const Colin::WavetableMipmap saw(sawWavetable());
+            Colin::WavetableOscillator osc(saw, o.sampleRate, 60);
+            osc.setPitch(60);
+            osc.setInterpolation(quality);
+            const auto t = timeBlocks(o, blockSize, [&](int) {
+                osc.renderBlock(buffer.getWritePointer(0), blockSize);
+            });
+            report("WavetableOscillator::renderBlock", juce::String("saw ") + Colin::Interpolator::getName(quality), blockSize, t);
+        }
+
+        {
+            const Colin::WavetableMipmap saw(sawWavetable());
+            Colin::Unison unison;
+            juce::Random random(1);
+            unison.prepare(o.sampleRate);
+            unison.setWavetable(saw);
+            unison.setVoices(7, 20.f, .5f);
+            unison.setFrequency(261.6f);
+            unison.reset(random);
+            const auto t = timeBlocks(o, blockSize, [&](int) {
+                unison.render(buffer.getWritePointer(0), buffer.getWritePointer(1), 1.f, blockSize);
+            });
+            report("Unison::render", "saw 7", blockSize, t);
+        }
+
+        for(int type = static_cast<int>(Colin::Noise_Type::gauss); type < static_cast<int>(Colin::Noise_Type::end); type++) {
+            Colin::NoiseGenerator noise;
+            noise.prepare(o.sampleRate);
+            noise.seed(1);
+            const auto t = timeBlocks(o, blockSize, [&](int) {
+                noise.render(static_cast<Colin::Noise_Type>(type), buffer.getWritePointer(0), blockSize);
+            });
+            report("NoiseGenerator::render", noiseName(static_cast<Colin::Noise_Type>(type)), blockSize, t);
+        }
+
+        for(int filter=1; filter<=7; filter++) {
+            Colin::Voice voice;
+            voice.prepareToPlay(spec);
+            voice.start(60, 100);
+            voice.setFilter(filter, 2000.f, .5f, false, 0.f);
+            const auto t = timeBlocks(o, blockSize, [&](int) {
+                buffer.makeCopyOf(input, true);
+                voice.processFilter(buffer);
+            });
+            report("Voice::processFilter", filterName(filter), blockSize, t);
+        }
+
+        for(int q = static_cast<int>(Colin::Interpolation::draft); q < static_cast<int>(Colin::Interpolation::end); q++) {
+            const auto quality = static_cast<Colin::Interpolation>(q);
+            Colin::SamplerVoice voice;
+            voice.prepareToPlay(spec);
+            voice.setInterpolation(quality);
+            voice.setLoop(true);
+            voice.setSound(&sample, o.sampleRate);
+            voice.start(60, 100);
+            voice.noteOn();
+            const auto t = timeBlocks(o, blockSize, [&](int) {
+                buffer.clear();
+                voice.renderVoice(buffer, 0, blockSize);
+            });
+            report("SamplerVoice::renderVoice", juce::String("loop ") + Colin::Interpolator::getName(quality), blockSize, t);
+        }
+    }
+    return results;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    juce::ArgumentList args(argc, argv);
+    Options o;
+    if(args.containsOption("--rate")) o.sampleRate = args.getValueForOption("--rate").getDoubleValue();
+    if(args.containsOption("--seconds")) o.seconds = args.getValueForOption("--seconds").getDoubleValue();
+    if(args.containsOption("--threads")) o.threads = args.getValueForOption("--threads").getIntValue();
+    if(args.containsOption("--out")) o.out = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--out"));
+    o.quick = args.containsOption("--quick");
+    if(o.sampleRate <= 0.0 || o.seconds <= 0.0 || o.threads <= 0) {
+        std::fprintf(stderr, "usage: BenchmarkSuite [--out=results.json] [--seconds=0.5] [--rate=48000] [--threads=1] [--quick]\n");
+        return 1;
+    }
+
+    /// The processor owns an oscilloscope component, which wants a message manager to exist
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("suite", "Capstone DSP");
+    root->setProperty("version", ProjectInfo::versionString);
+    root->setProperty("timestamp", juce::Time::getCurrentTime().toISO8601(true));
+    root->setProperty("cpu", juce::SystemStats::getCpuModel());
+    root->setProperty("numCpus", juce::SystemStats::getNumCpus());
+    root->setProperty("sampleRate", o.sampleRate);
+    root->setProperty("secondsPerResult", o.seconds);
+    root->setProperty("renderThreads", o.threads);
+    root->setProperty("controlBlock", Colin::CONTROL_BLOCK);
+    root->setProperty("kernels", runKernels(o));
+    root->setProperty("processBlock", runProcessBlock(o));
+    root->setProperty("polyphonyScaling", runPolyphonyScaling(o));
+    root->setProperty("controlRate", runControlRate(o));
+
+    const auto json = juce::JSON::toString(juce::var(root));
+    if(o.out == juce::File()) {
+        std::printf("%s\n", json.toRawUTF8());
+    }
+    else if(!o.out.replaceWithText(json)) {
+        std::fprintf(stderr, "could not write %s\n", o.out.getFullPathName().toRawUTF8());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+  ==============================================================================
+
+    ParameterSnapshotBenchmark.cpp
+    Author:  Colin Raab
+
+    Measures the control overhead of processBlock: the cost of filling the
+    ParameterSnapshot, and a silent block (no notes) with and without
+    automation, so the difference is what the dirty groups cost to apply.
+    Console app, links the plugin sources with juce_audio_processors.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <chrono>
+#include <cstdio>
+#include "../Source/PluginProcessor.h"
+
+namespace
+{
+
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 64;
+constexpr int numBlocks = 20000;
+
+template <typename Fn>
+double nsPerCall(Fn&& fn) {
+    const auto start = std::chrono::steady_clock::now();
+    for(int i=0; i<numBlocks; i++) fn(i);
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / numBlocks;
+}
+
+}
+
+int main() {
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    CapstoneAudioProcessor processor;
+    processor.setPlayConfigDetails(0, 2, sampleRate, blockSize);
+    processor.prepareToPlay(sampleRate, blockSize);
+    
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+    
+    Colin::ParameterSnapshot snapshot;
+    snapshot.bind(processor.parameterMap);
+    snapshot.update();
+    const double updateNs = nsPerCall([&](int) { snapshot.update(); });
+    
+    /// Let the first block push everything, then time blocks where nothing moves
+    processor.processBlock(buffer, midi);
+    const double staticNs = nsPerCall([&](int) { processor.processBlock(buffer, midi); });
+    
+    /// One parameter in each of a source, the main tab and a waveshaper curve changes every block
+    auto* osc1Atk = processor.parameterMap.getFloatParameter("osc1Atk");
+    auto* mainCutoff = processor.parameterMap.getFloatParameter("mainCutoff");
+    auto* xParam1 = processor.parameterMap.getFloatParameter("xParam1");
+    const double automatedNs = nsPerCall([&](int i) {
+        const float t = static_cast<float>(i % 100) / 100.f;
+        *osc1Atk = 10.f + t;
+        *mainCutoff = 1000.f + 1000.f * t;
+        *xParam1 = 0.25f + 0.5f * t;
+        processor.processBlock(buffer, midi);
+    });
+    
+    std::printf("block size %d, no voices\n", blockSize);
+    std::printf("ParameterSnapshot::update  %9.1f ns\n", updateNs);
+    std::printf("processBlock, static       %9.1f ns  (%.3f ns/sample)\n", staticNs, staticNs / blockSize);
+    std::printf("processBlock, automated    %9.1f ns  (%.3f ns/sample)\n", automatedNs, automatedNs / blockSize);
+    std::printf("control overhead of changes %8.1f ns/block\n", automatedNs - staticNs);
+    
+    processor.releaseResources();
+    return 0;
+}
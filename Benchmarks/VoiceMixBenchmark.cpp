@@ -0,0 +1,128 @@
+/*
+  ==============================================================================
+
+    VoiceMixBenchmark.cpp
+    Author:  Colin Raab
+
+    Times the voice summing stage of processBlock, the old per-sample
+    getSample() loop against GlobalVoice::addTo(), at 8, 16 and 32 voices.
+    Console app, needs juce_audio_basics + juce_dsp and the Synth sources
+    (Voice, SamplerVoice, WavetableOsc, VoiceManager).
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "../Synth/VoiceManager.h"
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+#endif
+
+namespace
+{
+
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 512;
+constexpr int numChannels = 2;
+constexpr int numBlocks = 2000;
+
+/// Cycle counter where the CPU has one we can read cheaply, otherwise cycles/sample is left at 0 and only ns/sample is reported
+inline unsigned long long readCycles() {
+   #if JUCE_INTEL
+    return __rdtsc();
+   #else
+    return 0;
+   #endif
+}
+
+struct Result {
+    double nsPerSample = 0;
+    double cyclesPerSample = 0;
+};
+
+/// What the SUM stage did before, kept here as the reference
+void sumPerSample(std::vector<Colin::GlobalVoice>& voices, juce::AudioBuffer<float>& output, float mainGain) {
+    for(int channel = 0; channel < output.getNumChannels(); channel++) {
+        for(int sample = 0; sample < output.getNumSamples(); sample++) {
+            float out = 0.f;
+            for(auto& v : voices) {
+                out = out + v.getOsc1Buffer().getSample(channel, sample) * 0.5f + v.getOsc2Buffer().getSample(channel, sample) * 0.4f
+                          + v.getNoiseBuffer().getSample(channel, sample) * 0.3f + v.getSamplerBuffer().getSample(channel, sample) * 0.2f;
+            }
+            output.getWritePointer(channel)[sample] = out * mainGain;
+        }
+    }
+}
+
+void sumBlock(std::vector<Colin::GlobalVoice>& voices, juce::AudioBuffer<float>& output, float mainGain) {
+    output.clear();
+    for(auto& v : voices) {
+        v.addTo(output, mainGain);
+    }
+}
+
+template <typename Fn>
+Result time(Fn&& fn) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto startCycles = readCycles();
+    for(int i=0; i<numBlocks; i++) fn();
+    const auto endCycles = readCycles();
+    const auto end = std::chrono::steady_clock::now();
+    const double samples = static_cast<double>(numBlocks) * blockSize;
+    Result r;
+    r.nsPerSample = std::chrono::duration<double, std::nano>(end - start).count() / samples;
+    r.cyclesPerSample = static_cast<double>(endCycles - startCycles) / samples;
+    return r;
+}
+
+}
+
+int main() {
+    juce::Random random(1234);
+    const float mainGain = 0.8f;
+    
+    juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32>(blockSize), static_cast<juce::uint32>(numChannels) };
+    
+    std::printf("voices  per-sample ns  per-sample cyc  block ns  block cyc  speedup  max diff\n");
+    for(int numVoices : { 8, 16, 32 }) {
+        std::vector<Colin::GlobalVoice> voices(static_cast<size_t>(numVoices));
+        for(auto& v : voices) {
+            v.prepareToPlay(spec);
+            v.setBlockSize(numChannels, blockSize);
+            v.setVolume(0.5f, 0.4f, 0.3f, 0.2f);
+            for(auto* b : { &v.getOsc1Buffer(), &v.getOsc2Buffer(), &v.getNoiseBuffer(), &v.getSamplerBuffer() }) {
+                for(int channel = 0; channel < b->getNumChannels(); channel++) {
+                    for(int sample = 0; sample < blockSize; sample++) {
+                        b->setSample(channel, sample, random.nextFloat() * 2.f - 1.f);
+                    }
+                }
+            }
+        }
+        
+        juce::AudioBuffer<float> reference(numChannels, blockSize);
+        juce::AudioBuffer<float> output(numChannels, blockSize);
+        
+        const auto perSample = time([&] { sumPerSample(voices, reference, mainGain); });
+        const auto block = time([&] { sumBlock(voices, output, mainGain); });
+        
+        float maxDiff = 0.f;
+        for(int channel = 0; channel < numChannels; channel++) {
+            for(int sample = 0; sample < blockSize; sample++) {
+                maxDiff = juce::jmax(maxDiff, std::abs(reference.getSample(channel, sample) - output.getSample(channel, sample)));
+            }
+        }
+        
+        std::printf("%6d  %13.3f  %14.2f  %8.3f  %9.2f  %6.2fx  %.2e\n", numVoices, perSample.nsPerSample, perSample.cyclesPerSample,
+                    block.nsPerSample, block.cyclesPerSample, perSample.nsPerSample / block.nsPerSample, maxDiff);
+    }
+    return 0;
+}
@@ -1,11 +1,16 @@
 #ifndef Colin_DISTORTION_H
 #define Colin_DISTORTION_H
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <iterator>
+#include <limits>
 #include "Conversions.h"
 #include <vector>
 #include "../AuxShaper/AuxBezier.h"
 #include "../AuxShaper/AuxWaveShape.h"
+#include "Synth/SimdLanes.h"
 
 /*
   ==============================================================================
@@ -26,7 +31,7 @@ enum class Distortion_Type {
 
 class Distortion {
 private:
-    Distortion_Type type;
+    Distortion_Type type = Distortion_Type::none;
     float inputGain = 0;
     float setGain = 0;
     float outputGain = 0;
@@ -35,7 +40,167 @@ private:
     float coeff = 0; // for other stuff
     AuxPort::Auxshape waveshaper;
     
+    /// What a block kernel reads, copied out once per block so nothing the loop writes can alias it
+    struct Block {
+        float inputGain, wet, dry, coeff, threshold, fuzzScale, crushStep;
+        bool fuzzFromCurve;
+    };
+    using Kernel = void (*)(const Block&, float*, int);
+    
+    /// An exp curve sampled over [0, range] finely enough that reading it back with linear interpolation stays inside
+    /// CURVE_TOLERANCE. Built once and shared by every Distortion, the coefficient only stretches the input to it, so
+    /// nothing is rebuilt when a knob moves and copying a Distortion per voice stays cheap
+    struct TransferCurve {
+        static constexpr int POINTS = 4096;
+        
+        template <typename Function>
+        TransferCurve(double range, Function function) : pointsPerUnit(static_cast<float>((POINTS - 1) / range)) {
+            for (int i = 0; i < POINTS; i++)
+                values[static_cast<size_t>(i)] = static_cast<float>(function(range * i / (POINTS - 1)));
+            values[static_cast<size_t>(POINTS)] = values[static_cast<size_t>(POINTS - 1)];
+        }
+        
+        float pointsPerUnit;
+        alignas(32) std::array<float, POINTS + 1> values {}; /// the last point once more, so the top of the range reads in bounds
+    };
+    
+    /// Both curves are built during static initialisation, before any render thread can reach them, so the audio
+    /// thread never runs the exp calls or waits on a first-use guard.
+    /// exp(-t) for exponential, out to where it is below 1e-6 and the curve can stop at its last point
+    static inline const TransferCurve decayCurve { 14.0, [](double t) { return std::exp(-t); } };
+    /// exp(x) - 1 for fuzz. Far enough that the output has clipped by the end for any mix worth hearing, see getBlock()
+    static inline const TransferCurve growthCurve { 12.0, [](double x) { return std::expm1(x); } };
+    
+    Block getBlock() const {
+        const float wet = mix * outputGain;
+        float fuzzScale = 0.f;
+        bool fuzzFromCurve = false;
+        if (type == Distortion_Type::fuzz) {
+            fuzzScale = 1.f / (std::exp(1.5f - coeff / 2) - 1.f);
+            /// Past the end of its curve fuzz holds the last point, which is only right if the output clips there
+            /// anyway. Below that much wet the block takes the exp path
+            fuzzFromCurve = wet == 0.f || wet * fuzzScale * growthCurve.values[static_cast<size_t>(TransferCurve::POINTS - 1)] >= 1.f;
+        }
+        return { inputGain, wet, 1 - mix, coeff, threshold, fuzzScale,
+                 static_cast<float>(2.0 / (std::pow(2.0, std::floor(8 - 2.5 * coeff)) - 1.0)), fuzzFromCurve };
+    }
+    
+    /// condition ? p : q out of a min and a max. GCC won't vectorise a ?: between values worked out under it unless
+    /// floating point traps are off, a min and a max it always will
+    static float select(bool condition, float p, float q) {
+        constexpr float infinity = std::numeric_limits<float>::infinity();
+        const float keepP = condition ? infinity : -infinity;
+        return std::max(std::min(p, keepP), std::min(q, -keepP));
+    }
+    
+    /// processSample()'s curves without the branches, so the loops they sit in vectorise. fuzz is only here for blocks
+    /// too quiet to read it from its curve, and only vectorises where the compiler has a vector exp to call
+    template <Distortion_Type shapeType>
+    static float shape(float x, const Block& b) {
+        if constexpr (shapeType == Distortion_Type::softClip) {
+            const float a = std::abs(x);
+            const float bent = (3 - (2 - a * 3) * (2 - a * 3)) / 3;
+            float y = select(a >= b.threshold, bent, a);
+            y = select(a > 2 * b.threshold, 1.f, y);
+            /// Negated rather than given x's sign, past |x| = 1.24 the bend goes below 0 and folds back over
+            return x < 0 ? -y : y;
+        }
+        else if constexpr (shapeType == Distortion_Type::fuzz) {
+            return std::copysign(std::exp(std::abs(x)) - 1.f, x) * b.fuzzScale;
+        }
+        else if constexpr (shapeType == Distortion_Type::bitcrush) {
+            return b.crushStep * static_cast<float>(static_cast<int>(x / b.crushStep));
+        }
+        else {
+            return x;
+        }
+    }
+    
+    /// One loop per type with the gain, mix and clamp fused in. none and arbitrary only clamp, like processSample()
+    template <Distortion_Type kernelType>
+    static void kernel(const Block& constants, float* samples, int numSamples) {
+        const Block b = constants; /// a local copy, so the compiler knows writing samples can't change it
+        for (int i = 0; i < numSamples; i++) {
+            float sample = samples[i];
+            if constexpr (kernelType != Distortion_Type::none && kernelType != Distortion_Type::arbitrary)
+                sample = b.wet * shape<kernelType>(sample * b.inputGain, b) + b.dry * sample;
+            samples[i] = std::min(std::max(sample, -1.f), 1.f);
+        }
+    }
+    
+    /// Reads the curve at positions already scaled to points, WIDTH of them at a time. Both arrays are aligned and
+    /// padded to whole vectors
+    static void lookUp(const TransferCurve& curve, const float* positions, float* out, int numSamples) {
+        using namespace Lanes;
+        const float* values = curve.values.data();
+        for (int i = 0; i < numSamples; i += WIDTH) {
+            const Floats position = loadFloats(positions + i);
+            const Ints index = truncate(position);
+            const Floats fraction = position - toFloats(index);
+            const Floats below = gather(values, index);
+            const Floats above = gather(values + 1, index);
+            storeFloats(out + i, below + fraction * (above - below));
+        }
+    }
+    
+    /// exponential and fuzz through their curves, CURVE_CHUNK samples at a time. The positions are worked out and the
+    /// shaped samples mixed in plain loops the compiler vectorises, the lookup in between uses SimdLanes for its gathers
+    template <Distortion_Type kernelType>
+    static void curveKernel(const Block& constants, float* samples, int numSamples) {
+        static_assert(kernelType == Distortion_Type::exponential || kernelType == Distortion_Type::fuzz, "exp curves only");
+        constexpr int CURVE_CHUNK = 64;
+        static_assert(CURVE_CHUNK % Lanes::WIDTH == 0, "chunks are looked up in whole vectors");
+        const Block b = constants;
+        if constexpr (kernelType == Distortion_Type::fuzz) {
+            if (!b.fuzzFromCurve) return kernel<Distortion_Type::fuzz>(b, samples, numSamples);
+        }
+        const TransferCurve& curve = kernelType == Distortion_Type::exponential ? decayCurve : growthCurve;
+        const float stretch = (kernelType == Distortion_Type::exponential ? (1 + b.coeff) * 3 : 1.f) * curve.pointsPerUnit;
+        const float lastPoint = static_cast<float>(TransferCurve::POINTS - 1);
+        alignas(32) float positions[CURVE_CHUNK];
+        alignas(32) float values[CURVE_CHUNK];
+        
+        for (int start = 0; start < numSamples; start += CURVE_CHUNK) {
+            float* chunk = samples + start;
+            const int count = std::min(CURVE_CHUNK, numSamples - start);
+            const int padded = (count + Lanes::WIDTH - 1) / Lanes::WIDTH * Lanes::WIDTH;
+            /// lastPoint first, so a NaN or infinite sample lands on the end of the curve instead of outside it
+            for (int i = 0; i < count; i++)
+                positions[i] = std::min(lastPoint, std::abs(chunk[i] * b.inputGain) * stretch);
+            for (int i = count; i < padded; i++)
+                positions[i] = 0.f;
+            lookUp(curve, positions, values, padded);
+            for (int i = 0; i < count; i++) {
+                const float x = chunk[i] * b.inputGain;
+                const float y = kernelType == Distortion_Type::exponential ? 1.f - values[i] : values[i] * b.fuzzScale;
+                const float sample = b.wet * std::copysign(y, x) + b.dry * chunk[i];
+                chunk[i] = std::min(std::max(sample, -1.f), 1.f);
+            }
+        }
+    }
+    
+    /// The type is looked up once per block rather than compared on every sample
+    static Kernel getKernel(Distortion_Type kernelType) {
+        static constexpr Kernel kernels[] = {
+            &kernel<Distortion_Type::none>, &kernel<Distortion_Type::arbitrary>, &curveKernel<Distortion_Type::exponential>,
+            &kernel<Distortion_Type::softClip>, &curveKernel<Distortion_Type::fuzz>, &kernel<Distortion_Type::bitcrush>
+        };
+        const int index = static_cast<int>(kernelType) - static_cast<int>(Distortion_Type::none);
+        return index >= 0 && index < static_cast<int>(std::size(kernels)) ? kernels[index] : kernels[0];
+    }
+    
 public:
+    /// processBuffer() against processSample(), which takes exp and pow in double where the kernels stay in float
+    static constexpr float TOLERANCE = 1.0e-6f;
+    /// The same for exponential and fuzz, which read their curves. Interpolating between points is off by at most
+    /// (range / POINTS)^2 / 8 of the curve's bend, under 2e-6 for both, and exponential's curve stops 1e-6 short of 1
+    static constexpr float CURVE_TOLERANCE = 1.0e-5f;
+    
+    static float getTolerance(Distortion_Type type) {
+        return type == Distortion_Type::exponential || type == Distortion_Type::fuzz ? CURVE_TOLERANCE : TOLERANCE;
+    }
+    
+    
     Distortion() = default;
     ~Distortion() = default;
     Distortion(Distortion_Type type, float inputGain, float mix) {
@@ -123,6 +288,7 @@ public:
         return QL*(int(sample / QL));
     }
     
+    /// The per sample reference, the editor's curve and the DistortionCheck tool use it. Buffers go through the kernels
     float processSample(float sample) {
         if(type == Distortion_Type::exponential) {
             sample = mix * outputGain * exponential(sample * inputGain) + (1-mix) * sample;
@@ -153,13 +319,10 @@ public:
     
     void processBuffer(juce::AudioBuffer<float>& buffer)
     {
-        auto* firstChannel = buffer.getWritePointer(0);
-        auto* secondChannel = buffer.getWritePointer(1);
-        for (int i = 0; i < buffer.getNumSamples(); i++)
-        {
-            firstChannel[i] = processSample(firstChannel[i]);
-            secondChannel[i] = processSample(secondChannel[i]);
-        }
+        const auto process = getKernel(type);
+        const auto block = getBlock();
+        for (int channel = 0; channel < buffer.getNumChannels(); channel++)
+            process(block, buffer.getWritePointer(channel), buffer.getNumSamples());
     }
     
     void processBufferWaveshaper(juce::AudioBuffer<float>& buffer, AuxPort::Bezier *bezier) {
@@ -168,13 +331,10 @@ public:
     
     void processBlock(juce::dsp::AudioBlock<float>& block)
     {
-        auto* firstChannel = block.getChannelPointer(0);
-        auto* secondChannel = block.getChannelPointer(1);
-        for (int i = 0; i < block.getNumSamples(); i++)
-        {
-            firstChannel[i] = processSample(firstChannel[i]);
-            secondChannel[i] = processSample(secondChannel[i]);
-        }
+        const auto process = getKernel(type);
+        const auto constants = getBlock();
+        for (size_t channel = 0; channel < block.getNumChannels(); channel++)
+            process(constants, block.getChannelPointer(channel), static_cast<int>(block.getNumSamples()));
     }
 };
 
@@ -0,0 +1,102 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.cpp
+
+  ==============================================================================
+*/
+
+#include "OfflineRenderer.h"
+
+namespace Colin
+{
+
+OfflineRenderer::OfflineRenderer(CapstoneAudioProcessor& p, double rate, int block) : processor(p), sampleRate(rate), blockSize(block) {
+    processor.setNonRealtime(true);
+    processor.setPlayConfigDetails(0, 2, sampleRate, blockSize);
+    processor.prepareToPlay(sampleRate, blockSize);
+    midiBlock.ensureSize(2048);
+}
+
+juce::String OfflineRenderer::loadPreset(const juce::File& presetFile) {
+    if(!presetFile.existsAsFile()) return "preset " + presetFile.getFullPathName() + " does not exist";
+    juce::XmlDocument xmlDocument { presetFile };
+    auto xml = xmlDocument.getDocumentElement();
+    if(xml == nullptr) return "could not parse " + presetFile.getFullPathName() + ": " + xmlDocument.getLastParseError();
+    if(!xml->hasTagName("PARAMETERS")) return presetFile.getFullPathName() + " is not a Capstone preset";
+    processor.parameterMap.loadXML(*xml);
+    return {};
+}
+
+juce::String OfflineRenderer::loadMidi(const juce::File& midiFile) {
+    juce::FileInputStream stream { midiFile };
+    if(!stream.openedOk()) return "could not open " + midiFile.getFullPathName();
+    juce::MidiFile file;
+    if(!file.readFrom(stream)) return midiFile.getFullPathName() + " is not a MIDI file";
+    file.convertTimestampTicksToSeconds();
+
+    /// Every track goes to the one synth, addSequence keeps the merged events in time order
+    juce::MidiMessageSequence merged;
+    for(int i=0; i<file.getNumTracks(); i++) merged.addSequence(*file.getTrack(i), 0.0);
+    setMidi(merged);
+    return {};
+}
+
+void OfflineRenderer::setMidi(const juce::MidiMessageSequence& sequenceInSeconds) {
+    sequence = sequenceInSeconds;
+    sequence.sort();
+}
+
+juce::AudioBuffer<float> OfflineRenderer::render(double tailSeconds) {
+    const double lengthSeconds = (sequence.getNumEvents() > 0 ? sequence.getEndTime() : 0.0) + tailSeconds;
+    const int numSamples = juce::jmax(1, static_cast<int>(std::ceil(lengthSeconds * sampleRate)));
+    juce::AudioBuffer<float> output(2, numSamples);
+    output.clear();
+
+    const auto start = juce::Time::getHighResolutionTicks();
+    int nextEvent = 0;
+    for(int pos=0; pos<numSamples; pos+=blockSize) {
+        const int n = juce::jmin(blockSize, numSamples - pos);
+
+        /// Events land at their sample offset inside the block, so timing is as exact as in a host
+        midiBlock.clear();
+        while(nextEvent < sequence.getNumEvents()) {
+            const auto& message = sequence.getEventPointer(nextEvent)->message;
+            const int samplePos = static_cast<int>(message.getTimeStamp() * sampleRate);
+            if(samplePos >= pos + n) break;
+            midiBlock.addEvent(message, juce::jmax(0, samplePos - pos));
+            nextEvent++;
+        }
+
+        /// Process straight into the output, a view of the next n samples allocates nothing
+        juce::AudioBuffer<float> block(output.getArrayOfWritePointers(), 2, pos, n);
+        processor.processBlock(block, midiBlock);
+    }
+    const auto end = juce::Time::getHighResolutionTicks();
+
+    renderSeconds = juce::Time::highResolutionTicksToSeconds(end - start);
+    renderedSamples = numSamples;
+    return output;
+}
+
+double OfflineRenderer::getRealtimeFactor() const {
+    if(renderSeconds <= 0.0) return 0.0;
+    return (renderedSamples / sampleRate) / renderSeconds;
+}
+
+juce::String OfflineRenderer::writeWav(const juce::AudioBuffer<float>& audio, double rate, const juce::File& outFile, int bitDepth) {
+    /// FileOutputStream appends, so start from an empty file
+    outFile.deleteFile();
+    auto stream = std::make_unique<juce::FileOutputStream>(outFile);
+    if(!stream->openedOk()) return "could not write " + outFile.getFullPathName();
+
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer(wav.createWriterFor(stream.get(), rate, static_cast<unsigned int>(audio.getNumChannels()), bitDepth, {}, 0));
+    if(writer == nullptr) return "the WAV writer does not support " + juce::String(bitDepth) + " bit at " + juce::String(rate) + " Hz";
+    stream.release(); /// the writer owns it now
+
+    if(!writer->writeFromAudioSampleBuffer(audio, 0, audio.getNumSamples())) return "writing " + outFile.getFullPathName() + " failed";
+    return {};
+}
+
+}
@@ -0,0 +1,46 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer drives a CapstoneAudioProcessor faster than realtime: load a preset and a MIDI file,
+    render the whole performance block by block, write it to a WAV
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+namespace Colin
+{
+
+class OfflineRenderer {
+public:
+    /// Prepares the processor for non-realtime rendering at the given rate and block size
+    OfflineRenderer(CapstoneAudioProcessor& processor, double sampleRate, int blockSize);
+
+    /// Each loader returns an empty string on success, otherwise what went wrong
+    juce::String loadPreset(const juce::File& presetFile);
+    juce::String loadMidi(const juce::File& midiFile);
+    void setMidi(const juce::MidiMessageSequence& sequenceInSeconds);
+
+    /// Renders every event plus tailSeconds after the last one into a stereo buffer
+    juce::AudioBuffer<float> render(double tailSeconds);
+    static juce::String writeWav(const juce::AudioBuffer<float>& audio, double sampleRate, const juce::File& outFile, int bitDepth = 24);
+
+    /// Wall clock time of the last render() and how many times faster than realtime it was
+    double getRenderSeconds() const { return renderSeconds; }
+    double getRealtimeFactor() const;
+
+private:
+    CapstoneAudioProcessor& processor;
+    double sampleRate;
+    int blockSize;
+    juce::MidiMessageSequence sequence;
+    juce::MidiBuffer midiBlock;
+    double renderSeconds = 0.0;
+    int renderedSamples = 0;
+};
+
+}
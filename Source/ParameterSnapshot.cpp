@@ -0,0 +1,163 @@
+/*
+  ==============================================================================
+
+    ParameterSnapshot.cpp
+
+  ==============================================================================
+*/
+
+#include "ParameterSnapshot.h"
+#include "../Synth/NoiseGenerator.h"
+
+namespace Colin
+{
+
+namespace
+{
+    template <typename Param>
+    auto read(Param* p, decltype(p->get()) fallback) { return p != nullptr ? p->get() : fallback; }
+}
+
+/// Looks every parameter up by name once, after this update() never searches the ParameterMap
+void ParameterSnapshot::bind(AuxPort::ParameterMap& parameterMap) {
+    bindSource(parameterMap, sourceParams[osc1], "osc1");
+    bindSource(parameterMap, sourceParams[osc2], "osc2");
+    bindSource(parameterMap, sourceParams[noise], "noise");
+    bindSource(parameterMap, sourceParams[sampler], "sampler");
+    
+    sourceParams[osc1].wave = parameterMap.getIntParameter("osc1Wave");
+    sourceParams[osc2].wave = parameterMap.getIntParameter("osc2Wave");
+    sourceParams[noise].wave = parameterMap.getIntParameter("noiseWave");
+    sourceParams[noise].colour = parameterMap.getIntParameter("noiseColour");
+    sourceParams[osc1].pitch = parameterMap.getFloatParameter("osc1Pitch");
+    sourceParams[osc2].pitch = parameterMap.getFloatParameter("osc2Pitch");
+    sourceParams[sampler].pitch = parameterMap.getFloatParameter("samplerPitch");
+    sourceParams[osc1].fm = parameterMap.getFloatParameter("FMDepth1");
+    sourceParams[osc2].fm = parameterMap.getFloatParameter("FMDepth2");
+    for(int i : { osc1, osc2 }) {
+        const juce::String name = i == osc1 ? "osc1" : "osc2";
+        sourceParams[i].unison = parameterMap.getIntParameter(name + "Unison");
+        sourceParams[i].detune = parameterMap.getFloatParameter(name + "Detune");
+        sourceParams[i].spread = parameterMap.getFloatParameter(name + "Spread");
+    }
+    sourceParams[sampler].repitch = parameterMap.getBoolParameter("samplerRepitch");
+    sourceParams[sampler].loop = parameterMap.getBoolParameter("samplerLoop");
+    
+    mainParams.distSel = parameterMap.getIntParameter("mainDistSel");
+    mainParams.filter = parameterMap.getIntParameter("mainFilter");
+    mainParams.drive = parameterMap.getFloatParameter("mainDrive");
+    mainParams.dCoeff = parameterMap.getFloatParameter("mainDCoeff");
+    mainParams.distSlider = parameterMap.getFloatParameter("mainDistSlider");
+    mainParams.atk = parameterMap.getFloatParameter("mainAtk");
+    mainParams.dec = parameterMap.getFloatParameter("mainDec");
+    mainParams.sus = parameterMap.getFloatParameter("mainSus");
+    mainParams.rel = parameterMap.getFloatParameter("mainRel");
+    mainParams.cutoff = parameterMap.getFloatParameter("mainCutoff");
+    mainParams.res = parameterMap.getFloatParameter("mainRes");
+    
+    mixParams = { parameterMap.getFloatParameter("osc1Vol"), parameterMap.getFloatParameter("osc2Vol"),
+                  parameterMap.getFloatParameter("noiseVol"), parameterMap.getFloatParameter("samplerVol"),
+                  parameterMap.getFloatParameter("mainVol"), parameterMap.getFloatParameter("mainWaveSlider") };
+    limiterParams = { parameterMap.getFloatParameter("cThresh"), parameterMap.getFloatParameter("cRatio"),
+                      parameterMap.getFloatParameter("cAtk"), parameterMap.getFloatParameter("cRel") };
+    
+    const char* bezierNames[] = { "1", "2", "N", "S", "M" };
+    for(int i=0; i<5; i++) {
+        bezierParams[i] = { parameterMap.getFloatParameter(juce::String("xParam") + bezierNames[i]),
+                            parameterMap.getFloatParameter(juce::String("yParam") + bezierNames[i]),
+                            parameterMap.getFloatParameter(juce::String("slopeParam") + bezierNames[i]) };
+    }
+    
+    markAllDirty();
+}
+
+void ParameterSnapshot::bindSource(AuxPort::ParameterMap& parameterMap, SourceParams& p, const juce::String& name) {
+    p.distSel = parameterMap.getIntParameter(name + "DistSel");
+    p.filter = parameterMap.getIntParameter(name + "Filter");
+    p.drive = parameterMap.getFloatParameter(name + "Drive");
+    p.dCoeff = parameterMap.getFloatParameter(name + "DCoeff");
+    p.distSlider = parameterMap.getFloatParameter(name + "DistSlider");
+    p.waveSlider = parameterMap.getFloatParameter(name + "WaveSlider");
+    p.atk = parameterMap.getFloatParameter(name + "Atk");
+    p.dec = parameterMap.getFloatParameter(name + "Dec");
+    p.sus = parameterMap.getFloatParameter(name + "Sus");
+    p.rel = parameterMap.getFloatParameter(name + "Rel");
+    p.depth = parameterMap.getFloatParameter(name + "Depth");
+    p.cutoff = parameterMap.getFloatParameter(name + "Cutoff");
+    p.res = parameterMap.getFloatParameter(name + "Res");
+    p.ktA = parameterMap.getFloatParameter(name + "ktA");
+    p.keytrack = parameterMap.getBoolParameter(name + "Keytrack");
+    p.envToVol = parameterMap.getBoolParameter(name + "envToVol");
+    p.envToDist = parameterMap.getBoolParameter(name + "envToDist");
+    p.envToFilt = parameterMap.getBoolParameter(name + "envToFilt");
+}
+
+ParameterSnapshot::Source ParameterSnapshot::readSource(const SourceParams& p) const {
+    Source s;
+    s.wave = read(p.wave, s.wave);
+    /// A noise colour overrides the type, pink, brown and velvet follow hp in Noise_Type
+    if(const int colour = read(p.colour, 0); colour > 0) s.wave = static_cast<int>(Noise_Type::hp) + colour;
+    s.unison = read(p.unison, s.unison);
+    s.distSel = read(p.distSel, s.distSel);
+    s.filter = read(p.filter, s.filter);
+    s.drive = read(p.drive, s.drive);
+    s.dCoeff = read(p.dCoeff, s.dCoeff);
+    s.distSlider = read(p.distSlider, s.distSlider);
+    s.waveSlider = read(p.waveSlider, s.waveSlider);
+    s.pitch = read(p.pitch, s.pitch);
+    s.atk = read(p.atk, s.atk);
+    s.dec = read(p.dec, s.dec);
+    s.sus = read(p.sus, s.sus);
+    s.rel = read(p.rel, s.rel);
+    s.depth = read(p.depth, s.depth);
+    s.cutoff = read(p.cutoff, s.cutoff);
+    s.res = read(p.res, s.res);
+    s.ktA = read(p.ktA, s.ktA);
+    s.fm = read(p.fm, s.fm);
+    s.detune = read(p.detune, s.detune);
+    s.spread = read(p.spread, s.spread);
+    s.keytrack = read(p.keytrack, s.keytrack);
+    s.envToVol = read(p.envToVol, s.envToVol);
+    s.envToDist = read(p.envToDist, s.envToDist);
+    s.envToFilt = read(p.envToFilt, s.envToFilt);
+    s.repitch = read(p.repitch, s.repitch);
+    s.loop = read(p.loop, s.loop);
+    return s;
+}
+
+/// Called once at the top of processBlock, afterwards the values and dirty bits are fixed for the block
+void ParameterSnapshot::update() {
+    dirty = forced;
+    forced.reset();
+    
+    for(int i=0; i<numSources; i++) {
+        if(store(sources[i], readSource(sourceParams[i]))) dirty.set(static_cast<size_t>(osc1Group + i));
+    }
+    
+    Main m;
+    m.distSel = mainParams.distSel->get();
+    m.filter = mainParams.filter->get();
+    m.drive = mainParams.drive->get();
+    m.dCoeff = mainParams.dCoeff->get();
+    m.distSlider = mainParams.distSlider->get();
+    m.atk = mainParams.atk->get();
+    m.dec = mainParams.dec->get();
+    m.sus = mainParams.sus->get();
+    m.rel = mainParams.rel->get();
+    m.cutoff = mainParams.cutoff->get();
+    m.res = mainParams.res->get();
+    if(store(main, m)) dirty.set(mainGroup);
+    
+    Mix x { mixParams[0]->get(), mixParams[1]->get(), mixParams[2]->get(), mixParams[3]->get(), mixParams[4]->get(), mixParams[5]->get() };
+    if(store(mix, x)) dirty.set(mixGroup);
+    
+    Limiter l { limiterParams[0]->get(), limiterParams[1]->get(), limiterParams[2]->get(), limiterParams[3]->get() };
+    if(store(limiter, l)) dirty.set(limiterGroup);
+    
+    for(int i=0; i<5; i++) {
+        Bezier b { bezierParams[i][0]->get(), bezierParams[i][1]->get(), bezierParams[i][2]->get() };
+        if(store(beziers[i], b)) dirty.set(static_cast<size_t>(bezier1Group + i));
+    }
+}
+
+}
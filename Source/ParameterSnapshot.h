@@ -0,0 +1,190 @@
+/*
+  ==============================================================================
+
+    ParameterSnapshot reads every plugin parameter once per block and records which groups changed,
+    so processBlock only pushes settings to the sources that actually moved
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <tuple>
+#include <JuceHeader.h>
+#include "../AuxParam.h"
+
+namespace Colin
+{
+
+class ParameterSnapshot {
+public:
+    enum Group {
+        osc1Group = 0, osc2Group, noiseGroup, samplerGroup,
+        mainGroup, mixGroup, limiterGroup,
+        bezier1Group, bezier2Group, bezierNGroup, bezierSGroup, bezierMGroup,
+        numGroups
+    };
+    
+    /// Settings of one source tab, values stay at their defaults for controls the tab doesn't have
+    struct Source {
+        int wave = 1;
+        int unison = 1;
+        int distSel = 1;
+        int filter = 1;
+        float drive = 0.f;
+        float dCoeff = 0.f;
+        float distSlider = 0.f;
+        float waveSlider = 0.f;
+        float pitch = 0.f;
+        float atk = 0.f;
+        float dec = 0.f;
+        float sus = 0.f;
+        float rel = 0.f;
+        float depth = 0.f;
+        float cutoff = 0.f;
+        float res = 0.f;
+        float ktA = 0.f;
+        float fm = 0.f;
+        float detune = 0.f;
+        float spread = 0.f;
+        bool keytrack = false;
+        bool envToVol = false;
+        bool envToDist = false;
+        bool envToFilt = false;
+        bool repitch = false;
+        bool loop = false;
+        
+        auto tie() const { return std::tie(wave, unison, distSel, filter, drive, dCoeff, distSlider, waveSlider, pitch, atk, dec, sus, rel, depth,
+                                           cutoff, res, ktA, fm, detune, spread, keytrack, envToVol, envToDist, envToFilt, repitch, loop); }
+    };
+    
+    struct Main {
+        int distSel = 1;
+        int filter = 1;
+        float drive = 0.f;
+        float dCoeff = 0.f;
+        float distSlider = 0.f;
+        float atk = 0.f;
+        float dec = 0.f;
+        float sus = 0.f;
+        float rel = 0.f;
+        float cutoff = 0.f;
+        float res = 0.f;
+        
+        auto tie() const { return std::tie(distSel, filter, drive, dCoeff, distSlider, atk, dec, sus, rel, cutoff, res); }
+    };
+    
+    struct Mix {
+        float osc1Vol = 0.f;
+        float osc2Vol = 0.f;
+        float noiseVol = 0.f;
+        float samplerVol = 0.f;
+        float mainVol = 0.f;
+        float scope = 0.f;
+        
+        auto tie() const { return std::tie(osc1Vol, osc2Vol, noiseVol, samplerVol, mainVol, scope); }
+    };
+    
+    struct Limiter {
+        float thresh = 0.f;
+        float ratio = 1.f;
+        float atk = 0.f;
+        float rel = 0.f;
+        
+        auto tie() const { return std::tie(thresh, ratio, atk, rel); }
+    };
+    
+    struct Bezier {
+        float x = 0.f;
+        float y = 0.f;
+        float slope = 0.f;
+        
+        auto tie() const { return std::tie(x, y, slope); }
+    };
+    
+    enum SourceIndex { osc1 = 0, osc2, noise, sampler, numSources };
+    
+    ParameterSnapshot() = default;
+    ~ParameterSnapshot() = default;
+    
+    void bind(AuxPort::ParameterMap& parameterMap);
+    void update();
+    void markAllDirty() { forced.set(); }
+    bool isDirty(Group g) const { return dirty[static_cast<size_t>(g)]; }
+    bool anyDirty() const { return dirty.any(); }
+    
+    std::array<Source, numSources> sources;
+    Main main;
+    Mix mix;
+    Limiter limiter;
+    std::array<Bezier, 5> beziers; /// osc 1, osc 2, noise, sampler, main, same order as the Bezier groups
+    
+private:
+    struct SourceParams {
+        juce::AudioParameterInt* wave = nullptr;
+        juce::AudioParameterInt* colour = nullptr;
+        juce::AudioParameterInt* unison = nullptr;
+        juce::AudioParameterInt* distSel = nullptr;
+        juce::AudioParameterInt* filter = nullptr;
+        juce::AudioParameterFloat* drive = nullptr;
+        juce::AudioParameterFloat* dCoeff = nullptr;
+        juce::AudioParameterFloat* distSlider = nullptr;
+        juce::AudioParameterFloat* waveSlider = nullptr;
+        juce::AudioParameterFloat* pitch = nullptr;
+        juce::AudioParameterFloat* atk = nullptr;
+        juce::AudioParameterFloat* dec = nullptr;
+        juce::AudioParameterFloat* sus = nullptr;
+        juce::AudioParameterFloat* rel = nullptr;
+        juce::AudioParameterFloat* depth = nullptr;
+        juce::AudioParameterFloat* cutoff = nullptr;
+        juce::AudioParameterFloat* res = nullptr;
+        juce::AudioParameterFloat* ktA = nullptr;
+        juce::AudioParameterFloat* fm = nullptr;
+        juce::AudioParameterFloat* detune = nullptr;
+        juce::AudioParameterFloat* spread = nullptr;
+        juce::AudioParameterBool* keytrack = nullptr;
+        juce::AudioParameterBool* envToVol = nullptr;
+        juce::AudioParameterBool* envToDist = nullptr;
+        juce::AudioParameterBool* envToFilt = nullptr;
+        juce::AudioParameterBool* repitch = nullptr;
+        juce::AudioParameterBool* loop = nullptr;
+    };
+    
+    struct MainParams {
+        juce::AudioParameterInt* distSel = nullptr;
+        juce::AudioParameterInt* filter = nullptr;
+        juce::AudioParameterFloat* drive = nullptr;
+        juce::AudioParameterFloat* dCoeff = nullptr;
+        juce::AudioParameterFloat* distSlider = nullptr;
+        juce::AudioParameterFloat* atk = nullptr;
+        juce::AudioParameterFloat* dec = nullptr;
+        juce::AudioParameterFloat* sus = nullptr;
+        juce::AudioParameterFloat* rel = nullptr;
+        juce::AudioParameterFloat* cutoff = nullptr;
+        juce::AudioParameterFloat* res = nullptr;
+    };
+    
+    /// Copies next into current if anything differs, the return value becomes the group's dirty bit
+    template <typename Values>
+    static bool store(Values& current, const Values& next) {
+        if(current.tie() == next.tie()) return false;
+        current = next;
+        return true;
+    }
+    
+    void bindSource(AuxPort::ParameterMap& parameterMap, SourceParams& p, const juce::String& name);
+    Source readSource(const SourceParams& p) const;
+    
+    std::array<SourceParams, numSources> sourceParams;
+    MainParams mainParams;
+    std::array<juce::AudioParameterFloat*, 6> mixParams {};
+    std::array<juce::AudioParameterFloat*, 4> limiterParams {};
+    std::array<std::array<juce::AudioParameterFloat*, 3>, 5> bezierParams {};
+    
+    std::bitset<numGroups> dirty;
+    std::bitset<numGroups> forced;
+};
+
+}
@@ -102,6 +102,9 @@ CapstoneAudioProcessorEditor::CapstoneAudioProcessorEditor (CapstoneAudioProcess
     presetPanel(p.getPresetManager()),
     verticalDiscreteMeterL([&]() { return audioProcessor.getRmsValue(0); }),
     verticalDiscreteMeterR([&]() { return audioProcessor.getRmsValue(1); })
+   #if CAPSTONE_PROFILING
+    , diagnosticsPage(p.profiler)
+   #endif
 {
     setSize (750, 300);
     juce::LookAndFeel::setDefaultLookAndFeel(&newLook);
@@ -208,6 +211,7 @@ CapstoneAudioProcessorEditor::CapstoneAudioProcessorEditor (CapstoneAudioProcess
     auto osc1Wave = audioProcessor.parameterMap.getIntParameter("osc1Wave");
     auto osc2Wave = audioProcessor.parameterMap.getIntParameter("osc2Wave");
     auto noiseWave = audioProcessor.parameterMap.getIntParameter("noiseWave");
+    auto noiseColour = audioProcessor.parameterMap.getIntParameter("noiseColour");
     
     osc1Vol = audioProcessor.parameterMap.getFloatParameter("osc1Vol");
     osc2Vol = audioProcessor.parameterMap.getFloatParameter("osc2Vol");
@@ -236,13 +240,20 @@ CapstoneAudioProcessorEditor::CapstoneAudioProcessorEditor (CapstoneAudioProcess
     auto yParamM = audioProcessor.parameterMap.getFloatParameter("yParamM");
     auto slopeParamM = audioProcessor.parameterMap.getFloatParameter("slopeParamM");
     
+    auto osc1Unison = audioProcessor.parameterMap.getIntParameter("osc1Unison");
+    auto osc2Unison = audioProcessor.parameterMap.getIntParameter("osc2Unison");
+    auto osc1Detune = audioProcessor.parameterMap.getFloatParameter("osc1Detune");
+    auto osc2Detune = audioProcessor.parameterMap.getFloatParameter("osc2Detune");
+    auto osc1Spread = audioProcessor.parameterMap.getFloatParameter("osc1Spread");
+    auto osc2Spread = audioProcessor.parameterMap.getFloatParameter("osc2Spread");
+    
     /// Create TabbedComponent with five pages (subcomponents) for each of the sound sources and a main page, assign parameters to them
     
-    osc1Page = new Colin::Osc1Page(audioProcessor.osc1, osc1DSel, osc1DAmt, osc1DCoeff, fm1, osc1Pitch, osc1Wave, osc1Filter, osc1Cutoff, osc1Res, osc1Keytrack, osc1ktA, osc1Atk, osc1Dec, osc1Sus, osc1Rel, osc1Depth, osc1etV, osc1etD, osc1etF, osc1WaveSlider, osc1DistSlider, audioProcessor.bezier1, xParam1, yParam1, slopeParam1);
+    osc1Page = new Colin::Osc1Page(audioProcessor.osc1, osc1DSel, osc1DAmt, osc1DCoeff, fm1, osc1Pitch, osc1Wave, osc1Filter, osc1Cutoff, osc1Res, osc1Keytrack, osc1ktA, osc1Atk, osc1Dec, osc1Sus, osc1Rel, osc1Depth, osc1etV, osc1etD, osc1etF, osc1WaveSlider, osc1DistSlider, audioProcessor.bezier1, xParam1, yParam1, slopeParam1, osc1Unison, osc1Detune, osc1Spread);
     
-    osc2Page = new Colin::Osc2Page(audioProcessor.osc2, osc2DSel, osc2DAmt, osc2DCoeff, fm2, osc2Pitch, osc2Wave, osc2Filter, osc2Cutoff, osc2Res, osc2Keytrack, osc2ktA, osc2Atk, osc2Dec, osc2Sus, osc2Rel, osc2Depth, osc2etV, osc2etD, osc2etF, osc2WaveSlider, osc2DistSlider, audioProcessor.bezier2, xParam2, yParam2, slopeParam2);
+    osc2Page = new Colin::Osc2Page(audioProcessor.osc2, osc2DSel, osc2DAmt, osc2DCoeff, fm2, osc2Pitch, osc2Wave, osc2Filter, osc2Cutoff, osc2Res, osc2Keytrack, osc2ktA, osc2Atk, osc2Dec, osc2Sus, osc2Rel, osc2Depth, osc2etV, osc2etD, osc2etF, osc2WaveSlider, osc2DistSlider, audioProcessor.bezier2, xParam2, yParam2, slopeParam2, osc2Unison, osc2Detune, osc2Spread);
     
-    noisePage = new Colin::NoisePage(audioProcessor.noise, noiseDSel, noiseDAmt, noiseDCoeff, noiseWave, noiseFilter, noiseCutoff, noiseRes, noiseKeytrack, noisektA, noiseAtk, noiseDec, noiseSus, noiseRel, noiseDepth, noiseetV, noiseetD, noiseetF, noiseWaveSlider, noiseDistSlider, audioProcessor.bezierN, xParamN, yParamN, slopeParamN);
+    noisePage = new Colin::NoisePage(audioProcessor.noise, noiseDSel, noiseDAmt, noiseDCoeff, noiseWave, noiseFilter, noiseCutoff, noiseRes, noiseKeytrack, noisektA, noiseAtk, noiseDec, noiseSus, noiseRel, noiseDepth, noiseetV, noiseetD, noiseetF, noiseWaveSlider, noiseDistSlider, audioProcessor.bezierN, xParamN, yParamN, slopeParamN, noiseColour);
     
     samplerPage = new Colin::SamplerPage(audioProcessor.sampler, samplerDSel, samplerDAmt, samplerDCoeff, samplerFilter, samplerCutoff, samplerRes, samplerKeytrack, samplerktA, samplerLoop, samplerPitch, samplerRepitch, samplerAtk, samplerDec, samplerSus, samplerRel, samplerDepth, sampleretV, sampleretD, sampleretF, samplerWaveSlider, samplerDistSlider, audioProcessor.bezierS, xParamS, yParamS, slopeParamS);
     
@@ -259,6 +270,11 @@ CapstoneAudioProcessorEditor::CapstoneAudioProcessorEditor (CapstoneAudioProcess
     mainWindow.addTab("MAIN", tabcolor, mainPage, true);
     addAndMakeVisible(mainWindow);
     
+   #if CAPSTONE_PROFILING
+    /// The diagnostics tab stays hidden until asked for
+    setWantsKeyboardFocus(true);
+   #endif
+    
     /// Setup global synth controls (outside of the TabbedComponent)
     
     addAndMakeVisible(osc1V);
@@ -429,6 +445,23 @@ void CapstoneAudioProcessorEditor::resized()
 void CapstoneAudioProcessorEditor::timerCallback() {
 }
 
+#if CAPSTONE_PROFILING
+/// Cmd/Ctrl+Shift+D shows or hides the DIAG tab
+bool CapstoneAudioProcessorEditor::keyPressed(const juce::KeyPress& key) {
+    if(key != juce::KeyPress('d', juce::ModifierKeys::commandModifier | juce::ModifierKeys::shiftModifier, 0))
+        return false;
+    const int index = mainWindow.getTabNames().indexOf("DIAG");
+    if(index >= 0) {
+        mainWindow.removeTab(index);
+    }
+    else {
+        mainWindow.addTab("DIAG", juce::Colours::black.withAlpha(0.1f), &diagnosticsPage, false);
+        mainWindow.setCurrentTabIndex(mainWindow.getNumTabs() - 1);
+    }
+    return true;
+}
+#endif
+
 void CapstoneAudioProcessorEditor::updateParamUI() {
     osc1V.setValue(*osc1Vol);
     osc2V.setValue(*osc2Vol);
@@ -13,6 +13,7 @@
 #include "PluginProcessor.h"
 #include "../TextSlider.h"
 #include "../UI/TabPages.h"
+#include "../UI/DiagnosticsPage.h"
 #include "../GainMeter.h"
 #include "../Presets/PresetPanel.h"
 
@@ -59,6 +60,9 @@ public:
     void paint (juce::Graphics&) override;
     void resized() override;
     void timerCallback() override;
+   #if CAPSTONE_PROFILING
+    bool keyPressed(const juce::KeyPress&) override;
+   #endif
     
     Colin::Osc1Page* osc1Page;
     Colin::Osc2Page* osc2Page;
@@ -100,5 +104,10 @@ private:
         
     Colin::VerticalDiscreteMeter verticalDiscreteMeterL, verticalDiscreteMeterR;
     
+   #if CAPSTONE_PROFILING
+    /// Owned here rather than by the tab so it can be added and removed without being deleted
+    Colin::DiagnosticsPage diagnosticsPage;
+   #endif
+    
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CapstoneAudioProcessorEditor)
 };
@@ -7,7 +7,9 @@
 */
 
 #include "PluginProcessor.h"
+#if ! CAPSTONE_HEADLESS
 #include "PluginEditor.h"
+#endif
 
 //==============================================================================
 CapstoneAudioProcessor::CapstoneAudioProcessor()
@@ -276,7 +278,26 @@ presetManager(&parameterMap)
     parameterMap.addParameter(yParamM);
     parameterMap.addParameter(slopeParamM);
     
+    /// Saved sessions are read back by position, anything added from here on goes after this
+    parameterMap.beginAppendedParameters();
+    osc1Unison = new juce::AudioParameterInt(juce::ParameterID{"5.61", 1}, "osc1Unison", 1, 16, 1);
+    parameterMap.addParameter(osc1Unison);
+    osc2Unison = new juce::AudioParameterInt(juce::ParameterID{"5.62", 1}, "osc2Unison", 1, 16, 1);
+    parameterMap.addParameter(osc2Unison);
+    osc1Detune = new juce::AudioParameterFloat(juce::ParameterID{"5.63", 1}, "osc1Detune", juce::NormalisableRange<float>(0.0f, 99.f), 20.f);
+    parameterMap.addParameter(osc1Detune);
+    osc2Detune = new juce::AudioParameterFloat(juce::ParameterID{"5.64", 1}, "osc2Detune", juce::NormalisableRange<float>(0.0f, 99.f), 20.f);
+    parameterMap.addParameter(osc2Detune);
+    osc1Spread = new juce::AudioParameterFloat(juce::ParameterID{"5.65", 1}, "osc1Spread", juce::NormalisableRange<float>(0.0f, 99.f), 50.f);
+    parameterMap.addParameter(osc1Spread);
+    osc2Spread = new juce::AudioParameterFloat(juce::ParameterID{"5.66", 1}, "osc2Spread", juce::NormalisableRange<float>(0.0f, 99.f), 50.f);
+    parameterMap.addParameter(osc2Spread);
+    /// Off, pink, brown or velvet. Its own parameter so automation of noiseWave keeps selecting the same four types
+    noiseColour = new juce::AudioParameterInt(juce::ParameterID{"5.67", 1}, "noiseColour", 0, 3, 0);
+    parameterMap.addParameter(noiseColour);
+    
     parameterMap.save();
+    params.bind(parameterMap);
     
     juce::AudioProcessorValueTreeState valueTreeState(*this, nullptr, ProjectInfo::projectName, Utility::ParameterHelper::createParameterLayout());
     
@@ -286,20 +307,10 @@ presetManager(&parameterMap)
     sampler = new Colin::Sampler();
     distMain = new Colin::Distortion();
     
-    osc1Buffers.resize(8);
-    osc2Buffers.resize(8);
-    noiseBuffers.resize(8);
-    samplerBuffers.resize(8);
-    
-    for(int i=0; i<8; i++) {
-        osc1Buffers[i] = new juce::AudioBuffer<float>(2, 512);
-        osc2Buffers[i] = new juce::AudioBuffer<float>(2, 512);
-        noiseBuffers[i] = new juce::AudioBuffer<float>(2, 512);
-        samplerBuffers[i] = new juce::AudioBuffer<float>(2, 512);
-    }
-    
     oscilloscope = new Colin::Oscilloscope();
     
+    renderVoiceTask = [this](int i) { renderVoice(voiceManager.getVoice(i)); };
+    
     slopeFactors.resize(5);
     
     bezier1 = new AuxPort::Bezier(4096, AuxPort::Bezier::FourthOrder);
@@ -330,13 +341,7 @@ CapstoneAudioProcessor::~CapstoneAudioProcessor()
     delete sampler;
     delete distMain;
 
-    for (int i=0; i<8; i++) {
-        delete osc1Buffers[i];
-        delete osc2Buffers[i];
-        delete noiseBuffers[i];
-        delete samplerBuffers[i];
-    }
-    globalVoices.clear();
+    renderPool.release();
 
     delete oscilloscope;
     delete bezier1;
@@ -455,15 +460,21 @@ void CapstoneAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlo
     prepareBezier(bezierS, xParamS, yParamS, slopeParamS, pointsS, 3);
     prepareBezier(bezierM, xParamM, yParamM, slopeParamM, pointsM, 4);
     
-    ADSRparams = new juce::ADSR::Parameters(0.55, 0.5, 0.8, 0.9);
+    ADSRparams = juce::ADSR::Parameters(0.55f, 0.5f, 0.8f, 0.9f);
+    
+    /// All voice storage is allocated here, processBlock only starts and frees voices that already exist
+    voiceManager.prepareToPlay(spec);
+    renderPool.prepare();
     
-    globalVoices.clear();
+    /// prepareToPlay() resets the sources and filters above, so every setting gets pushed again on the next block
+    params.markAllDirty();
 }
 
 void CapstoneAudioProcessor::releaseResources()
 {
     // When playback stops, you can use this as an opportunity to free up any
     // spare memory, etc.
+    renderPool.release();
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -500,150 +511,180 @@ void CapstoneAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
     auto numSamples = buffer.getNumSamples();
     auto numChannels = buffer.getNumChannels();
 
-    /// Prepare AudioBuffers for storing new audio data
-    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i) {
+    CAPSTONE_PROFILE_BEGIN(profiler);
+    
+    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, numSamples);
-        
-        /// Resize buffers if necessary
-        if(osc1Buffers[0]->getNumSamples() != numSamples) {
-            for(int j=0; j<8; j++) {
-                osc1Buffers[j]->setSize(numChannels, numSamples);
-                osc2Buffers[j]->setSize(numChannels, numSamples);
-                noiseBuffers[j]->setSize(numChannels, numSamples);
-            }
-            for(int j=0; j<sampler->NUM_VOICES; j++) {
-                samplerBuffers[j]->setSize(numChannels, numSamples);
-            }
-        }
-        
-        /// Clear buffers that currently contain audio data
-        for(int j=0; j<8; j++) {
-            osc1Buffers[j]->clear(i, 0, numSamples);
-            osc2Buffers[j]->clear(i, 0, numSamples);
-            noiseBuffers[j]->clear(i, 0, numSamples);
-        }
-        for(int j=0; j<sampler->NUM_VOICES; j++) {
-            samplerBuffers[j]->clear(i, 0, numSamples);
-        }
-    }
     
-    /// Update global ADSR and check for new MIDI events to create new global voices
-    enableADSR(midiMessages, buffer.getNumChannels(), buffer.getNumSamples());
-    setADSR(*mainAtk / 20.f + 0.05f, *mainDec / 20.f, *mainSus / 100.f, std::powf(*mainRel, 1.4f) / 100.f);
+    /// Read every parameter once, only the groups that changed since the last block push their settings below
+    params.update();
+    const auto& p1 = params.sources[Colin::ParameterSnapshot::osc1];
+    const auto& p2 = params.sources[Colin::ParameterSnapshot::osc2];
+    const auto& pN = params.sources[Colin::ParameterSnapshot::noise];
+    const auto& pS = params.sources[Colin::ParameterSnapshot::sampler];
+    
+    /// Update global ADSR
+    if(params.isDirty(Colin::ParameterSnapshot::mainGroup)) {
+        setADSR(params.main.atk / 20.f + 0.05f, params.main.dec / 20.f, params.main.sus / 100.f, std::powf(params.main.rel, 1.4f) / 100.f);
+    }
     
     /// SAMPLER
-    if(*samplerDistSel == 2) setBezier(bezierS, xParamS, yParamS, slopeParamS, pointsS, 3);
-    sampler->setDistortion(*samplerDistSel, *samplerDAmt / 10.f, *samplerDAmt / -15.f - 3.f, *samplerDCoeff / 100.f, *samplerDistSlider / 100.f, bezierS);
-    sampler->setSampleLength(*samplerWaveSlider / 100.f);
-    if(sampler->isSampleLoaded()) {
-        sampler->setLoop(*samplerLoop);
-        sampler->setPitch(*samplerPitch, *samplerRepitch);
-        sampler->setADSR(*samplerAtk / 30.f + 0.05f, *samplerDec / 30.f, *samplerSus / 100.f, std::powf(*samplerRel, 1.2f) / 100.f, *samplerDepth / 100.f);
-        sampler->setFilter(*samplerFilter, *samplerCutoff, (*samplerRes + 1.f) / 101.f, *samplerKeytrack, *samplerktA);
-        sampler->setEnvRouting(*sampleretV, *sampleretD, *sampleretF);
-        //sampler->processBuffers(samplerBuffers, midiMessages);
-        for(int i=0; i<globalVoices.size(); i++) {
-            sampler->processBuffer(globalVoices[i]->getSampler(), midiMessages, i);
-        }
+    if(pS.distSel == 2 && (params.isDirty(Colin::ParameterSnapshot::samplerGroup) || params.isDirty(Colin::ParameterSnapshot::bezierSGroup)))
+        setBezier(bezierS, xParamS, yParamS, slopeParamS, pointsS, 3);
+    sampler->setSampleLength(pS.waveSlider / 100.f);
+    if(params.isDirty(Colin::ParameterSnapshot::samplerGroup)) {
+        sampler->setDistortion(pS.distSel, pS.drive / 10.f, pS.drive / -15.f - 3.f, pS.dCoeff / 100.f, pS.distSlider / 100.f, bezierS);
+        sampler->setLoop(pS.loop);
+        sampler->setPitch(pS.pitch, pS.repitch);
+        sampler->setADSR(pS.atk / 30.f + 0.05f, pS.dec / 30.f, pS.sus / 100.f, std::powf(pS.rel, 1.2f) / 100.f, pS.depth / 100.f);
+        sampler->setFilter(pS.filter, pS.cutoff, (pS.res + 1.f) / 101.f, pS.keytrack, pS.ktA);
+        sampler->setEnvRouting(pS.envToVol, pS.envToDist, pS.envToFilt);
     }
     
     /// NOISE
-    noise->setOscillator(*noiseWave);
-    if(*noiseDistSel == 2) setBezier(bezierN, xParamN, yParamN, slopeParamN, pointsN, 2);
-    noise->setDistortion(*noiseDistSel, *noiseDAmt / 10.f, *noiseDAmt / -15.f - 3.f, *noiseDCoeff / 100.f, *noiseDistSlider / 100.f, bezierN);
-    noise->setOscVol(*noiseWaveSlider/100);
-    noise->setADSR(*noiseAtk / 30.f + 0.05f, *noiseDec / 30.f, *noiseSus / 100.f, std::powf(*noiseRel, 1.2f) / 100.f, *noiseDepth / 100.f);
-    noise->setFilter(*noiseFilter, *noiseCutoff, (*noiseRes + 1) / 101.f, *noiseKeytrack, *noisektA);
-    noise->setEnvRouting(*noiseetV, *noiseetD, *noiseetF);
-    for(int i=0; i<globalVoices.size(); i++) {
-        noise->processBuffer(globalVoices[i]->getNoise(), midiMessages, i);
+    if(pN.distSel == 2 && (params.isDirty(Colin::ParameterSnapshot::noiseGroup) || params.isDirty(Colin::ParameterSnapshot::bezierNGroup)))
+        setBezier(bezierN, xParamN, yParamN, slopeParamN, pointsN, 2);
+    if(params.isDirty(Colin::ParameterSnapshot::noiseGroup)) {
+        noise->setOscillator(pN.wave);
+        noise->setDistortion(pN.distSel, pN.drive / 10.f, pN.drive / -15.f - 3.f, pN.dCoeff / 100.f, pN.distSlider / 100.f, bezierN);
+        noise->setOscVol(pN.waveSlider/100);
+        noise->setADSR(pN.atk / 30.f + 0.05f, pN.dec / 30.f, pN.sus / 100.f, std::powf(pN.rel, 1.2f) / 100.f, pN.depth / 100.f);
+        noise->setFilter(pN.filter, pN.cutoff, (pN.res + 1) / 101.f, pN.keytrack, pN.ktA);
+        noise->setEnvRouting(pN.envToVol, pN.envToDist, pN.envToFilt);
     }
     
     /// OSC 2
-    osc2->setOscillator(*osc2Wave);
-    if(*osc2DistSel == 2) setBezier(bezier2, xParam2, yParam2, slopeParam2, points2, 1);
-    osc2->setDistortion(*osc2DistSel, *osc2DAmt / 10.f, *osc2DAmt / -15.f - 3.f, *osc2DCoeff / 100.f, *osc2DistSlider / 100.f, bezier2);
-    osc2->setOscVol(*osc2WaveSlider/100.f);
-    osc2->setPitch(*osc2Pitch);
-    osc2->setADSR(*osc2Atk / 30.f + 0.05f, *osc2Dec / 30.f, *osc2Sus / 100.f, std::powf(*osc2Rel, 1.2f) / 100.f, *osc2Depth / 100.f);
-    osc2->setFilter(*osc2Filter, *osc2Cutoff, (*osc2Res + 1) / 101, *osc2Keytrack, *osc2ktA);
-    osc2->setEnvRouting(*osc2etV, *osc2etD / 10.f, *osc2etF);
-    if(*fmAmt2 != 0) {
-        osc2->setFMDepth(*fmAmt2 / 25.f);
-        for(int i=0; i<globalVoices.size(); i++) {
-            osc2->processBufferFM(globalVoices[i]->getOsc2(), globalVoices[i]->getNoise(), midiMessages, i);
-        }
-    }
-    else {
-        for(int i=0; i<globalVoices.size(); i++) {
-            osc2->processBuffer(globalVoices[i]->getOsc2(), midiMessages, i);
-        }
+    if(p2.distSel == 2 && (params.isDirty(Colin::ParameterSnapshot::osc2Group) || params.isDirty(Colin::ParameterSnapshot::bezier2Group)))
+        setBezier(bezier2, xParam2, yParam2, slopeParam2, points2, 1);
+    if(params.isDirty(Colin::ParameterSnapshot::osc2Group)) {
+        osc2->setOscillator(p2.wave);
+        osc2->setDistortion(p2.distSel, p2.drive / 10.f, p2.drive / -15.f - 3.f, p2.dCoeff / 100.f, p2.distSlider / 100.f, bezier2);
+        osc2->setOscVol(p2.waveSlider/100.f);
+        osc2->setPitch(p2.pitch);
+        osc2->setADSR(p2.atk / 30.f + 0.05f, p2.dec / 30.f, p2.sus / 100.f, std::powf(p2.rel, 1.2f) / 100.f, p2.depth / 100.f);
+        osc2->setFilter(p2.filter, p2.cutoff, (p2.res + 1) / 101, p2.keytrack, p2.ktA);
+        osc2->setEnvRouting(p2.envToVol, p2.envToDist, p2.envToFilt);
+        osc2->setFMDepth(p2.fm / 25.f);
+        osc2->setUnison(p2.unison, p2.detune, p2.spread / 99.f);
     }
     
     /// OSC 1
-    osc1->setOscillator(*osc1Wave);
-    osc1->setOscVol(*osc1WaveSlider/100.f);
-    osc1->setPitch(*osc1Pitch);
-    osc1->setADSR(*osc1Atk / 30.f + 0.05f, *osc1Dec / 30.f, *osc1Sus / 100.f, std::powf(*osc1Rel, 1.2) / 100.f, *osc1Depth / 100.f);
-    osc1->setFilter(*osc1Filter, *osc1Cutoff, (*osc1Res + 1.f) / 101.f, *osc1Keytrack, *osc1ktA);
-    if(*osc1DistSel == 2) setBezier(bezier1, xParam1, yParam1, slopeParam1, points1, 0);
-    osc1->setDistortion(*osc1DistSel, *osc1DAmt / 10.f, *osc1DAmt / -15.f - 3.f, *osc1DCoeff / 100.f, *osc1DistSlider / 100.f, bezier1);
-    osc1->setEnvRouting(*osc1etV, *osc1etD, *osc1etF);
-    if(*fmAmt1 != 0) {
-        osc1->setFMDepth(*fmAmt1 / 25.f);
-        for(int i=0; i<globalVoices.size(); i++) {
-            osc1->processBufferFM(globalVoices[i]->getOsc1(), globalVoices[i]->getOsc2(), midiMessages, i);
-        }
+    if(p1.distSel == 2 && (params.isDirty(Colin::ParameterSnapshot::osc1Group) || params.isDirty(Colin::ParameterSnapshot::bezier1Group)))
+        setBezier(bezier1, xParam1, yParam1, slopeParam1, points1, 0);
+    if(params.isDirty(Colin::ParameterSnapshot::osc1Group)) {
+        osc1->setOscillator(p1.wave);
+        osc1->setOscVol(p1.waveSlider/100.f);
+        osc1->setPitch(p1.pitch);
+        osc1->setADSR(p1.atk / 30.f + 0.05f, p1.dec / 30.f, p1.sus / 100.f, std::powf(p1.rel, 1.2f) / 100.f, p1.depth / 100.f);
+        osc1->setFilter(p1.filter, p1.cutoff, (p1.res + 1.f) / 101.f, p1.keytrack, p1.ktA);
+        osc1->setDistortion(p1.distSel, p1.drive / 10.f, p1.drive / -15.f - 3.f, p1.dCoeff / 100.f, p1.distSlider / 100.f, bezier1);
+        osc1->setEnvRouting(p1.envToVol, p1.envToDist, p1.envToFilt);
+        osc1->setFMDepth(p1.fm / 25.f);
+        osc1->setUnison(p1.unison, p1.detune, p1.spread / 99.f);
     }
-    else {
-        for(int i=0; i<globalVoices.size(); i++) {
-            osc1->processBuffer(globalVoices[i]->getOsc1(), midiMessages, i);
+    
+    const auto quality = getInterpolation();
+    osc1->setInterpolation(quality);
+    osc2->setInterpolation(quality);
+    sampler->setInterpolation(quality);
+    /// Each source gets its own stream from the one seed
+    const auto seed = noiseSeed.load();
+    osc1->setNoiseSeed(seed != 0 ? seed + 1 : 0);
+    osc2->setNoiseSeed(seed != 0 ? seed + 2 : 0);
+    noise->setNoiseSeed(seed != 0 ? seed + 3 : 0);
+    
+    CAPSTONE_PROFILE_MARK(profiler, control);
+    
+    /// Prepare the voice buffers for storing new audio data (no reallocation, just resize and clear), then start and release voices
+    voiceManager.beginBlock(numChannels, numSamples);
+    midiEvents.parse(midiMessages, numSamples);
+    handleMidiEvents(midiEvents);
+    CAPSTONE_PROFILE_MARK(profiler, midi);
+    
+    /// Render every voice, spread over the render pool when there's enough work to be worth it
+    fm1On = p1.fm != 0;
+    fm2On = p2.fm != 0;
+    sourceVols = { params.mix.osc1Vol/90.f, params.mix.osc2Vol/90.f, params.mix.noiseVol/90.f, params.mix.samplerVol/90.f };
+    
+    /// A muted source is still rendered when it's the FM modulator of a source we can hear
+    osc1Audible = sourceVols[0] != 0.f;
+    osc2Audible = sourceVols[1] != 0.f || (osc1Audible && fm1On);
+    noiseAudible = sourceVols[2] != 0.f || (osc2Audible && fm2On);
+    samplerAudible = sourceVols[3] != 0.f && sampler->isSampleLoaded();
+    
+    /// Oscillators that aren't FM carriers are read for all voices at once, the per-voice pass then only envelopes, distorts and filters them
+    if(oscillatorBank.load()) {
+        if(osc1Audible && !fm1On) {
+            osc1->beginOscillatorBank();
+            for(int i=0; i<voiceManager.getNumActive(); i++) {
+                auto& v = voiceManager.getVoice(i);
+                osc1->addToOscillatorBank(v.osc1, v.getOsc1Buffer(), v.getStartSample());
+            }
+            osc1->renderOscillatorBank(numSamples);
+        }
+        if(osc2Audible && !fm2On) {
+            osc2->beginOscillatorBank();
+            for(int i=0; i<voiceManager.getNumActive(); i++) {
+                auto& v = voiceManager.getVoice(i);
+                osc2->addToOscillatorBank(v.osc2, v.getOsc2Buffer(), v.getStartSample());
+            }
+            osc2->renderOscillatorBank(numSamples);
         }
     }
+    /// Noise doesn't depend on pitch, in shared mode the noise source renders a few streams here for its voices to read
+    noise->renderSharedNoise(noiseAudible && sharedNoise.load(), numSamples);
     
-    /// Apply volume envelope (set in main tab) to each of the sources
-    for(int i=0; i<globalVoices.size(); i++) {
-        globalVoices[i]->applyADSR();
+    renderPool.setNumThreads(renderThreads.load());
+    renderPool.setThreshold(parallelThreshold.load());
+    if(renderPool.shouldRunParallel(voiceManager.getNumActive(), numSamples)) {
+        renderPool.run(voiceManager.getNumActive(), renderVoiceTask);
     }
-    
-    for(int i=0; i<globalVoices.size(); i++) {
-        globalVoices[i]->setVolume(*osc1Vol/90.f, *osc2Vol/90.f, *noiseVol/90.f, *samplerVol/90.f);
+    else {
+        for(int i=0; i<voiceManager.getNumActive(); i++) {
+            renderVoice(voiceManager.getVoice(i));
+        }
     }
+    CAPSTONE_PROFILE_MARK(profiler, voices);
     
     /// SUM
-    for(int channel = 0; channel < numChannels; channel++) {
-        for(int sample = 0; sample < numSamples; sample++) {
-            float output = 0.f;
-            for(int i=0; i<globalVoices.size(); i++) {
-                output = output + globalVoices[i]->getSample(channel, sample);
-            }
-            buffer.getWritePointer(channel)[sample] = output * *mainVol/100;
-        }
+    buffer.clear();
+    const float mainGain = params.mix.mainVol / 100.f;
+    for(int i=0; i<voiceManager.getNumActive(); i++) {
+        voiceManager.getVoice(i).addTo(buffer, mainGain);
     }
-    
-    distMain->setType(*mainDistSel);
-    distMain->setInputGain(*mainDAmt / 10.f);
-    distMain->setCoeff(*mainDCoeff/100);
-    distMain->setMix(*mainDistSlider/100);
-    distMain->setOutputGain(0);
-    if(*mainDistSel == 2) {
-        setBezier(bezierM, xParamM, yParamM, slopeParamM, pointsM, 4);
+    CAPSTONE_PROFILE_MARK(profiler, sum);
+    
+    if(params.isDirty(Colin::ParameterSnapshot::mainGroup)) {
+        distMain->setType(params.main.distSel);
+        distMain->setInputGain(params.main.drive / 10.f);
+        distMain->setCoeff(params.main.dCoeff/100);
+        distMain->setMix(params.main.distSlider/100);
+        distMain->setOutputGain(0);
+        ladderM.setMode(getFilterMode(params.main.filter));
+        ladderM.setCutoffFrequencyHz(params.main.cutoff);
+        ladderM.setResonance((params.main.res + 1.f) / 101.f);
+    }
+    if(params.main.distSel == 2) {
+        if(params.isDirty(Colin::ParameterSnapshot::mainGroup) || params.isDirty(Colin::ParameterSnapshot::bezierMGroup))
+            setBezier(bezierM, xParamM, yParamM, slopeParamM, pointsM, 4);
         distMain->processBufferWaveshaper(buffer, bezierM);
     }
     else distMain->processBuffer(buffer);
+    CAPSTONE_PROFILE_MARK(profiler, mainDist);
     
     juce::dsp::AudioBlock<float> blockMain(buffer);
     auto pcM = juce::dsp::ProcessContextReplacing<float>(blockMain);
-    ladderM.setMode(getFilterMode(*mainFilter));
-    ladderM.setCutoffFrequencyHz(*mainCutoff);
-    ladderM.setResonance((*mainRes + 1.f) / 101.f);
     ladderM.process(pcM);
+    CAPSTONE_PROFILE_MARK(profiler, ladder);
     
-    limiter.setThreshold(*cThresh);
-    limiter.setRatio(*cRatio);
-    limiter.setAttack(*cAtk);
-    limiter.setRatio(*cRel);
+    if(params.isDirty(Colin::ParameterSnapshot::limiterGroup)) {
+        limiter.setThreshold(params.limiter.thresh);
+        limiter.setRatio(params.limiter.ratio);
+        limiter.setAttack(params.limiter.atk);
+        limiter.setRelease(params.limiter.rel);
+    }
     limiter.process(pcM);
+    CAPSTONE_PROFILE_MARK(profiler, limiter);
         
     rmsLevelLeft.skip(numSamples);
     rmsLevelRight.skip(numSamples);
@@ -662,29 +703,33 @@ void CapstoneAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
             rmsLevelRight.setCurrentAndTargetValue(value);
     }
     
-    for(int i=0; i<globalVoices.size(); i++) {
-        if(!globalVoices[i]->isActive()) {
-            osc1->deleteVoice(i);
-            osc2->deleteVoice(i);
-            noise->deleteVoice(i);
-            sampler->deleteVoice(i);
-            globalVoices.erase(globalVoices.begin()+i);
-        }
-    }
+    /// Hand voices whose global envelope has finished back to the voice manager
+    voiceManager.releaseFinished();
     
-    oscilloscope->setBuffer(*mainWaveSlider * 2 + 32);
+    /// Only changes how much of the scope's fixed buffer is drawn
+    if(params.isDirty(Colin::ParameterSnapshot::mixGroup)) oscilloscope->setBuffer(params.mix.scope * 2 + 32);
     oscilloscope->pushBuffer(buffer);
+    CAPSTONE_PROFILE_MARK(profiler, meters);
+    CAPSTONE_PROFILE_END(profiler, numSamples, getSampleRate());
 }
 
 //==============================================================================
 bool CapstoneAudioProcessor::hasEditor() const
 {
+   #if CAPSTONE_HEADLESS
+    return false; /// the CMake core library is built without the editor or its assets
+   #else
     return true; // (change this to false if you choose to not supply an editor)
+   #endif
 }
 
 juce::AudioProcessorEditor* CapstoneAudioProcessor::createEditor()
 {
+   #if CAPSTONE_HEADLESS
+    return nullptr;
+   #else
     return new CapstoneAudioProcessorEditor (*this);
+   #endif
 }
 
 //==============================================================================
@@ -756,41 +801,72 @@ void CapstoneAudioProcessor::randomizeParams() {
 
 /// These functions are for implementing and applying a global volume envelope to each of the sources and voices
 
-void CapstoneAudioProcessor::enableADSR(juce::MidiBuffer& midiMessages, int bufChan, int bufSize) {
-    for (const auto midiMessage : midiMessages) {
-        const auto midiEvent = midiMessage.getMessage();
-        int note = midiEvent.getNoteNumber();
-        if(midiEvent.isNoteOn()) {
-            std::unique_ptr<globalVoice> v = std::make_unique<globalVoice>(spec.sampleRate, ADSRparams, note, bufChan, bufSize);
-            globalVoices.push_back(std::move(v));
-            if(globalVoices.size() > 8) {
-                globalVoices.erase(globalVoices.begin());
-            }
+/// Renders every source of one voice, in the order the FM routing needs (noise -> osc 2 -> osc 1).
+/// This can run on a render pool thread, so it only touches the voice itself and settings fixed for the block.
+void CapstoneAudioProcessor::renderVoice(Colin::GlobalVoice& v) {
+    const int start = v.getStartSample();
+    const int release = v.getReleaseSample();
+    const int numSamples = v.getOsc1Buffer().getNumSamples();
+    
+    /// Muted sources skip rendering, distortion and filtering, their voices only advance phase and envelope
+    {
+        CAPSTONE_PROFILE_SCOPE(profiler, sampler);
+        if(samplerAudible) sampler->processBuffer(v.sampler, v.getSamplerBuffer(), start, release);
+        else if(sampler->isSampleLoaded()) sampler->skipBuffer(v.sampler, numSamples, start, release);
+    }
+    {
+        CAPSTONE_PROFILE_SCOPE(profiler, noise);
+        if(noiseAudible) noise->processBuffer(v.noise, v.getNoiseBuffer(), start, release);
+        else noise->skipBuffer(v.noise, numSamples, start, release);
+    }
+    {
+        CAPSTONE_PROFILE_SCOPE(profiler, osc2);
+        if(!osc2Audible) osc2->skipBuffer(v.osc2, numSamples, start, release);
+        else if(fm2On) osc2->processBufferFM(v.osc2, v.getOsc2Buffer(), v.getNoiseBuffer(), start, release);
+        else osc2->processBuffer(v.osc2, v.getOsc2Buffer(), start, release);
+    }
+    {
+        CAPSTONE_PROFILE_SCOPE(profiler, osc1);
+        if(!osc1Audible) osc1->skipBuffer(v.osc1, numSamples, start, release);
+        else if(fm1On) osc1->processBufferFM(v.osc1, v.getOsc1Buffer(), v.getOsc2Buffer(), start, release);
+        else osc1->processBuffer(v.osc1, v.getOsc1Buffer(), start, release);
+    }
+    
+    /// Apply volume envelope (set in main tab) to each of the sources, silent ones are left at zero
+    v.setVolume(sourceVols[0], sourceVols[1], sourceVols[2], sourceVols[3]);
+    v.applyADSR();
+}
+
+/// The only pass over the block's MIDI: voices get their note-on and note-off samples here and every source,
+/// and the global envelope, renders from those
+void CapstoneAudioProcessor::handleMidiEvents(const Colin::MidiEventList& events) {
+    for(const auto& e : events) {
+        if(e.type == Colin::MidiEvent::noteOn) {
+            /// One decision per note, every source starts on the same voice
+            auto* v = voiceManager.noteOn(e.note, e.velocity, e.sample, ADSRparams);
+            osc1->startVoice(v->osc1, e.note, e.velocity);
+            osc2->startVoice(v->osc2, e.note, e.velocity);
+            noise->startVoice(v->noise, e.note, e.velocity);
+            if(sampler->isSampleLoaded()) sampler->startVoice(v->sampler, e.note, e.velocity);
         }
-        if(midiEvent.isNoteOff()) {
-            for(int i=0; i<globalVoices.size(); i++) {
-                if(globalVoices[i]->getPitch() == note && !globalVoices[i]->isRelease()) {
-                    globalVoices[i]->noteOff();
-                    globalVoices[i]->setRelease();
-                }
-            }
+        else if(e.type == Colin::MidiEvent::noteOff) {
+            voiceManager.noteOff(e.note, e.sample);
+        }
+        else {
+            voiceManager.allNotesOff(e.sample);
         }
     }
 }
 
 void CapstoneAudioProcessor::setADSR(float atk, float dec, float sus, float rel) {
-    if(atk == ADSRparams->attack && dec == ADSRparams->decay && sus == ADSRparams->sustain && rel == ADSRparams->release) return;
-    ADSRparams = new juce::ADSR::Parameters(atk, dec, sus, rel);
-    for(int i=0; i<globalVoices.size(); i++) {
-        //ADSRs[i].reset();
-        // JUCE documentation recommends calling reset() when changing ADSR parameters, but that's lame
-        globalVoices[i]->setADSRParameters(*ADSRparams);
-    }
+    if(atk == ADSRparams.attack && dec == ADSRparams.decay && sus == ADSRparams.sustain && rel == ADSRparams.release) return;
+    ADSRparams = juce::ADSR::Parameters(atk, dec, sus, rel);
+    voiceManager.setADSRParameters(ADSRparams);
 }
 
 /// The next two functions are for the bezier used for the arbitrary waveshaping
 
-void CapstoneAudioProcessor::prepareBezier(AuxPort::Bezier* b, juce::AudioParameterFloat* x, juce::AudioParameterFloat* y, juce::AudioParameterFloat* s, std::vector<juce::Point<float>*> points, int tab) {
+void CapstoneAudioProcessor::prepareBezier(AuxPort::Bezier* b, juce::AudioParameterFloat* x, juce::AudioParameterFloat* y, juce::AudioParameterFloat* s, const std::vector<juce::Point<float>*>& points, int tab) {
     if ((*x) != points[2]->x)
         points[2]->setX(*x);
     if ((*y) != points[2]->y)
@@ -802,7 +878,7 @@ void CapstoneAudioProcessor::prepareBezier(AuxPort::Bezier* b, juce::AudioParame
     points[1]->setXY((1 - slopeFactors[tab]) * points[2]->getX(), (1 - slopeFactors[tab]) * points[2]->getY());
 }
 
-void CapstoneAudioProcessor::setBezier(AuxPort::Bezier* b, juce::AudioParameterFloat* x, juce::AudioParameterFloat* y, juce::AudioParameterFloat* s, std::vector<juce::Point<float>*> points, int tab) {
+void CapstoneAudioProcessor::setBezier(AuxPort::Bezier* b, juce::AudioParameterFloat* x, juce::AudioParameterFloat* y, juce::AudioParameterFloat* s, const std::vector<juce::Point<float>*>& points, int tab) {
     
     if ((*x) != points[2]->x)
         points[2]->setX(*x);
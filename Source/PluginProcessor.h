@@ -15,6 +15,11 @@
 #include "../AuxParam.h"
 #include "../GainMeter.h"
 #include "../Synth/Sampler.h"
+#include "../Synth/VoiceManager.h"
+#include "../Synth/RenderPool.h"
+#include "../Synth/MidiEventList.h"
+#include "ParameterSnapshot.h"
+#include "StageProfiler.h"
 #include "../UI/Oscilloscope.h"
 #include "../Presets/PresetManager.h"
 #include "../Presets/ParameterHelper.h"
@@ -24,125 +29,6 @@
 /**
 */
 
-class globalVoice {
-public:
-    globalVoice(double sampleRate, juce::ADSR::Parameters* params, int pitch, int bufChan, int bufSize) {
-        osc1Buffer.reset(new juce::AudioBuffer<float>(bufChan,bufSize));
-        osc2Buffer.reset(new juce::AudioBuffer<float>(bufChan,bufSize));
-        noiseBuffer.reset(new juce::AudioBuffer<float>(bufChan,bufSize));
-        samplerBuffer.reset(new juce::AudioBuffer<float>(bufChan,bufSize));
-        osc1Buffer->clear();
-        osc2Buffer->clear();
-        noiseBuffer->clear();
-        samplerBuffer->clear();
-        adsr.setSampleRate(sampleRate);
-        adsr.setParameters(*params);
-        adsr.reset();
-        this->pitch = pitch;
-        adsr.noteOn();
-    }
-    
-    ~globalVoice() {
-        osc1Buffer->clear();
-        osc2Buffer->clear();
-        noiseBuffer->clear();
-        samplerBuffer->clear();
-    }
-    
-    std::unique_ptr<juce::AudioBuffer<float>>& getOsc1() {
-        return osc1Buffer;
-    }
-    
-    std::unique_ptr<juce::AudioBuffer<float>>& getOsc2() {
-        return osc2Buffer;
-    }
-    
-    std::unique_ptr<juce::AudioBuffer<float>>& getNoise() {
-        return noiseBuffer;
-    }
-    
-    std::unique_ptr<juce::AudioBuffer<float>>& getSampler() {
-        return samplerBuffer;
-    }
-    
-    void setADSRParameters(juce::ADSR::Parameters params) {
-        adsr.setParameters(params);
-    }
-    
-    void noteOn() {
-        adsr.noteOn();
-    }
-    
-    void noteOff() {
-        adsr.noteOff();
-    }
-    
-    bool isActive() {
-        return adsr.isActive();
-    }
-    
-    float getNextSample() {
-        return adsr.getNextSample();
-    }
-    
-    void reset() {
-        adsr.reset();
-    }
-    
-    void setRelease() {
-        release = true;
-    }
-    
-    int getPitch() {
-        return pitch;
-    }
-    
-    bool isRelease() {
-        return release;
-    }
-    
-    void cycleADSR(int offset) {
-        for(int i=offset; i<osc1Buffer->getNumSamples(); i++) {
-            adsr.getNextSample();
-        }
-    }
-    
-    void applyADSR() {
-        float envSampleStart = adsr.getNextSample();
-        cycleADSR(2);
-        float envSampleEnd = adsr.getNextSample();
-        osc1Buffer->applyGainRamp(0, osc1Buffer->getNumSamples(), envSampleStart, envSampleEnd);
-        osc2Buffer->applyGainRamp(0, osc1Buffer->getNumSamples(), envSampleStart, envSampleEnd);
-        noiseBuffer->applyGainRamp(0, osc1Buffer->getNumSamples(), envSampleStart, envSampleEnd);
-        samplerBuffer->applyGainRamp(0, osc1Buffer->getNumSamples(), envSampleStart, envSampleEnd);
-    }
-    
-    float getSample(int channel, int sample) {
-        return osc1Buffer->getSample(channel, sample) * osc1Vol + osc2Buffer->getSample(channel, sample) * osc2Vol + noiseBuffer->getSample(channel, sample) * noiseVol + samplerBuffer->getSample(channel, sample) * samplerVol;
-    }
-    
-    void setVolume(float osc1, float osc2, float noise, float sampler) {
-        osc1Vol = osc1;
-        osc2Vol = osc2;
-        noiseVol = noise;
-        samplerVol = sampler;
-    }
-private:
-    std::unique_ptr<juce::AudioBuffer<float>> osc1Buffer;
-    std::unique_ptr<juce::AudioBuffer<float>> osc2Buffer;
-    std::unique_ptr<juce::AudioBuffer<float>> noiseBuffer;
-    std::unique_ptr<juce::AudioBuffer<float>> samplerBuffer;
-    juce::ADSR adsr;
-    int pitch = 0;
-    bool release = false;
-    
-    float osc1Vol;
-    float osc2Vol;
-    float noiseVol;
-    float samplerVol;
-};
-
-
 class CapstoneAudioProcessor  : public juce::AudioProcessor
                             #if JucePlugin_Enable_ARA
                              , public juce::AudioProcessorARAExtension
@@ -200,7 +86,8 @@ public:
     float getSampleFromSampler(std::vector<juce::AudioBuffer<float>*>&, int channel, int sample);
     void applyADSR(std::vector<juce::AudioBuffer<float>*>&);
     void applyADSRSampler(std::vector<juce::AudioBuffer<float>*>&);
-    void enableADSR(juce::MidiBuffer&, int bufChan, int bufSize);
+    void handleMidiEvents(const Colin::MidiEventList&);
+    void renderVoice(Colin::GlobalVoice& v);
     void setADSR(float atk, float dec, float sus, float rel);
     Colin::Distortion* distMain;
     
@@ -216,21 +103,60 @@ public:
     
     Service::PresetManager& getPresetManager() { return presetManager; }
     
+    /// Render settings, kept out of the ParameterMap so they aren't automated, randomized or saved with presets.
+    /// 1 thread renders everything on the audio thread, the threshold is active voices x block size.
+    /// Polyphony (up to VoiceManager::MAX_VOICES) is allocated in prepareToPlay, so a change waits for the next one.
+    /// The oscillator bank renders every voice's non-FM oscillators in one SIMD pass, off uses the per-voice scalar path.
+    /// Interpolation applies to the oscillators and the sampler, cheap tiers for tracking and sinc for a bounce.
+    /// A noise seed other than 0 makes the noise and unison phases the same on every render, note for note.
+    /// Shared noise renders a few noise streams per block for the noise source's voices to share instead of one per voice
+    void setRenderThreads(int numThreads) { renderThreads = numThreads; }
+    void setOscillatorBank(bool shouldUseBank) { oscillatorBank = shouldUseBank; }
+    bool getOscillatorBank() const { return oscillatorBank; }
+    void setInterpolation(Colin::Interpolation quality) { interpolation = static_cast<int>(quality); }
+    Colin::Interpolation getInterpolation() const { return static_cast<Colin::Interpolation>(interpolation.load()); }
+    void setNoiseSeed(std::uint64_t seed) { noiseSeed = seed; }
+    std::uint64_t getNoiseSeed() const { return noiseSeed; }
+    void setSharedNoise(bool shouldShare) { sharedNoise = shouldShare; }
+    bool getSharedNoise() const { return sharedNoise; }
+    void setParallelThreshold(int voiceSamples) { parallelThreshold = voiceSamples; }
+    void setPolyphony(int numVoices) { voiceManager.setPolyphony(numVoices); }
+    int getRenderThreads() const { return renderThreads; }
+    int getParallelThreshold() const { return parallelThreshold; }
+    int getPolyphony() const { return voiceManager.getPolyphony(); }
+    
+   #if CAPSTONE_PROFILING
+    /// Filled on the audio thread, read by the editor's diagnostics page
+    Colin::StageProfiler profiler;
+   #endif
+    
 private:
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CapstoneAudioProcessor)
         
     juce::dsp::ProcessSpec spec;
     
-    std::vector<std::unique_ptr<globalVoice>> globalVoices;
-
-    std::vector<juce::AudioBuffer<float>*> osc1Buffers;
-    std::vector<juce::AudioBuffer<float>*> osc2Buffers;
-    std::vector<juce::AudioBuffer<float>*> noiseBuffers;
-    std::vector<juce::AudioBuffer<float>*> samplerBuffers;
-    
-    void prepareBezier(AuxPort::Bezier* b, juce::AudioParameterFloat* x, juce::AudioParameterFloat* y, juce::AudioParameterFloat* s, std::vector<juce::Point<float>*> points, int tab);
-    void setBezier(AuxPort::Bezier* b, juce::AudioParameterFloat* x, juce::AudioParameterFloat* y, juce::AudioParameterFloat* s, std::vector<juce::Point<float>*> points, int tab);
+    Colin::ParameterSnapshot params;
+    Colin::VoiceManager voiceManager;
+    Colin::MidiEventList midiEvents; /// this block's MIDI, decoded once
+    Colin::RenderPool renderPool;
+    std::function<void(int)> renderVoiceTask; /// built once in the constructor so run() never allocates
+    bool fm1On = false;
+    bool fm2On = false;
+    bool osc1Audible = true;
+    bool osc2Audible = true;
+    bool noiseAudible = true;
+    bool samplerAudible = true;
+    std::array<float, 4> sourceVols {};
+    std::atomic<int> renderThreads { 1 };
+    std::atomic<int> parallelThreshold { 2048 };
+    std::atomic<bool> oscillatorBank { true };
+    std::atomic<int> interpolation { static_cast<int>(Colin::Interpolation::linear) };
+    std::atomic<std::uint64_t> noiseSeed { 0 };
+    std::atomic<bool> sharedNoise { false };
+    
+    void prepareBezier(AuxPort::Bezier* b, juce::AudioParameterFloat* x, juce::AudioParameterFloat* y, juce::AudioParameterFloat* s, const std::vector<juce::Point<float>*>& points, int tab);
+    void setBezier(AuxPort::Bezier* b, juce::AudioParameterFloat* x, juce::AudioParameterFloat* y, juce::AudioParameterFloat* s, const std::vector<juce::Point<float>*>& points, int tab);
     
     juce::AudioParameterFloat* yParam1;
     juce::AudioParameterFloat* xParam1;
@@ -254,7 +180,7 @@ private:
     std::vector<juce::Point<float>*> pointsM;
     std::vector<float> slopeFactors;
     
-    juce::ADSR::Parameters* ADSRparams;
+    juce::ADSR::Parameters ADSRparams; /// held by value, setADSR runs on the audio thread
     //std::vector<newADSR*> ADSRs;
     //std::vector<int> activeADSRs;
     
@@ -325,6 +251,13 @@ private:
     juce::AudioParameterInt * osc1Wave;
     juce::AudioParameterInt * osc2Wave;
     juce::AudioParameterInt * noiseWave;
+    juce::AudioParameterInt * noiseColour;
+    juce::AudioParameterInt * osc1Unison;
+    juce::AudioParameterInt * osc2Unison;
+    juce::AudioParameterFloat * osc1Detune;
+    juce::AudioParameterFloat * osc2Detune;
+    juce::AudioParameterFloat * osc1Spread;
+    juce::AudioParameterFloat * osc2Spread;
     
     juce::AudioParameterFloat * osc1WaveSlider;
     juce::AudioParameterFloat * osc2WaveSlider;
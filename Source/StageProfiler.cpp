@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    StageProfiler.cpp
+
+  ==============================================================================
+*/
+
+#include "StageProfiler.h"
+
+#if CAPSTONE_PROFILING
+
+#include <algorithm>
+
+namespace Colin
+{
+
+const char* StageProfiler::getStageName(int stage) {
+    static const char* const names[numStages] = {
+        "control", "midi", "voices", "  sampler", "  noise", "  osc 2", "  osc 1", "sum", "main dist", "ladder", "limiter", "meters", "total"
+    };
+    return juce::isPositiveAndBelow(stage, static_cast<int>(numStages)) ? names[stage] : "";
+}
+
+void StageProfiler::beginBlock() {
+    for(auto& a : accumulated) a.store(0, std::memory_order_relaxed);
+    blockStart = juce::Time::getHighResolutionTicks();
+    lastMark = blockStart;
+}
+
+void StageProfiler::mark(Stage stage) {
+    const auto now = juce::Time::getHighResolutionTicks();
+    add(stage, now - lastMark);
+    lastMark = now;
+}
+
+/// Never blocks: when the message thread hasn't drained the ring the frame is dropped and counted
+void StageProfiler::endBlock(int numSamples, double sampleRate) {
+    add(total, juce::Time::getHighResolutionTicks() - blockStart);
+
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(1, start1, size1, start2, size2);
+    if(size1 + size2 < 1) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    auto& frame = ring[static_cast<size_t>(size1 > 0 ? start1 : start2)];
+    for(size_t i=0; i<numStages; i++) frame.ticks[i] = accumulated[i].load(std::memory_order_relaxed);
+    frame.numSamples = numSamples;
+    frame.sampleRate = sampleRate;
+    fifo.finishedWrite(1);
+}
+
+StageProfiler::Report StageProfiler::collect() {
+    /// Drain the ring into the rolling window
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(fifo.getNumReady(), start1, size1, start2, size2);
+    const auto take = [this](int start, int size) {
+        for(int i=start; i<start+size; i++) {
+            if(static_cast<int>(window.size()) < WINDOW_SIZE) window.push_back(ring[static_cast<size_t>(i)]);
+            else window[static_cast<size_t>(windowPos)] = ring[static_cast<size_t>(i)];
+            windowPos = (windowPos + 1) % WINDOW_SIZE;
+        }
+    };
+    take(start1, size1);
+    take(start2, size2);
+    fifo.finishedRead(size1 + size2);
+
+    Report report;
+    report.dropped = dropped.exchange(0);
+    report.numBlocks = static_cast<int>(window.size());
+    if(window.empty()) return report;
+
+    const auto toMicros = [](juce::int64 ticks) { return juce::Time::highResolutionTicksToSeconds(ticks) * 1.0e6; };
+    std::vector<double> budgets, micros(window.size());
+    for(const auto& f : window) budgets.push_back(f.sampleRate > 0.0 ? f.numSamples / f.sampleRate * 1.0e6 : 0.0);
+    for(double b : budgets) report.budgetMicros += b / static_cast<double>(window.size());
+
+    for(size_t s=0; s<numStages; s++) {
+        auto& stats = report.stages[s];
+        for(size_t i=0; i<window.size(); i++) {
+            micros[i] = toMicros(window[i].ticks[s]);
+            stats.meanMicros += micros[i] / static_cast<double>(window.size());
+            if(budgets[i] > 0.0) stats.budgetPercent += 100.0 * micros[i] / budgets[i] / static_cast<double>(window.size());
+        }
+        const auto p99 = micros.begin() + static_cast<std::ptrdiff_t>((micros.size() - 1) * 99 / 100);
+        std::nth_element(micros.begin(), p99, micros.end());
+        stats.p99Micros = *p99;
+    }
+    return report;
+}
+
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    StageProfiler times each stage of processBlock and each source's voice rendering,
+    the audio thread pushes one frame of timings per block into a lock-free ring and the
+    diagnostics page drains it on the message thread into mean / p99 / % of buffer budget.
+
+    Only compiled into debug builds, or any build with CAPSTONE_PROFILING=1.
+    In other builds the class doesn't exist and the macros below are empty.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#ifndef CAPSTONE_PROFILING
+ #if JUCE_DEBUG
+  #define CAPSTONE_PROFILING 1
+ #else
+  #define CAPSTONE_PROFILING 0
+ #endif
+#endif
+
+#if CAPSTONE_PROFILING
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+namespace Colin
+{
+
+class StageProfiler {
+public:
+    /// control .. meters partition processBlock in order, voices is the wall time of the render stage
+    /// and sampler .. osc1 are CPU time summed over every voice (and render thread) in the block
+    enum Stage {
+        control = 0, midi, voices, sampler, noise, osc2, osc1, sum, mainDist, ladder, limiter, meters, total,
+        numStages
+    };
+    static const char* getStageName(int stage);
+
+    /// Audio thread. mark() charges the time since the previous mark (or beginBlock) to a stage
+    void beginBlock();
+    void mark(Stage stage);
+    void endBlock(int numSamples, double sampleRate);
+
+    /// Any render thread, for work that interleaves with other stages
+    class Scope {
+    public:
+        Scope(StageProfiler& p, Stage s) : profiler(p), stage(s), start(juce::Time::getHighResolutionTicks()) {}
+        ~Scope() { profiler.add(stage, juce::Time::getHighResolutionTicks() - start); }
+    private:
+        StageProfiler& profiler;
+        const Stage stage;
+        const juce::int64 start;
+        JUCE_DECLARE_NON_COPYABLE(Scope)
+    };
+
+    /// Message thread
+    struct StageStats {
+        double meanMicros = 0.0;
+        double p99Micros = 0.0;
+        double budgetPercent = 0.0; /// mean share of the time one buffer lasts
+    };
+    struct Report {
+        std::array<StageStats, numStages> stages {};
+        int numBlocks = 0;           /// blocks in the window the stats cover
+        double budgetMicros = 0.0;   /// mean buffer length
+        int dropped = 0;             /// frames lost because the ring was full since the last collect()
+    };
+    Report collect();
+
+private:
+    struct Frame {
+        std::array<juce::int64, numStages> ticks {};
+        int numSamples = 0;
+        double sampleRate = 0.0;
+    };
+
+    static constexpr int RING_SIZE = 1024;
+    static constexpr int WINDOW_SIZE = 512; /// blocks the stats are computed over
+
+    void add(Stage stage, juce::int64 ticks) { accumulated[static_cast<size_t>(stage)].fetch_add(ticks, std::memory_order_relaxed); }
+
+    std::array<std::atomic<juce::int64>, numStages> accumulated {};
+    juce::int64 blockStart = 0;
+    juce::int64 lastMark = 0;
+
+    juce::AbstractFifo fifo { RING_SIZE };
+    std::array<Frame, RING_SIZE> ring;
+    std::atomic<int> dropped { 0 };
+
+    std::vector<Frame> window; /// message thread only
+    int windowPos = 0;
+};
+
+}
+
+#define CAPSTONE_PROFILE_BEGIN(profiler)                profiler.beginBlock()
+#define CAPSTONE_PROFILE_MARK(profiler, stage)          profiler.mark(Colin::StageProfiler::stage)
+#define CAPSTONE_PROFILE_SCOPE(profiler, stage)         const Colin::StageProfiler::Scope JUCE_JOIN_MACRO(profileScope, __LINE__) (profiler, Colin::StageProfiler::stage)
+#define CAPSTONE_PROFILE_END(profiler, samples, rate)   profiler.endBlock(samples, rate)
+
+#else
+
+#define CAPSTONE_PROFILE_BEGIN(profiler)
+#define CAPSTONE_PROFILE_MARK(profiler, stage)
+#define CAPSTONE_PROFILE_SCOPE(profiler, stage)
+#define CAPSTONE_PROFILE_END(profiler, samples, rate)
+
+#endif
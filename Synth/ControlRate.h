@@ -0,0 +1,62 @@
+#ifndef Colin_ControlRate_H
+#define Colin_ControlRate_H
+
+#include <JuceHeader.h>
+
+/*
+  ==============================================================================
+
+    ControlRate.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+/// Envelopes, filter cutoff and the distortion envelope move every CONTROL_BLOCK samples, counted from note-on,
+/// so a note sounds and costs the same whatever block size the host uses. Smaller is smoother and costs more,
+/// build with CAPSTONE_CONTROL_BLOCK defined to change it
+#ifndef CAPSTONE_CONTROL_BLOCK
+ #define CAPSTONE_CONTROL_BLOCK 32
+#endif
+
+namespace Colin
+{
+
+constexpr int CONTROL_BLOCK = CAPSTONE_CONTROL_BLOCK;
+static_assert(CONTROL_BLOCK >= 1 && CONTROL_BLOCK <= 4096, "CAPSTONE_CONTROL_BLOCK must be 1 - 4096 samples");
+
+/// Cuts a voice's samples into control-rate segments. The grid carries over from one host block to the next,
+/// a segment only comes up short where the host block or a note-off ends first
+
+class ControlClock {
+public:
+    void reset() {
+        samplesLeft = 0;
+        atControlPoint = false;
+    }
+
+    /// Length of the next segment, at most maxSamples
+    int next(int maxSamples) {
+        atControlPoint = samplesLeft == 0;
+        if(atControlPoint) samplesLeft = CONTROL_BLOCK;
+        const int n = juce::jmin(samplesLeft, maxSamples);
+        samplesLeft -= n;
+        return n;
+    }
+
+    /// True when the segment next() just returned starts on the grid, which is when control values are read
+    bool isControlPoint() const { return atControlPoint; }
+
+    /// Moves the grid on without segmenting, for muted voices
+    void skip(int numSamples) {
+        samplesLeft = ((samplesLeft - numSamples) % CONTROL_BLOCK + CONTROL_BLOCK) % CONTROL_BLOCK;
+    }
+
+private:
+    int samplesLeft = 0;
+    bool atControlPoint = false;
+};
+
+}
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef Colin_Envelope_H
+#define Colin_Envelope_H
+
+#include <cmath>
+#include <JuceHeader.h>
+
+/*
+  ==============================================================================
+
+    Envelope.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+
+/// Linear ADSR that behaves sample for sample like juce::ADSR, plus skip() which jumps ahead
+/// in O(1) so a muted source can keep its envelope in step without rendering
+
+class Envelope {
+public:
+    using Parameters = juce::ADSR::Parameters;
+    
+    Envelope() { recalculateRates(); }
+    
+    void setSampleRate(double newSampleRate) {
+        jassert(newSampleRate > 0.0);
+        sampleRate = newSampleRate;
+        recalculateRates();
+    }
+    
+    void setParameters(const Parameters& newParameters) {
+        parameters = newParameters;
+        recalculateRates();
+    }
+    
+    const Parameters& getParameters() const { return parameters; }
+    
+    bool isActive() const { return state != State::idle; }
+    
+    /// The last value getNextSample() returned, or where skip() left it
+    float getValue() const { return envelopeVal; }
+    
+    void reset() {
+        envelopeVal = 0.f;
+        state = State::idle;
+    }
+    
+    void noteOn() {
+        if(attackRate > 0.f) {
+            state = State::attack;
+        }
+        else if(decayRate > 0.f) {
+            envelopeVal = 1.f;
+            state = State::decay;
+        }
+        else {
+            envelopeVal = parameters.sustain;
+            state = State::sustain;
+        }
+    }
+    
+    void noteOff() {
+        if(state == State::idle) return;
+        if(parameters.release > 0.f) {
+            releaseRate = static_cast<float>(envelopeVal / (parameters.release * sampleRate));
+            state = State::release;
+        }
+        else reset();
+    }
+    
+    float getNextSample() {
+        switch(state) {
+            case State::idle:
+                return 0.f;
+            case State::attack:
+                envelopeVal += attackRate;
+                if(envelopeVal >= 1.f) {
+                    envelopeVal = 1.f;
+                    goToNextState();
+                }
+                break;
+            case State::decay:
+                envelopeVal -= decayRate;
+                if(envelopeVal <= parameters.sustain) {
+                    envelopeVal = parameters.sustain;
+                    goToNextState();
+                }
+                break;
+            case State::sustain:
+                envelopeVal = parameters.sustain;
+                break;
+            case State::release:
+                envelopeVal -= releaseRate;
+                if(envelopeVal <= 0.f) goToNextState();
+                break;
+        }
+        return envelopeVal;
+    }
+    
+    /// Same result as calling getNextSample() numSamples times, but each segment is crossed in one step
+    void skip(int numSamples) {
+        while(numSamples > 0 && state != State::idle) {
+            if(state == State::sustain) {
+                envelopeVal = parameters.sustain;
+                return;
+            }
+            const float rate = state == State::attack ? attackRate : state == State::decay ? decayRate : releaseRate;
+            const float target = state == State::attack ? 1.f : state == State::decay ? parameters.sustain : 0.f;
+            const float distance = std::abs(target - envelopeVal);
+            const int steps = rate > 0.f ? juce::jmax(1, static_cast<int>(std::ceil(distance / rate))) : 1;
+            if(numSamples < steps) {
+                envelopeVal += (state == State::attack ? rate : -rate) * static_cast<float>(numSamples);
+                return;
+            }
+            numSamples -= steps;
+            if(state != State::release) envelopeVal = target;
+            goToNextState();
+        }
+    }
+    
+private:
+    enum class State { idle, attack, decay, sustain, release };
+    
+    void recalculateRates() {
+        auto getRate = [this](float distance, float timeInSeconds) {
+            return timeInSeconds > 0.f ? static_cast<float>(distance / (timeInSeconds * sampleRate)) : -1.f;
+        };
+        attackRate = getRate(1.f, parameters.attack);
+        decayRate = getRate(1.f - parameters.sustain, parameters.decay);
+        releaseRate = getRate(parameters.sustain, parameters.release);
+        
+        if((state == State::attack && attackRate <= 0.f)
+           || (state == State::decay && (decayRate <= 0.f || envelopeVal <= parameters.sustain))
+           || (state == State::release && releaseRate <= 0.f))
+            goToNextState();
+    }
+    
+    void goToNextState() {
+        if(state == State::attack) state = decayRate > 0.f ? State::decay : State::sustain;
+        else if(state == State::decay) state = State::sustain;
+        else if(state == State::release) reset();
+    }
+    
+    Parameters parameters;
+    double sampleRate = 44100.0;
+    State state = State::idle;
+    float envelopeVal = 0.f;
+    float attackRate = 0.f;
+    float decayRate = 0.f;
+    float releaseRate = 0.f;
+};
+
+}
+
+#endif
@@ -0,0 +1,42 @@
+/*
+  ==============================================================================
+
+    Interpolation.cpp
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+#include "Interpolation.h"
+#include <cmath>
+
+namespace Colin
+{
+namespace Interpolator
+{
+
+/// Tap k of row p sits k - p / SINC_PHASES points from the read position, the window spans all eight taps
+SincTable::SincTable() {
+    const double pi = 3.14159265358979323846;
+    const double halfWidth = SINC_TAPS / 2;
+    for(int p = 0; p < SINC_PHASES; p++) {
+        const double fraction = static_cast<double>(p) / SINC_PHASES;
+        double row[SINC_TAPS];
+        double sum = 0.0;
+        for(int t = 0; t < SINC_TAPS; t++) {
+            const double x = static_cast<double>(t - TAPS_BEFORE) - fraction;
+            const double sinc = x == 0.0 ? 1.0 : std::sin(pi * x) / (pi * x);
+            const double window = 0.42 + 0.5 * std::cos(pi * x / halfWidth) + 0.08 * std::cos(2.0 * pi * x / halfWidth);
+            row[t] = sinc * window;
+            sum += row[t];
+        }
+        for(int t = 0; t < SINC_TAPS; t++)
+            coefficients[static_cast<size_t>(p * SINC_TAPS + t)] = static_cast<float>(row[t] / sum);
+    }
+}
+
+/// Built when the plugin loads, never on the audio thread
+const SincTable sincTable;
+
+}
+}
@@ -0,0 +1,101 @@
+#ifndef Colin_Interpolation_H
+#define Colin_Interpolation_H
+
+#include <array>
+#include <cstdint>
+
+/*
+  ==============================================================================
+
+    Interpolation.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+
+/// How wavetables and samples are read between their points. Draft truncates, linear is what the synth always did,
+/// hermite is the 4-point cubic the reverb's delay lines use, sinc is an 8-tap Blackman windowed sinc. Each step costs
+/// more and leaves less imaging, pick the cheaper ones for tracking and sinc for a bounce
+enum class Interpolation {
+    draft = 1, linear, hermite, sinc, end
+};
+
+/// The kernels are written once for any type with + - * and a float constructor, so the scalar oscillators and the
+/// OscillatorBank's SIMD lanes run exactly the same arithmetic. tap(k) reads the point k after the one under the
+/// read position (k from -3 to 4), coefficient(k) reads the sinc kernel row for the fraction at the same k
+namespace Interpolator
+{
+
+/// For the tools' options and reports
+inline const char* getName(Interpolation quality) {
+    constexpr const char* names[] = { "draft", "linear", "hermite", "sinc" };
+    const int i = static_cast<int>(quality) - static_cast<int>(Interpolation::draft);
+    return i >= 0 && i < 4 ? names[i] : "linear";
+}
+
+constexpr int SINC_TAPS = 8;
+constexpr int SINC_PHASES = 1024; /// kernel rows, the fraction picks the nearest one below
+constexpr int TAPS_BEFORE = 3;    /// points each tier may read before and after the read position
+constexpr int TAPS_AFTER = 4;
+
+/// Row p holds the taps for a fraction of p / SINC_PHASES, normalised to unity gain
+struct SincTable {
+    SincTable();
+    alignas(64) std::array<float, SINC_PHASES * SINC_TAPS> coefficients;
+};
+
+extern const SincTable sincTable;
+
+template <Interpolation quality, typename Value, typename Tap, typename Coefficient>
+inline Value read(Tap&& tap, Coefficient&& coefficient, Value fraction) {
+    if constexpr (quality == Interpolation::draft) {
+        return tap(0);
+    }
+    else if constexpr (quality == Interpolation::linear) {
+        const Value truncatedWeight = Value(1.f) - fraction;
+        return truncatedWeight * tap(0) + fraction * tap(1);
+    }
+    else if constexpr (quality == Interpolation::hermite) {
+        /// Buffer::cubicInter() in Reverb/Delay.h
+        const Value a = tap(-1), b = tap(0), c = tap(1), d = tap(2);
+        const Value cbDiff = c - b;
+        const Value k1 = (c - a) * Value(0.5f);
+        const Value k3 = k1 + (d - b) * Value(0.5f) - cbDiff * Value(2.f);
+        const Value k2 = cbDiff - k3 - k1;
+        return b + fraction * (k1 + fraction * (k2 + fraction * k3));
+    }
+    else {
+        Value sum = coefficient(-TAPS_BEFORE) * tap(-TAPS_BEFORE);
+        for(int k = 1 - TAPS_BEFORE; k <= TAPS_AFTER; k++) sum = sum + coefficient(k) * tap(k);
+        return sum;
+    }
+}
+
+/// The sinc row for a fraction in [0, 1)
+inline const float* sincRow(float fraction) {
+    return sincTable.coefficients.data() + static_cast<int>(fraction * static_cast<float>(SINC_PHASES)) * SINC_TAPS + TAPS_BEFORE;
+}
+
+/// For reads one point at a time, where the quality is only known at runtime
+template <typename Tap>
+inline float read(Interpolation quality, Tap&& tap, float fraction) {
+    const float* row = sincRow(fraction);
+    auto coefficient = [row](int k) { return row[k]; };
+    switch(quality) {
+        case Interpolation::draft: return read<Interpolation::draft>(tap, coefficient, fraction);
+        case Interpolation::hermite: return read<Interpolation::hermite>(tap, coefficient, fraction);
+        case Interpolation::sinc: return read<Interpolation::sinc>(tap, coefficient, fraction);
+        case Interpolation::linear:
+        case Interpolation::end: break;
+    }
+    return read<Interpolation::linear>(tap, coefficient, fraction);
+}
+
+}
+
+}
+
+#endif
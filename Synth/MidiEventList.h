@@ -0,0 +1,84 @@
+#ifndef Colin_MidiEventList_H
+#define Colin_MidiEventList_H
+
+#include <array>
+#include <cstdint>
+#include <JuceHeader.h>
+
+/*
+  ==============================================================================
+
+    MidiEventList.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+
+/// One note event, decoded from the raw MIDI bytes
+struct MidiEvent {
+    enum Type : std::uint8_t { noteOn, noteOff, allNotesOff };
+    int sample = 0;          /// offset into the block
+    Type type = noteOn;
+    std::uint8_t note = 0;
+    std::uint8_t velocity = 0;
+};
+
+/// The block's MIDI decoded once, in a fixed array, before any voice or source looks at it.
+/// Only the events the synth responds to are kept, in the order the host sent them (MidiBuffer is sorted by sample),
+/// and the raw bytes are read directly so a sysex message can't make processBlock allocate
+
+class MidiEventList {
+public:
+    static constexpr int MAX_EVENTS = 2048;
+
+    void parse(const juce::MidiBuffer& midi, int numSamples) {
+        numEvents = 0;
+        for(const auto metadata : midi) {
+            if(metadata.numBytes < 3) continue;
+            const auto* data = metadata.data;
+            const int status = data[0] & 0xf0;
+            MidiEvent e;
+            e.sample = juce::jlimit(0, juce::jmax(0, numSamples - 1), metadata.samplePosition);
+            e.note = static_cast<std::uint8_t>(data[1] & 0x7f);
+            e.velocity = static_cast<std::uint8_t>(data[2] & 0x7f);
+            if(status == 0x90) e.type = e.velocity > 0 ? MidiEvent::noteOn : MidiEvent::noteOff;
+            else if(status == 0x80) e.type = MidiEvent::noteOff;
+            else if(status == 0xb0 && (e.note == 120 || e.note == 123)) e.type = MidiEvent::allNotesOff; /// all sound off, all notes off
+            else continue;
+            add(e);
+        }
+    }
+
+    int size() const { return numEvents; }
+    const MidiEvent& operator[](int i) const { return events[static_cast<size_t>(i)]; }
+    const MidiEvent* begin() const { return events.data(); }
+    const MidiEvent* end() const { return events.data() + numEvents; }
+
+private:
+    /// A full list keeps note-offs by dropping the newest note-on, a dropped note-off would hang a voice
+    void add(const MidiEvent& e) {
+        if(numEvents < MAX_EVENTS) {
+            events[static_cast<size_t>(numEvents++)] = e;
+            return;
+        }
+        jassertfalse;
+        if(e.type == MidiEvent::noteOn) return;
+        for(int i=numEvents-1; i>=0; i--) {
+            if(events[static_cast<size_t>(i)].type == MidiEvent::noteOn) {
+                for(int j=i; j<numEvents-1; j++) events[static_cast<size_t>(j)] = events[static_cast<size_t>(j+1)];
+                events[static_cast<size_t>(numEvents-1)] = e;
+                return;
+            }
+        }
+    }
+
+    std::array<MidiEvent, MAX_EVENTS> events {};
+    int numEvents = 0;
+};
+
+}
+
+#endif
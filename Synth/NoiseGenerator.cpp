@@ -0,0 +1,333 @@
+/*
+  ==============================================================================
+
+    NoiseGenerator.cpp
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+#include <algorithm>
+#include <cmath>
+#include "NoiseGenerator.h"
+#include "SimdLanes.h"
+#if defined(_MSC_VER)
+ #include <intrin.h>
+#endif
+
+namespace Colin
+{
+
+using namespace Lanes;
+
+static_assert(NoiseGenerator::LANES % WIDTH == 0, "lanes are stepped in whole groups");
+
+namespace
+{
+
+constexpr std::uint32_t ONE = 0x3f800000u;  /// 1.f
+constexpr std::uint32_t HALF = 0x3f000000u; /// 0.5f
+constexpr std::uint32_t SIGN = 0x80000000u;
+
+/// The top 23 bits as the mantissa of a float in [1, 2), less 1.5. xoshiro128+'s weak bits are its lowest ones.
+/// The subtraction is exact, so the vector and scalar versions agree to the bit
+inline Floats white(Ints bits) { return asFloats(bitOr(shiftRight<9>(bits), broadcast(ONE))) - Floats(1.5f); }
+inline Floats binary(Ints bits) { return asFloats(bitOr(mask(bits, broadcast(SIGN)), broadcast(HALF))); }
+
+inline float bitsToFloat(std::uint32_t bits) {
+    float x;
+    std::memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+inline float whiteSample(std::uint32_t bits) { return bitsToFloat((bits >> 9) | ONE) - 1.5f; }
+inline float binarySample(std::uint32_t bits) { return bitsToFloat((bits & SIGN) | HALF); }
+
+/// Each pink row and the white row is a 16 bit value, the white row from bits 4 - 15 so it skips the weak ones.
+/// Seventeen of them, scaled to white noise's loudness
+constexpr int CHUNK = 64; /// raw draws buffered on the stack at a time
+constexpr float PINK_SCALE = 1.f / (2.f * 4.1231056f * 32768.f);
+inline std::int32_t pinkRow(std::uint32_t bits) { return static_cast<std::int32_t>(bits) >> 16; }
+inline std::int32_t pinkWhite(std::uint32_t bits) { return static_cast<std::int32_t>((bits << 16) & 0xfff00000u) >> 16; }
+
+inline int trailingZeros(std::uint32_t x) {
+   #if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, x);
+    return static_cast<int>(index);
+   #else
+    return __builtin_ctz(x);
+   #endif
+}
+
+}
+
+void NoiseGenerator::prepare(double sampleRate) {
+    velvetPeriod = std::max(1, static_cast<int>(std::lround(sampleRate / VELVET_DENSITY)));
+    velvetPosition = 0;
+
+    /// y = a * y[n-1] + g * x, g gives the same RMS as the white noise going in
+    const double a = std::exp(-2.0 * 3.141592653589793 * BROWN_CORNER / sampleRate);
+    const double g = std::sqrt(1.0 - a * a);
+    for(int j = 0; j < LANES; j++) {
+        for(int k = 0; k < LANES; k++)
+            brownTaps[static_cast<size_t>(j)][static_cast<size_t>(k)] = k < j ? 0.f : static_cast<float>(g * std::pow(a, k - j));
+        brownDecay[static_cast<size_t>(j)] = static_cast<float>(std::pow(a, j + 1));
+    }
+}
+
+void NoiseGenerator::seed(std::uint64_t seed) {
+    for(size_t lane = 0; lane < LANES; lane++) {
+        for(auto& word : state) {
+            seed += 0x9e3779b97f4a7c15ull;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            word[lane] = static_cast<std::uint32_t>((z ^ (z >> 31)) >> 32);
+        }
+        /// An all zero state only ever gives zeros
+        if((state[0][lane] | state[1][lane] | state[2][lane] | state[3][lane]) == 0) state[0][lane] = 1;
+    }
+    cursor = LANES;
+    reset();
+}
+
+void NoiseGenerator::reset() {
+    prevHPNoiseSample = 0.f;
+    prevLPNoiseSample = 0.f;
+    brownSample = 0.f;
+    brownCursor = LANES;
+    velvetPosition = 0;
+    pinkRest = 0;
+    pinkCounter = 0;
+    pinkCursor = LANES;
+    alignas(32) std::uint32_t bits[PINK_ROWS];
+    drawBits(bits, PINK_ROWS);
+    for(size_t row = 0; row < pinkRows.size(); row++) {
+        pinkRows[row] = pinkRow(bits[row]);
+        if(row >= 3) pinkRest += pinkRows[row];
+    }
+}
+
+/// xoshiro128+, every lane's state held in registers for the whole run
+template <typename Sink>
+void NoiseGenerator::run(int steps, Sink&& sink) {
+    constexpr int GROUPS = LANES / WIDTH;
+    Ints s0[GROUPS], s1[GROUPS], s2[GROUPS], s3[GROUPS];
+    for(int g = 0; g < GROUPS; g++) {
+        const size_t first = static_cast<size_t>(g * WIDTH);
+        s0[g] = loadInts(&state[0][first]);
+        s1[g] = loadInts(&state[1][first]);
+        s2[g] = loadInts(&state[2][first]);
+        s3[g] = loadInts(&state[3][first]);
+    }
+    for(int step = 0; step < steps; step++) {
+        for(int g = 0; g < GROUPS; g++) {
+            const Ints result = add(s0[g], s3[g]);
+            const Ints t = shiftLeft<9>(s1[g]);
+            s2[g] = bitXor(s2[g], s0[g]);
+            s3[g] = bitXor(s3[g], s1[g]);
+            s1[g] = bitXor(s1[g], s2[g]);
+            s0[g] = bitXor(s0[g], s3[g]);
+            s2[g] = bitXor(s2[g], t);
+            s3[g] = rotateLeft<11>(s3[g]);
+            sink(step, g * WIDTH, result);
+        }
+    }
+    for(int g = 0; g < GROUPS; g++) {
+        const size_t first = static_cast<size_t>(g * WIDTH);
+        storeInts(&state[0][first], s0[g]);
+        storeInts(&state[1][first], s1[g]);
+        storeInts(&state[2][first], s2[g]);
+        storeInts(&state[3][first], s3[g]);
+    }
+}
+
+/// Uses up what's pending from the last block, then whole steps straight into out, then one more step for the tail
+template <typename T, typename Vector, typename Scalar>
+void NoiseGenerator::draw(T* out, int numSamples, Vector vector, Scalar scalar) {
+    int i = 0;
+    for(; i < numSamples && cursor < LANES; i++, cursor++) out[i] = scalar(pending[static_cast<size_t>(cursor)]);
+
+    const int steps = (numSamples - i) / LANES;
+    T* block = out + i;
+    run(steps, [block, vector](int step, int lane, Ints bits) { vector(block + step * LANES + lane, bits); });
+    i += steps * LANES;
+
+    if(i == numSamples) return;
+    run(1, [this](int, int lane, Ints bits) { storeInts(&pending[static_cast<size_t>(lane)], bits); });
+    for(cursor = 0; i < numSamples; i++, cursor++) out[i] = scalar(pending[static_cast<size_t>(cursor)]);
+}
+
+template <Noise_Type type>
+void NoiseGenerator::fill(float* out, int numSamples) {
+    if constexpr (type == Noise_Type::binary)
+        draw(out, numSamples, [](float* p, Ints bits) { storeUnaligned(p, binary(bits)); }, binarySample);
+    else
+        draw(out, numSamples, [](float* p, Ints bits) { storeUnaligned(p, white(bits)); }, whiteSample);
+}
+
+/// The stream's raw bits, for the kernels that make their own samples from them
+void NoiseGenerator::drawBits(std::uint32_t* out, int numSamples) {
+    draw(out, numSamples, [](std::uint32_t* p, Ints bits) { storeUnaligned(p, bits); }, [](std::uint32_t bits) { return bits; });
+}
+
+/// Whole groups of eight straight into out, with the same pending and tail handling as draw(), so the groups stay
+/// lined up with the stream whatever the block sizes
+template <typename Kernel>
+void NoiseGenerator::grouped(float* out, int numSamples, std::array<float, LANES>& groupPending, int& groupCursor, Kernel kernel) {
+    int i = 0;
+    for(; i < numSamples && groupCursor < LANES; i++, groupCursor++) out[i] = groupPending[static_cast<size_t>(groupCursor)];
+
+    const int groups = (numSamples - i) / LANES;
+    kernel(out + i, groups);
+    i += groups * LANES;
+
+    if(i == numSamples) return;
+    kernel(groupPending.data(), 1);
+    for(groupCursor = 0; i < numSamples; i++, groupCursor++) out[i] = groupPending[static_cast<size_t>(groupCursor)];
+}
+
+/// Voss-McCartney replaces row k every 2^(k + 1) samples. Counted in groups of eight, the rows replaced are always
+/// 0, 1, 0, 2, 0, 1, 0 and then one of the rest, so a group is a fixed pattern of adds on values held in registers and
+/// only the last sample looks a row up
+void NoiseGenerator::pinkGroups(float* out, int numGroups) {
+    constexpr int GROUPS_PER_CHUNK = CHUNK / LANES;
+    alignas(32) std::uint32_t bits[CHUNK];
+    std::int32_t r1 = pinkRows[1], r2 = pinkRows[2], rest = pinkRest;
+    std::uint32_t counter = pinkCounter;
+    for(int first = 0; first < numGroups; first += GROUPS_PER_CHUNK) {
+        const int n = std::min(GROUPS_PER_CHUNK, numGroups - first);
+        drawBits(bits, n * LANES);
+        for(int g = 0; g < n; g++) {
+            const std::uint32_t* b = bits + g * LANES;
+            std::int32_t v[LANES];
+            for(int j = 0; j < LANES; j++) v[j] = pinkRow(b[j]);
+            /// The top bit caps the rows, the last one also takes every wrap of the counter
+            const size_t row = static_cast<size_t>(3 + trailingZeros(++counter | 1u << (PINK_ROWS - 4)));
+            const std::int32_t next = rest + v[7] - pinkRows[row];
+            pinkRows[row] = v[7];
+            const std::int32_t total[LANES] = {
+                v[0] + r1 + r2 + rest,
+                v[0] + v[1] + r2 + rest,
+                v[2] + v[1] + r2 + rest,
+                v[2] + v[1] + v[3] + rest,
+                v[4] + v[1] + v[3] + rest,
+                v[4] + v[5] + v[3] + rest,
+                v[6] + v[5] + v[3] + rest,
+                v[6] + v[5] + v[3] + next
+            };
+            float* y = out + (first + g) * LANES;
+            for(int j = 0; j < LANES; j++) y[j] = static_cast<float>(total[j] + pinkWhite(b[j])) * PINK_SCALE;
+            pinkRows[0] = v[6];
+            r1 = v[5];
+            r2 = v[3];
+            rest = next;
+        }
+    }
+    pinkRows[1] = r1;
+    pinkRows[2] = r2;
+    pinkRest = rest;
+    pinkCounter = counter;
+}
+
+/// Runs a step of the recursion per group of eight: each output is its group's inputs through the taps, plus the last
+/// output of the group before decayed. Only that one value is carried from group to group, so the chain the filter
+/// waits on is an eighth as long as a sample by sample loop. Every lane sums its taps in the same order, so any width
+/// gives the same samples
+void NoiseGenerator::brownGroups(float* x, int numGroups) {
+    const float* decay = brownDecay.data();
+    float y = brownSample;
+    for(int group = 0; group < numGroups; group++, x += LANES) {
+        alignas(32) float in[LANES];
+        std::copy(x, x + LANES, in);
+        for(int first = 0; first < LANES; first += WIDTH) {
+            Floats sum = loadFloats(decay + first) * Floats(y);
+            for(int j = 0; j < LANES; j++)
+                sum = sum + Floats(in[j]) * loadFloats(&brownTaps[static_cast<size_t>(j)][static_cast<size_t>(first)]);
+            storeUnaligned(x + first, sum);
+        }
+        y = x[LANES - 1];
+    }
+    brownSample = y;
+}
+
+/// Clears the block and steps a period at a time, taking each period's place and sign from a draw when it starts.
+/// The draws for the periods starting in the block are made together up front. The sign is the draw's top bit put
+/// straight into 1.f, a coin flip branch would be mispredicted every other period
+void NoiseGenerator::velvet(float* out, int numSamples) {
+    std::fill(out, out + numSamples, 0.f);
+    const int period = velvetPeriod;
+    int position = velvetPosition;
+    int impulse = velvetImpulse;
+    float sign = velvetSign;
+    alignas(32) std::uint32_t draws[CHUNK];
+    int drawn = 0, used = 0;
+    for(int i = 0; i < numSamples;) {
+        if(position == 0) {
+            if(used == drawn) {
+                drawn = std::min(CHUNK, (numSamples - i + period - 1) / period);
+                drawBits(draws, drawn);
+                used = 0;
+            }
+            const std::uint32_t bits = draws[used++];
+            impulse = static_cast<int>((static_cast<std::uint64_t>(bits & ~SIGN) * static_cast<std::uint64_t>(period)) >> 31);
+            sign = bitsToFloat((bits & SIGN) | ONE);
+        }
+        const int length = std::min(period - position, numSamples - i);
+        const int offset = impulse - position;
+        if(offset >= 0 && offset < length) out[i + offset] = sign;
+        i += length;
+        position += length;
+        if(position == period) position = 0;
+    }
+    velvetPosition = position;
+    velvetImpulse = impulse;
+    velvetSign = sign;
+}
+
+void NoiseGenerator::render(Noise_Type type, float* out, int numSamples) {
+    switch(type) {
+        case Noise_Type::binary:
+            fill<Noise_Type::binary>(out, numSamples);
+            break;
+        case Noise_Type::lp: {
+            /// y = x / 2 - y[n-1] / 2 feeds back on itself, so the filter stays a scalar loop over the vector noise
+            fill<Noise_Type::gauss>(out, numSamples);
+            float y = prevLPNoiseSample;
+            for(int i = 0; i < numSamples; i++) {
+                y = 0.5f * out[i] - 0.5f * y;
+                out[i] = y;
+            }
+            prevLPNoiseSample = y;
+            break;
+        }
+        case Noise_Type::hp: {
+            /// y = -x / 2 + x[n-1] / 2, run backwards so every sample still reads the unfiltered one before it
+            fill<Noise_Type::gauss>(out, numSamples);
+            if(numSamples == 0) break;
+            const float last = out[numSamples - 1];
+            for(int i = numSamples - 1; i > 0; i--) out[i] = -0.5f * out[i] + 0.5f * out[i - 1];
+            out[0] = -0.5f * out[0] + 0.5f * prevHPNoiseSample;
+            prevHPNoiseSample = last;
+            break;
+        }
+        case Noise_Type::pink:
+            grouped(out, numSamples, pinkPending, pinkCursor, [this](float* x, int groups) { pinkGroups(x, groups); });
+            break;
+        case Noise_Type::brown:
+            grouped(out, numSamples, brownPending, brownCursor, [this](float* x, int groups) {
+                fill<Noise_Type::gauss>(x, groups * LANES);
+                brownGroups(x, groups);
+            });
+            break;
+        case Noise_Type::velvet:
+            velvet(out, numSamples);
+            break;
+        case Noise_Type::gauss:
+        case Noise_Type::end:
+            fill<Noise_Type::gauss>(out, numSamples);
+            break;
+    }
+}
+
+}
@@ -0,0 +1,91 @@
+#ifndef Colin_NoiseGenerator_H
+#define Colin_NoiseGenerator_H
+
+#include <array>
+#include <cstdint>
+
+/*
+  ==============================================================================
+
+    NoiseGenerator.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+
+enum class Noise_Type {
+    gauss = 1, binary, lp, hp, pink, brown, velvet, end
+};
+
+/// One voice's noise, rendered a block at a time. Eight xoshiro128+ generators run side by side, one per SIMD lane
+/// (two passes on SSE2 and NEON, one on AVX2), and each writes every eighth sample. A vector of noise costs a few
+/// integer ops and touches no shared state. The type is switched on once per block, not per sample.
+///
+/// The stream is always eight lanes wide whatever the instruction set, and samples left over from a block carry into
+/// the next one. The same seed gives the same samples on any machine and for any block sizes.
+///
+/// Pink is Voss-McCartney on integer rows, so its running sum never drifts. Brown is white noise through a leaky
+/// integrator, eight samples per step of the recursion. Velvet is one impulse of random sign at a random place in
+/// every period of 1 / VELVET_DENSITY seconds, and costs a clear of the block plus one draw per impulse, less than white.
+
+class NoiseGenerator {
+public:
+    static constexpr int LANES = 8;
+    static constexpr int PINK_ROWS = 16;           /// octaves below the white row, down to about 1 Hz at 44.1 kHz
+    static constexpr float BROWN_CORNER = 20.f;    /// Hz, below this brown noise flattens out instead of drifting off
+    static constexpr float VELVET_DENSITY = 2000.f; /// impulses per second, dense enough to sound smooth
+
+    NoiseGenerator() { prepare(44100.0); }
+
+    /// Sets brown noise's corner and velvet noise's impulse spacing
+    void prepare(double sampleRate);
+
+    /// Spreads the seed over every lane's state with splitmix64, so nearby seeds still give unrelated streams
+    void seed(std::uint64_t seed);
+
+    /// Clears the filters and starts a new velvet period, for a new note. The pink rows are refilled rather than
+    /// cleared, so the lowest octaves are there from the first sample
+    void reset();
+
+    /// Writes numSamples of noise. White is in -0.5 to 0.5, pink and brown have its RMS and velvet impulses are +-1
+    void render(Noise_Type type, float* out, int numSamples);
+
+private:
+    template <Noise_Type type> void fill(float* out, int numSamples);
+    template <typename T, typename Vector, typename Scalar> void draw(T* out, int numSamples, Vector vector, Scalar scalar);
+    template <typename Sink> void run(int steps, Sink&& sink);
+    void drawBits(std::uint32_t* out, int numSamples);
+    template <typename Kernel>
+    void grouped(float* out, int numSamples, std::array<float, LANES>& groupPending, int& groupCursor, Kernel kernel);
+    void pinkGroups(float* out, int numGroups);
+    void brownGroups(float* x, int numGroups);
+    void velvet(float* out, int numSamples);
+
+    alignas(32) std::array<std::array<std::uint32_t, LANES>, 4> state {};
+    alignas(32) std::array<std::uint32_t, LANES> pending {}; /// a step's output not yet used, from cursor on
+    int cursor = LANES;
+    float prevHPNoiseSample = 0.f;
+    float prevLPNoiseSample = 0.f;
+
+    std::array<std::int32_t, PINK_ROWS> pinkRows {};
+    std::int32_t pinkRest = 0;       /// rows 3 and up, which change once a group
+    std::uint32_t pinkCounter = 0;   /// groups
+    alignas(32) std::array<float, LANES> pinkPending {};
+    int pinkCursor = LANES;
+    alignas(32) std::array<std::array<float, LANES>, LANES> brownTaps {}; /// [j][k], input j's part in output k of a group
+    alignas(32) std::array<float, LANES> brownDecay {};                    /// what's left of the previous output
+    alignas(32) std::array<float, LANES> brownPending {};
+    int brownCursor = LANES;
+    float brownSample = 0.f;
+    int velvetPeriod = 1;
+    int velvetPosition = 0; /// samples into the current period
+    int velvetImpulse = 0;  /// where in the current period its impulse falls
+    float velvetSign = 1.f;
+};
+
+}
+
+#endif
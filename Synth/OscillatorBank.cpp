@@ -0,0 +1,105 @@
+/*
+  ==============================================================================
+
+    OscillatorBank.cpp
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+#include "OscillatorBank.h"
+
+namespace Colin
+{
+
+static_assert(OscillatorBank::MAX_LANES % OscillatorBank::WIDTH == 0, "lanes are rendered in whole groups");
+
+using namespace Lanes;
+
+void OscillatorBank::addVoice(WavetableOscillator& oscillator, float voiceGain, int startSample, float* output) {
+    jassert(numLanes < MAX_LANES);
+    if(numLanes >= MAX_LANES || table == nullptr) return;
+    const size_t lane = static_cast<size_t>(numLanes++);
+    phase[lane] = oscillator.getPhase();
+    increment[lane] = oscillator.getPhaseIncrement();
+    const auto selection = WavetableMipmap::select(oscillator.getIncrement());
+    level[lane] = selection.first;
+    nextLevel[lane] = selection.second;
+    levelFade[lane] = selection.fade;
+    gain[lane] = voiceGain;
+    start[lane] = startSample;
+    outputs[lane] = output;
+    oscillators[lane] = &oscillator;
+}
+
+void OscillatorBank::render(int numSamples) {
+    if(numLanes == 0) return;
+    /// Lanes after the last voice in the final group never start, so they never move or write
+    const int numGroups = (numLanes + WIDTH - 1) / WIDTH;
+    for(int lane = numLanes; lane < numGroups * WIDTH; lane++) {
+        const size_t l = static_cast<size_t>(lane);
+        phase[l] = 0;
+        increment[l] = 0;
+        level[l] = WavetableMipmap::GUARD_BEFORE;
+        nextLevel[l] = WavetableMipmap::GUARD_BEFORE;
+        levelFade[l] = 0.f;
+        gain[l] = 0.f;
+        start[l] = numSamples;
+        outputs[l] = nullptr;
+    }
+    for(int group = 0; group < numGroups; group++) {
+        switch(interpolation) {
+            case Interpolation::draft: renderGroup<Interpolation::draft>(group * WIDTH, numSamples); break;
+            case Interpolation::hermite: renderGroup<Interpolation::hermite>(group * WIDTH, numSamples); break;
+            case Interpolation::sinc: renderGroup<Interpolation::sinc>(group * WIDTH, numSamples); break;
+            case Interpolation::linear:
+            case Interpolation::end: renderGroup<Interpolation::linear>(group * WIDTH, numSamples); break;
+        }
+    }
+    for(int lane = 0; lane < numLanes; lane++) oscillators[static_cast<size_t>(lane)]->setPhase(phase[static_cast<size_t>(lane)]);
+}
+
+/// Same arithmetic as WavetableOscillator::renderBlock(): the phase's top bits index both of the lane's levels and the
+/// rest are the fraction the Interpolator weights by, the levels are crossfaded, then the phase moves on and wraps by
+/// overflowing
+template <Interpolation quality>
+void OscillatorBank::renderGroup(int firstLane, int numSamples) {
+    using Interpolator::read;
+    const float* t0 = table;
+    const float* sinc = Interpolator::sincTable.coefficients.data() + Interpolator::TAPS_BEFORE;
+    const size_t g = static_cast<size_t>(firstLane);
+    const int lanes = juce::jmin(WIDTH, numLanes - firstLane);
+    alignas(32) float y[WIDTH];
+
+    const Ints fractionMask = broadcast(WavetableOscillator::FRACTION_MASK);
+    const Floats fractionScale = WavetableOscillator::FRACTION_SCALE;
+    const Floats sincPhases = static_cast<float>(Interpolator::SINC_PHASES);
+    const Ints inc = loadInts(&increment[g]);
+    const Ints firstLevel = loadInts(&level[g]);
+    const Ints secondLevel = loadInts(&nextLevel[g]);
+    const Ints st = loadInts(&start[g]);
+    const Floats fade = loadFloats(&levelFade[g]);
+    const Floats gn = loadFloats(&gain[g]);
+    Ints p = loadInts(&phase[g]);
+
+    for(int t = 0; t < numSamples; t++) {
+        const Ints index = shiftRight<WavetableOscillator::FRACTION_BITS>(p);
+        const Floats fraction = toFloats(mask(p, fractionMask)) * fractionScale;
+        const Ints a = add(index, firstLevel);
+        const Ints b = add(index, secondLevel);
+        Ints row {};
+        if constexpr (quality == Interpolation::sinc)
+            row = shiftLeft<3>(truncate(fraction * sincPhases));
+        static_assert(Interpolator::SINC_TAPS == 1 << 3, "rows are found by shifting");
+        auto coefficient = [sinc, row](int k) { return gather(sinc + k, row); };
+
+        const Floats first = read<quality>([t0, a](int k) { return gather(t0 + k, a); }, coefficient, fraction);
+        const Floats second = read<quality>([t0, b](int k) { return gather(t0 + k, b); }, coefficient, fraction);
+        storeFloats(y, (first + fade * (second - first)) * gn);
+        for(int l = 0; l < lanes; l++) if(t >= start[g + static_cast<size_t>(l)]) outputs[g + static_cast<size_t>(l)][t] = y[l];
+        p = add(p, mask(inc, startedBy(t, st)));
+    }
+    storeInts(&phase[g], p);
+}
+
+}
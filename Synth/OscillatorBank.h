@@ -0,0 +1,75 @@
+#ifndef Colin_OscillatorBank_H
+#define Colin_OscillatorBank_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <JuceHeader.h>
+#include "WavetableOsc.h"
+#include "SimdLanes.h"
+
+/*
+  ==============================================================================
+
+    OscillatorBank.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+
+/// Renders the wavetable oscillators of every active voice of one source together. Phase, increment, velocity gain
+/// and start sample sit in contiguous arrays, one lane per voice, and 4 (SSE2, NEON) or 8 (AVX2) voices move through
+/// the table per pass. The result goes straight into each voice's buffer.
+///
+/// Every voice of a source plays the source's WavetableMipmap, so the lanes share it, each with its own pair of
+/// band-limited levels picked from its increment when it's added. Phases are the oscillator's 32-bit fixed point, so
+/// they wrap with a plain integer add. Output matches WavetableOscillator::getSample() * velocity gain to within
+/// TOLERANCE, the only difference being how the compiler rounds the interpolation (fused multiply-add or not).
+/// Tools/OscillatorBankCheck measures it.
+
+class OscillatorBank {
+public:
+    static constexpr int MAX_LANES = 64;
+    static constexpr int WIDTH = Lanes::WIDTH;
+    static constexpr float TOLERANCE = 1.0e-5f;
+
+    /// The mipmap belongs to the Synth and outlives the bank
+    void setWavetable(const WavetableMipmap& mipmap) { table = mipmap.data(); }
+
+    void clear() { numLanes = 0; }
+
+    /// Every Interpolation has a SIMD path, the same kernels WavetableOscillator runs one sample at a time
+    void setInterpolation(Interpolation quality) { interpolation = quality; }
+
+    /// Reads the oscillator's phase and increment, render() writes the phase back. output is channel 0 of the voice's
+    /// buffer, written from startSample on (the samples before it are left alone)
+    void addVoice(WavetableOscillator& oscillator, float gain, int startSample, float* output);
+
+    void render(int numSamples);
+
+    int getNumLanes() const { return numLanes; }
+
+private:
+    template <Interpolation quality> void renderGroup(int firstLane, int numSamples);
+
+    const float* table = nullptr;
+    Interpolation interpolation = Interpolation::linear;
+
+    alignas(32) std::array<std::uint32_t, MAX_LANES> phase {};
+    alignas(32) std::array<std::uint32_t, MAX_LANES> increment {};
+    alignas(32) std::array<int, MAX_LANES> level {};      /// offsets of the lane's two mipmap levels
+    alignas(32) std::array<int, MAX_LANES> nextLevel {};
+    alignas(32) std::array<float, MAX_LANES> levelFade {};
+    alignas(32) std::array<float, MAX_LANES> gain {};
+    alignas(32) std::array<int, MAX_LANES> start {};
+    std::array<float*, MAX_LANES> outputs {};
+    std::array<WavetableOscillator*, MAX_LANES> oscillators {};
+    int numLanes = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,183 @@
+/*
+  ==============================================================================
+
+    RenderPool.cpp
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+#include "RenderPool.h"
+
+#if JUCE_MAC || JUCE_IOS
+ #include <dispatch/dispatch.h>
+#elif JUCE_WINDOWS
+ #ifndef NOMINMAX
+  #define NOMINMAX
+ #endif
+ #include <windows.h>
+#else
+ #include <cerrno>
+ #include <semaphore.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+ #include <emmintrin.h>
+#elif defined(_M_ARM64)
+ #include <intrin.h>
+#endif
+
+namespace Colin
+{
+
+namespace {
+
+/// Tells the core this is a spin-wait, so it backs off and leaves the pipeline to the other hyperthread
+inline void cpuPause() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(_M_ARM64)
+    __yield();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+}
+
+#if JUCE_MAC || JUCE_IOS
+RenderPool::Semaphore::Semaphore() : handle(dispatch_semaphore_create(0)) {}
+RenderPool::Semaphore::~Semaphore() { dispatch_release(static_cast<dispatch_semaphore_t>(handle)); }
+void RenderPool::Semaphore::post() { dispatch_semaphore_signal(static_cast<dispatch_semaphore_t>(handle)); }
+void RenderPool::Semaphore::wait() { dispatch_semaphore_wait(static_cast<dispatch_semaphore_t>(handle), DISPATCH_TIME_FOREVER); }
+#elif JUCE_WINDOWS
+RenderPool::Semaphore::Semaphore() : handle(CreateSemaphoreW(nullptr, 0, MAXLONG, nullptr)) {}
+RenderPool::Semaphore::~Semaphore() { CloseHandle(static_cast<HANDLE>(handle)); }
+void RenderPool::Semaphore::post() { ReleaseSemaphore(static_cast<HANDLE>(handle), 1, nullptr); }
+void RenderPool::Semaphore::wait() { WaitForSingleObject(static_cast<HANDLE>(handle), INFINITE); }
+#else
+RenderPool::Semaphore::Semaphore() : handle(new sem_t) { sem_init(static_cast<sem_t*>(handle), 0, 0); }
+RenderPool::Semaphore::~Semaphore() {
+    sem_destroy(static_cast<sem_t*>(handle));
+    delete static_cast<sem_t*>(handle);
+}
+void RenderPool::Semaphore::post() { sem_post(static_cast<sem_t*>(handle)); }
+void RenderPool::Semaphore::wait() {
+    while(sem_wait(static_cast<sem_t*>(handle)) != 0 && errno == EINTR) {}
+}
+#endif
+
+RenderPool::~RenderPool() {
+    release();
+}
+
+/// Starts one thread per spare core (up to MAX_THREADS - 1), called from prepareToPlay() only
+void RenderPool::prepare() {
+    if(!workers.isEmpty()) return;
+    const int numWorkers = juce::jlimit(0, MAX_THREADS - 1, juce::SystemStats::getNumCpus() - 1);
+    for(int i=1; i<=numWorkers; i++) {
+        auto* w = workers.add(new Worker(*this, i));
+        w->startThread(juce::Thread::Priority::highest);
+    }
+}
+
+void RenderPool::release() {
+    for(auto* w : workers) {
+        w->signalThreadShouldExit();
+        w->wake.post();
+    }
+    for(auto* w : workers) {
+        w->stopThread(1000);
+    }
+    workers.clear();
+}
+
+/// Only changes how many of the already running threads take part, so it's safe to call every block
+void RenderPool::setNumThreads(int n) {
+    numThreads = juce::jlimit(1, workers.size() + 1, n);
+}
+
+/// Below the threshold (active voices x block size) waking the workers costs more than it saves
+bool RenderPool::shouldRunParallel(int numTasks, int numSamples) {
+    return numThreads > 1 && numTasks > 1 && numTasks * numSamples >= threshold;
+}
+
+void RenderPool::run(int numTasks, const std::function<void(int)>& task) {
+    if(numTasks <= 0) return;
+    const int threads = juce::jmin(numThreads, numTasks);
+    if(threads <= 1) {
+        for(int i=0; i<numTasks; i++) task(i);
+        return;
+    }
+    
+    job.store(&task);
+    remaining.store(numTasks);
+    for(int t=0; t<MAX_THREADS; t++) {
+        const int begin = t < threads ? numTasks * t / threads : 0;
+        const int end = t < threads ? numTasks * (t + 1) / threads : 0;
+        queues[t].range.store(pack(static_cast<juce::uint32>(begin), static_cast<juce::uint32>(end)));
+    }
+    for(int t=1; t<threads; t++) {
+        workers[t - 1]->wake.post();
+    }
+    
+    work(0);
+    while(remaining.load() > 0) {
+        /// Everything left is already claimed by a worker, it can only be a short wait
+        cpuPause();
+    }
+    job.store(nullptr);
+}
+
+bool RenderPool::popFront(int queue, int& task) {
+    auto& range = queues[queue].range;
+    auto current = range.load();
+    for(;;) {
+        const auto begin = static_cast<juce::uint32>(current >> 32);
+        const auto end = static_cast<juce::uint32>(current);
+        if(begin >= end) return false;
+        if(range.compare_exchange_weak(current, pack(begin + 1, end))) {
+            task = static_cast<int>(begin);
+            return true;
+        }
+    }
+}
+
+bool RenderPool::stealBack(int queue, int& task) {
+    auto& range = queues[queue].range;
+    auto current = range.load();
+    for(;;) {
+        const auto begin = static_cast<juce::uint32>(current >> 32);
+        const auto end = static_cast<juce::uint32>(current);
+        if(begin >= end) return false;
+        if(range.compare_exchange_weak(current, pack(begin, end - 1))) {
+            task = static_cast<int>(end - 1);
+            return true;
+        }
+    }
+}
+
+void RenderPool::work(int self) {
+    juce::ScopedNoDenormals noDenormals;
+    int task = 0;
+    for(;;) {
+        bool found = popFront(self, task);
+        for(int i=1; !found && i<MAX_THREADS; i++) {
+            found = stealBack((self + i) % MAX_THREADS, task);
+        }
+        if(!found) return;
+        (*job.load())(task);
+        remaining.fetch_sub(1);
+    }
+}
+
+void RenderPool::Worker::run() {
+    while(!threadShouldExit()) {
+        /// release() posts once more after asking the thread to exit, so this never needs a timeout
+        wake.wait();
+        if(threadShouldExit()) return;
+        pool.work(index);
+    }
+}
+
+}
@@ -0,0 +1,85 @@
+#ifndef Colin_RenderPool_H
+#define Colin_RenderPool_H
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <JuceHeader.h>
+
+/*
+  ==============================================================================
+
+    RenderPool.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+
+/// Optional worker pool for rendering voices on several cores.
+/// The threads are started in prepare() and sleep between blocks, run() hands each thread a contiguous
+/// range of tasks and threads that run out steal from the back of the others' ranges.
+/// The audio thread works as thread 0 and spins until every task is done, so nothing here allocates or blocks it.
+/// Workers are woken through a semaphore each, which posts without taking a lock.
+
+class RenderPool {
+public:
+    static constexpr int MAX_THREADS = 8; /// including the audio thread
+    
+    RenderPool() = default;
+    ~RenderPool();
+    void prepare();
+    void release();
+    void setNumThreads(int n);
+    void setThreshold(int voiceSamples) { threshold = voiceSamples; }
+    int getNumThreads() { return numThreads; }
+    bool shouldRunParallel(int numTasks, int numSamples);
+    void run(int numTasks, const std::function<void(int)>& task);
+    
+private:
+    /// A counting semaphore. post() is an atomic add, plus a kernel wake only when the worker is asleep, where
+    /// juce::WaitableEvent::signal() takes a mutex and a condition variable
+    class Semaphore {
+    public:
+        Semaphore();
+        ~Semaphore();
+        void post();
+        void wait();
+    private:
+        void* handle = nullptr;
+        JUCE_DECLARE_NON_COPYABLE(Semaphore)
+    };
+    
+    class Worker : public juce::Thread {
+    public:
+        Worker(RenderPool& p, int i) : juce::Thread("Render Worker " + juce::String(i)), pool(p), index(i) {}
+        void run() override;
+        Semaphore wake;
+    private:
+        RenderPool& pool;
+        int index;
+    };
+    
+    /// begin in the top 32 bits, end in the bottom, packed so the owner and thieves can both claim a task with one CAS
+    struct alignas(64) TaskRange {
+        std::atomic<juce::uint64> range { 0 };
+    };
+    
+    static juce::uint64 pack(juce::uint32 begin, juce::uint32 end) { return (static_cast<juce::uint64>(begin) << 32) | end; }
+    bool popFront(int queue, int& task);
+    bool stealBack(int queue, int& task);
+    void work(int self);
+    
+    std::array<TaskRange, MAX_THREADS> queues;
+    std::atomic<int> remaining { 0 };
+    std::atomic<const std::function<void(int)>*> job { nullptr };
+    juce::OwnedArray<Worker> workers;
+    int numThreads = 1;
+    int threshold = 2048;
+};
+
+}
+
+#endif
@@ -16,9 +16,7 @@ Sampler::Sampler() {
     formatManager.registerBasicFormats();
 }
 
-Sampler::~Sampler() {
-    voices.clear();
-}
+Sampler::~Sampler() {}
 
 void Sampler::prepareToPlay(juce::dsp::ProcessSpec spec) {
     this->sampleRate = spec.sampleRate;
@@ -54,129 +52,108 @@ void Sampler::setEnvRouting(bool vol, bool dist, bool filt) {
 void Sampler::setPitch(float p, bool re) {
     pitch = static_cast<int>(std::roundf(p));
     repitch = re;
-    for(int i=0; i<voices.size(); i++) {
-        voices[i]->setPitchOffset(pitch);
-        voices[i]->setRepitch(repitch);
-    }
 }
 
 void Sampler::loadFile() {
     juce::File f = (juce::File::getSpecialLocation(juce::File::tempDirectory));
     juce::FileChooser chooser { "Load a sample", f};
     if(chooser.browseForFileToOpen()) {
-        auto file = chooser.getResult();
-        formatReader.reset(formatManager.createReaderFor(file));
-        if (formatReader)
-        {
-            auto len = static_cast<int>(formatReader->lengthInSamples);
-            waveform.setSize(1, len);
-            sampleLength = len;
-            formatReader->read(&waveform, 0, len, 0, true, false);
-        }
+        loadFile(chooser.getResult());
+        return;
     }
     sampleLoaded = true;
 }
 
-void Sampler::setNoteOff(int note) {
-    for(int i=0; i<NUM_VOICES; i++) {
-        if(curPitch[i] == note) {
-            if(repitch) jucesamplers[i]->noteOff(1, 60 + pitch, 0, true);
-            else jucesamplers[i]->noteOff(1, note, 0, true);
-            curPitch[i] = -1;
-            //envs[i].reset();
-            enabled[note] = 0;
-            lastVel[i] = 0;
-            curSample[i] = 0;
-        }
+void Sampler::loadFile(const juce::File& file) {
+    formatReader.reset(formatManager.createReaderFor(file));
+    if (formatReader)
+    {
+        auto len = static_cast<int>(formatReader->lengthInSamples);
+        waveform.setSize(1, len);
+        sampleLength = len;
+        waveformSampleRate = formatReader->sampleRate;
+        formatReader->read(&waveform, 0, len, 0, true, false);
     }
+    sampleLoaded = true;
 }
 
-void Sampler::processBuffer(std::unique_ptr<juce::AudioBuffer<float>>& buffer, juce::MidiBuffer& midiMessages, int i) {
-    auto currentSample = 0;
-    //std::unique_ptr<juce::AudioBuffer<float>> temp(new juce::AudioBuffer<float>{buffer->getNumChannels(), buffer->getNumSamples()});
-    for (const auto midiMessage : midiMessages) {
-        const auto midiEvent = midiMessage.getMessage();
-        const auto midiEventSample = static_cast<int>(midiEvent.getTimeStamp());
-        if(voices.size() >= 1) voices[i]->renderVoice(buffer, midiMessages, currentSample, midiEventSample);
-        currentSample = midiEventSample;
-        handleMidiEvent(midiEvent);
-    }
-    if(curSample[i] >= sampleLength) {
-        juce::MidiMessage noteOff = juce::MidiMessage::noteOff(1, voices[i]->getPitch(), juce::uint8(0));
-        midiMessages.addEvent(noteOff, 1);
-        curSample[i] = 0;
-        if(loop) {
-            juce::MidiMessage noteOn = juce::MidiMessage::noteOn(1, voices[i]->getPitch(), lastVel[i]);
-            midiMessages.addEvent(noteOn, 2);
-        }
-        else {
-            curPitch[i] = -1;
-        }
-    }
-    voices[i]->renderVoice(buffer, midiMessages, currentSample, buffer->getNumSamples());
-    processDist(buffer, i);
-    voices[i]->processFilter(buffer);
-    curSample[i] += buffer->getNumSamples();
-}
-
-void Sampler::handleMidiEvent(const juce::MidiMessage& midiEvent) {
-    if(midiEvent.isNoteOn()) {
-        const auto note = midiEvent.getNoteNumber();
-        int vel = midiEvent.getVelocity();
-        for(int i=0; i<voices.size(); i++) {
-            if(voices[i]->getPitch() == note && !voices[i]->isRelease()) {
-                return;
-            }
-        }
-        std::unique_ptr<SamplerVoice> v = std::make_unique<SamplerVoice>(note, vel);
-        v->prepareToPlay(spec);
-        v->addSound(formatReader);
-        v->setADSR(envParams, ADSRDepth);
-        v->setEnvRouting(envToVol, envToDist, envToFilter);
-        v->setFilter(type, curCutoff, curRes, keytrack, keytrackAmount);
-        v->setLoop(loop);
-        v->setPitchOffset(pitch);
-        v->setRepitch(repitch);
-        v->noteOn();
-        voices.push_back(std::move(v));
-        if(voices.size() > 8) {
-            voices.erase(voices.begin());
-        }
-        lastVel[voices.size()] = vel;
-    }
-    if(midiEvent.isNoteOff()) {
-        const auto note = midiEvent.getNoteNumber();
-        for(int i=0; i<voices.size(); i++) {
-            if(voices[i]->getPitch() == note && !voices[i]->isRelease()) {
-                voices[i]->noteOff();
-                lastVel[i] = 0;
-            }
-        }
+void Sampler::loadBuffer(const juce::AudioBuffer<float>& buffer, double bufferSampleRate) {
+    const int len = buffer.getNumSamples();
+    waveform.setSize(1, len);
+    waveform.copyFrom(0, 0, buffer, 0, 0, len);
+    sampleLength = len;
+    waveformSampleRate = bufferSampleRate;
+    sampleLoaded = true;
+}
+
+void Sampler::startVoice(SamplerVoice& voice, int note, int vel) {
+    voice.start(note, vel);
+    voice.setSound(&waveform, waveformSampleRate);
+    updateVoice(voice);
+    voice.noteOn();
+}
+
+void Sampler::updateVoice(SamplerVoice& voice) {
+    voice.setADSR(envParams, ADSRDepth);
+    voice.setEnvRouting(envToVol, envToDist, envToFilter);
+    voice.setFilter(type, curCutoff, curRes, keytrack, keytrackAmount);
+    voice.setLoop(loop);
+    voice.setPitchOffset(pitch);
+    voice.setRepitch(repitch);
+    voice.setInterpolation(interpolation);
+}
+
+/// startSample is where the note begins in this block (0 if it was already playing), releaseSample is where its note-off lands (-1 if none)
+void Sampler::processBuffer(SamplerVoice& voice, juce::AudioBuffer<float>& buffer, int startSample, int releaseSample) {
+    if(!voice.isActive()) return;
+    updateVoice(voice);
+    
+    /// Once the selected length has played, start over from the top when looping, otherwise release the note
+    if(voice.getPlayedSamples() >= sampleLength) {
+        if(loop) voice.retrigger();
+        else if(!voice.isRelease()) voice.noteOff();
     }
-    if(midiEvent.isAllNotesOff()) {
-        for (int i=0; i<voices.size(); i++) {
-            voices[i]->noteOff();
-        }
+    
+    /// One control-rate segment at a time, like Synth::renderSegments()
+    Distortion voiceDist = dist;
+    const int numSamples = buffer.getNumSamples();
+    for(int sample = startSample; sample < numSamples && voice.isActive();) {
+        if(sample == releaseSample && !voice.isRelease()) voice.noteOff();
+        const int limit = releaseSample > sample ? releaseSample : numSamples;
+        const int segment = voice.beginSegment(limit - sample);
+        voice.renderVoice(buffer, sample, sample + segment);
+        processDist(voice, voiceDist, buffer, sample, segment);
+        voice.processFilter(buffer, sample, sample + segment);
+        sample += segment;
     }
+    if(releaseSample >= startSample && !voice.isRelease()) voice.noteOff();
 }
 
-void Sampler::deleteVoice(int i) {
-    if(voices.size() == 0) return;
-    int note = voices[i]->getPitch();
-    if(i+1>voices.size()) return;
-    voices.erase(voices.begin()+i);
-    curPitch[i] = -1;
-    enabled[note] = 0;
-    curSample[i] = 0;
+/// For a muted sampler, keeps the voice's note-off, loop, playback position and envelope where processBuffer() would have left them
+void Sampler::skipBuffer(SamplerVoice& voice, int numSamples, int startSample, int releaseSample) {
+    if(!voice.isActive()) return;
+    updateVoice(voice);
+    if(voice.getPlayedSamples() >= sampleLength) {
+        if(loop) voice.retrigger();
+        else if(!voice.isRelease()) voice.noteOff();
+    }
+    if(releaseSample >= startSample) {
+        voice.skip(startSample, releaseSample);
+        if(!voice.isRelease()) voice.noteOff();
+        startSample = releaseSample;
+    }
+    voice.skip(startSample, numSamples);
 }
 
-void Sampler::processDist(std::unique_ptr<juce::AudioBuffer<float>>& buffer, float envSample) {
+/// voiceDist is the block's copy of dist, the envelope changes the input gain per voice and voices may render on different threads
+void Sampler::processDist(SamplerVoice& voice, Distortion& voiceDist, juce::AudioBuffer<float>& buffer, int startSample, int numSamples) {
     if(distType == 1) return;
     if(envToDist) {
-        dist.setEnv(envSample, ADSRDepth);
+        voiceDist.setEnv(voice.returnEnvSample(), ADSRDepth);
     }
-    if(distType == 2) dist.processBufferWaveshaper(*buffer, bezier);
-    else dist.processBuffer(*buffer);
+    juce::AudioBuffer<float> segment(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), startSample, numSamples);
+    if(distType == 2) voiceDist.processBufferWaveshaper(segment, bezier);
+    else voiceDist.processBuffer(segment);
 }
 
 void Sampler::setFilter(int type, float cutoff, float res, bool key, float ktA) {
@@ -185,17 +162,10 @@ void Sampler::setFilter(int type, float cutoff, float res, bool key, float ktA)
     curRes = res;
     keytrack = key;
     keytrackAmount = ktA;
-    for(int i=0; i<voices.size(); i++) {
-        voices[i]->setFilter(type, cutoff, res, key, ktA);
-    }
 }
 
 void Sampler::setLoop(bool isLoop) {
-    if(loop == isLoop) return;
     loop = isLoop;
-    for(int i=0; i<voices.size(); i++) {
-        voices[i]->setLoop(loop);
-    }
 }
 
 void Sampler::setADSR(float atk, float dec, float sus, float rel, float depth) {
@@ -18,48 +18,45 @@
 
 namespace Colin {
 
+/// Like Synth, the Sampler only holds the source settings and the loaded waveform, the SamplerVoices live in the VoiceManager
+
 class Sampler {
 public:
     Sampler();
     ~Sampler();
     void loadFile();
+    void loadFile(const juce::File& file); /// no chooser, for the offline renderer
+    void loadBuffer(const juce::AudioBuffer<float>& buffer, double bufferSampleRate); /// first channel only, like loadFile
     void setPitch(float p, bool re);
     void prepareToPlay(juce::dsp::ProcessSpec spec);
     void setFilter(int type, float cutoff, float res, bool key, float ktA);
     void setDistortion(int type, float input, float output, float coeff, float mix, AuxPort::Bezier* b);
     void setADSR(float atk, float dec, float sus, float rel, float depth);
-    void setEnvRouting(bool filt, bool vol, bool dist);
+    void setEnvRouting(bool vol, bool dist, bool filt);
     bool isSampleLoaded();
-    void setNoteOff(int note);
-    void processBuffers(std::vector<juce::AudioBuffer<float>*>& buffers, juce::MidiBuffer& midiMessages);
-    void processBuffer(std::unique_ptr<juce::AudioBuffer<float>>& buffer, juce::MidiBuffer& midiMessages, int i);
-    juce::MidiBuffer repitchMessages(juce::MidiBuffer& midiMessages);
-    juce::MidiBuffer sortMessages(juce::MidiBuffer& midiMessages, int voice);
+    void startVoice(SamplerVoice& voice, int note, int vel);
+    void processBuffer(SamplerVoice& voice, juce::AudioBuffer<float>& buffer, int startSample, int releaseSample);
+    void skipBuffer(SamplerVoice& voice, int numSamples, int startSample, int releaseSample);
     juce::AudioBuffer<float>& getWaveform() { return waveform; }
-    const static int NUM_VOICES { 8 };
-    int enabled [128] = {0};
-    int curPitch [NUM_VOICES] = {-1, -1, -1, -1, -1, -1, -1, -1};
     Distortion dist;
     void setLoop(bool isLoop);
     int sampleLength = 0;
     void setSampleLength(float newLenPercent);
-    void deleteVoice(int i);
+    void setInterpolation(Interpolation quality) { interpolation = quality; }
     
 private:
     bool sampleLoaded = false;
-    void processDist(std::unique_ptr<juce::AudioBuffer<float>>& buffer, float envSample);
-    void processFilters(std::unique_ptr<juce::AudioBuffer<float>>& buffer, int i);
-    void handleMidiEvent(const juce::MidiMessage& midiEvent);
+    void updateVoice(SamplerVoice& voice);
+    void processDist(SamplerVoice& voice, Distortion& voiceDist, juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
 
     juce::dsp::ProcessSpec spec;
-    std::vector<std::unique_ptr<SamplerVoice>> voices;
 
     std::unique_ptr<juce::AudioFormatReader> formatReader;
     
     float midiToFreq(int midiNote);
-    std::vector<juce::Synthesiser*> jucesamplers;
     juce::AudioFormatManager formatManager;
     double sampleRate = 44100;
+    double waveformSampleRate = 44100;
     int pitch = 0;
     juce::AudioBuffer<float> waveform;
     juce::ADSR::Parameters envParams;
@@ -76,10 +73,8 @@ private:
     bool envToVol = false;
     bool envToDist = false;
     bool loop = false;
-    int nextVoice = 0;
     bool repitch = true;
-    juce::uint8 lastVel[NUM_VOICES] = {0};
-    int curSample[NUM_VOICES] = {0};
+    Interpolation interpolation = Interpolation::linear;
     AuxPort::Bezier* bezier;
 };
 
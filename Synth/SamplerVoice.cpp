@@ -12,18 +12,6 @@
 
 namespace Colin {
 
-SamplerVoice::SamplerVoice(int pitch, int vel) {
-    this->pitch = pitch;
-    this->vel = vel;
-    sample = new juce::AudioBuffer<float>();
-    ladder = new juce::dsp::LadderFilter<float>();
-}
-
-SamplerVoice::~SamplerVoice() {
-    delete ladder;
-    delete sample;
-}
-
 void SamplerVoice::prepareToPlay(juce::dsp::ProcessSpec spec)
 {
     sampleRate = spec.sampleRate;
@@ -33,22 +21,38 @@ void SamplerVoice::prepareToPlay(juce::dsp::ProcessSpec spec)
     TPT.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
     TPT.setCutoffFrequency(curCutoff);
     TPT.setCutoffFrequency(curRes);
-    ladder->reset();
-    ladder->prepare(spec);
-    ladder->setMode(juce::dsp::LadderFilterMode::LPF12);
-    ladder->setCutoffFrequencyHz(curCutoff);
-    ladder->setResonance(curRes);
-    ladder->setDrive(3.f);
+    ladder.reset();
+    ladder.prepare(spec);
+    ladder.setMode(juce::dsp::LadderFilterMode::LPF12);
+    ladder.setCutoffFrequencyHz(curCutoff);
+    ladder.setResonance(curRes);
+    ladder.setDrive(3.f);
+}
+
+void SamplerVoice::start(int pitch, int vel) {
+    this->pitch = pitch;
+    this->vel = vel;
+    active = true;
+    release = false;
+    index = 0.f;
+    curSample = 0;
+    envSampleStart = 0.f;
+    envSampleEnd = 0.f;
+    controlClock.reset();
+    controlEnv = 0.f;
+    env.reset();
+    TPT.reset();
+    ladder.reset();
 }
 
-void SamplerVoice::addSound(std::unique_ptr<juce::AudioFormatReader>& formatReader) {
-    sample->setSize(2, formatReader->lengthInSamples);
-    formatReader->read(sample, 0, formatReader->lengthInSamples, 0, true, true);
-    sampleSampleRate = formatReader->sampleRate;
-    setFrequency(midiToFreq(pitch + pitchOffset));
+/// The voice only keeps a pointer to the Sampler's waveform, nothing is read or copied on note-on
+void SamplerVoice::setSound(const juce::AudioBuffer<float>* waveform, double waveformSampleRate) {
+    sample = waveform;
+    sampleSampleRate = waveformSampleRate;
+    updateFrequency();
 }
 
-void SamplerVoice::renderVoice(std::unique_ptr<juce::AudioBuffer<float>>& buffer, juce::MidiBuffer& midiMessages, int startSample, int endSample) {
+void SamplerVoice::renderVoice(juce::AudioBuffer<float>& buffer, int startSample, int endSample) {
     if(!active) return;
         
     if(!env.isActive()) {
@@ -58,22 +62,42 @@ void SamplerVoice::renderVoice(std::unique_ptr<juce::AudioBuffer<float>>& buffer
         }
     }
     
-    getEnvSamples(buffer->getNumSamples());
+    getEnvSamples(endSample - startSample);
     
-    auto* firstChannel = buffer->getWritePointer(0);
+    auto* firstChannel = buffer.getWritePointer(0);
 
     for (auto sample = startSample; sample < endSample; sample++) {
         firstChannel[sample] += getSample() * normVelocity(vel);
     }
-    for (auto channel = 1; channel < buffer->getNumChannels(); channel++) {
-        std::copy(firstChannel + startSample, firstChannel + endSample, buffer->getWritePointer(channel) + startSample);
+    for (auto channel = 1; channel < buffer.getNumChannels(); channel++) {
+        std::copy(firstChannel + startSample, firstChannel + endSample, buffer.getWritePointer(channel) + startSample);
     }
+    curSample += endSample - startSample;
     
     if(envToVol) {
-        buffer->applyGainRamp(0, buffer->getNumSamples(), envSampleStart, envSampleEnd);
+        buffer.applyGainRamp(startSample, endSample - startSample, envSampleStart, envSampleEnd);
     }
 }
 
+/// Same as Voice::skip(), moves the playback position and envelope on without reading the sample
+void SamplerVoice::skip(int startSample, int endSample) {
+    if(!active) return;
+    if(!env.isActive() && envToVol) {
+        active = false;
+        return;
+    }
+    const int numSamples = endSample - startSample;
+    env.skip(numSamples);
+    controlClock.skip(numSamples);
+    controlEnv = env.getValue();
+    index += indexIncrement * static_cast<float>(numSamples);
+    if(static_cast<int>(index + 2) > sample->getNumSamples() && loop == false) active = false;
+    else index = std::fmod(index, static_cast<float>(sample->getNumSamples()));
+    curSample += numSamples;
+    TPT.reset();
+    ladder.reset();
+}
+
 void SamplerVoice::setFilter(int type, float cutoff, float res, bool key, float ktA) {
     keytrack = key;
     keytrackAmount = (ktA + 1) / 100;
@@ -94,24 +118,27 @@ void SamplerVoice::setFilter(int type, float cutoff, float res, bool key, float
             if(type == 5) t = juce::dsp::LadderFilterMode::LPF24;
             else if(type == 6) t = juce::dsp::LadderFilterMode::HPF12;
             else if(type == 7) t = juce::dsp::LadderFilterMode::HPF24;
-            ladder->setMode(t);
+            ladder.setMode(t);
         }
     }
     if(cutoff != curCutoff) {
         curCutoff = cutoff;
         TPT.setCutoffFrequency(cutoff);
-        ladder->setCutoffFrequencyHz(cutoff);
+        ladder.setCutoffFrequencyHz(cutoff);
     }
     if(res != curRes) {
         curRes = res;
         TPT.setResonance(res);
-        ladder->setResonance(res);
+        ladder.setResonance(res);
     }
 }
 
 void SamplerVoice::setADSR(juce::ADSR::Parameters envParams, float depth) {
-    env.setParameters(envParams);
     ADSRDepth = depth;
+    const auto& cur = env.getParameters();
+    if(envParams.attack == cur.attack && envParams.decay == cur.decay && envParams.sustain == cur.sustain && envParams.release == cur.release)
+        return;
+    env.setParameters(envParams);
 }
 
 float SamplerVoice::midiToFreq(int midiNote)
@@ -122,23 +149,26 @@ float SamplerVoice::midiToFreq(int midiNote)
     return A4_FREQ * std::powf(2, (static_cast<float>(midiNote) - A4_MIDINOTE) / NOTES_IN_OCTAVE);
 }
 
-void SamplerVoice::processFilter(std::unique_ptr<juce::AudioBuffer<float>>& buffer) {
+/// Same as Voice::processFilter(), one segment at a time
+void SamplerVoice::processFilter(juce::AudioBuffer<float>& buffer, int startSample, int endSample) {
     if(!active) return;
-    float cutoff = curCutoff;
-    if(keytrack) {
-        float newcutoff = midiToFreq(pitch) * keytrackAmount + curCutoff;
-        cutoff = newcutoff < 20000 ? newcutoff : 20000;
-        ladder->setCutoffFrequencyHz(cutoff);
-        TPT.setCutoffFrequency(cutoff);
-    }
-    if(envToFilter) {
-        ladder->setCutoffFrequencyHz((cutoff * (1-ADSRDepth)) + (cutoff * envSampleStart * ADSRDepth));
-        TPT.setCutoffFrequency((cutoff * (1-ADSRDepth)) + (cutoff * envSampleStart * ADSRDepth));
+    if(controlClock.isControlPoint()) {
+        float cutoff = curCutoff;
+        if(keytrack) {
+            float newcutoff = midiToFreq(pitch) * keytrackAmount + curCutoff;
+            cutoff = newcutoff < 20000 ? newcutoff : 20000;
+            ladder.setCutoffFrequencyHz(cutoff);
+            TPT.setCutoffFrequency(cutoff);
+        }
+        if(envToFilter) {
+            ladder.setCutoffFrequencyHz((cutoff * (1-ADSRDepth)) + (cutoff * controlEnv * ADSRDepth));
+            TPT.setCutoffFrequency((cutoff * (1-ADSRDepth)) + (cutoff * controlEnv * ADSRDepth));
+        }
     }
-    juce::dsp::AudioBlock<float> block(*buffer);
+    auto block = juce::dsp::AudioBlock<float>(buffer).getSubBlock(static_cast<size_t>(startSample), static_cast<size_t>(endSample - startSample));
     auto pc = juce::dsp::ProcessContextReplacing<float>(block);
     if(filterType <= 3) TPT.process(pc);
-    else ladder->process(pc);
+    else ladder.process(pc);
 }
 
 void SamplerVoice::setEnvRouting(bool v, bool d, bool f) {
@@ -147,16 +177,26 @@ void SamplerVoice::setEnvRouting(bool v, bool d, bool f) {
     envToDist = d;
 }
 
+/// Advances the envelope exactly numSamples, like Envelope::skip(), keeping the first and last values for the gain
+/// ramp. A 1 sample segment ramps from a value to itself
 void SamplerVoice::getEnvSamples(int numSamples) {
+    if(numSamples <= 0) return;
     envSampleStart = env.getNextSample();
-    for(int j=0; j<numSamples-2; j++) {
-        env.getNextSample();
+    envSampleEnd = envSampleStart;
+    for(int j=1; j<numSamples; j++) {
+        envSampleEnd = env.getNextSample();
     }
-    envSampleEnd = env.getNextSample();
+}
+
+/// Starts the next control-rate segment, at most maxSamples long, and reads the envelope if it's on the grid
+int SamplerVoice::beginSegment(int maxSamples) {
+    const int numSamples = controlClock.next(maxSamples);
+    if(controlClock.isControlPoint()) controlEnv = env.getValue();
+    return numSamples;
 }
 
 float SamplerVoice::returnEnvSample() {
-    return envSampleStart;
+    return controlEnv;
 }
 
 void SamplerVoice::noteOn() {
@@ -168,6 +208,18 @@ void SamplerVoice::noteOff() {
     release = true;
 }
 
+/// Restarts playback from the top of the sample when looping, the envelope attacks again from its current level
+void SamplerVoice::retrigger() {
+    index = 0.f;
+    curSample = 0;
+    release = false;
+    env.noteOn();
+}
+
+bool SamplerVoice::isActive() {
+    return active;
+}
+
 bool SamplerVoice::isRelease() {
     return release;
 }
@@ -176,10 +228,14 @@ int SamplerVoice::getPitch() {
     return pitch;
 }
 
+int SamplerVoice::getPlayedSamples() {
+    return curSample;
+}
+
 void SamplerVoice::setPitchOffset(int offset) {
     if(pitchOffset == offset) return;
     pitchOffset = offset;
-    setFrequency(midiToFreq(pitch + pitchOffset));
+    updateFrequency();
 }
 
 void SamplerVoice::setLoop(bool isLoop) {
@@ -194,12 +250,23 @@ void SamplerVoice::setFrequency(float frequency) {
     indexIncrement = (frequency / 440.0) * sampleSampleRate / static_cast<float>(sampleRate);
 }
 
-float SamplerVoice::interpolateLinearly() {
-    const auto truncatedIndex = static_cast<int>(index) % sample->getNumSamples();
-    const auto nextIndex = (truncatedIndex + 1) % sample->getNumSamples();
-    const auto nextIndexWeight = index - static_cast<float>(truncatedIndex);
-    const auto truncatedIndexWeight = 1.f - nextIndexWeight;
-    return truncatedIndexWeight * sample->getSample(0,truncatedIndex) + nextIndexWeight * sample->getSample(0,nextIndex);
+void SamplerVoice::updateFrequency() {
+    // middle C = 60 when the sample isn't repitched
+    if(repitch) setFrequency(midiToFreq(pitch + pitchOffset));
+    else setFrequency(midiToFreq(60 + pitchOffset));
+}
+
+/// Taps past either end of the sample wrap round to the other, as the next sample always has
+float SamplerVoice::interpolate() {
+    const float* data = sample->getReadPointer(0);
+    const int length = sample->getNumSamples();
+    const auto truncatedIndex = static_cast<int>(index) % length;
+    const auto fraction = index - static_cast<float>(truncatedIndex);
+    if(truncatedIndex >= Interpolator::TAPS_BEFORE && truncatedIndex + Interpolator::TAPS_AFTER < length)
+        return Interpolator::read(interpolation, [data, truncatedIndex](int k) { return data[truncatedIndex + k]; }, fraction);
+    return Interpolator::read(interpolation, [data, length, truncatedIndex](int k) {
+        return data[((truncatedIndex + k) % length + length) % length];
+    }, fraction);
 }
 
 float SamplerVoice::getSample() {
@@ -207,18 +274,16 @@ float SamplerVoice::getSample() {
         active = false;
         return 0.f;
     }
-    auto newSample = interpolateLinearly();
+    auto newSample = interpolate();
     index += indexIncrement;
     index = std::fmod(index, static_cast<float>(sample->getNumSamples()));
     return newSample;
 }
 
 void SamplerVoice::setRepitch(bool shouldRepitch) {
+    if(repitch == shouldRepitch) return;
     repitch = shouldRepitch;
-    if(!repitch) {
-        // middle C = 60
-        setFrequency(midiToFreq(60+pitchOffset));
-    }
+    updateFrequency();
 }
 
 }
@@ -2,6 +2,9 @@
 #define Colin_SamplerVoice_H
 
 #include <JuceHeader.h>
+#include "Envelope.h"
+#include "ControlRate.h"
+#include "Interpolation.h"
 
 /*
   ==============================================================================
@@ -16,57 +19,69 @@
 namespace Colin
 {
 
+/// Owned by a GlobalVoice and reused between notes, the sample data itself is shared with the Sampler
+
 class SamplerVoice {
 public:
-    SamplerVoice(int pitch, int vel);
-    ~SamplerVoice();
+    SamplerVoice() = default;
+    ~SamplerVoice() = default;
     void prepareToPlay(juce::dsp::ProcessSpec spec);
-    void renderVoice(std::unique_ptr<juce::AudioBuffer<float>>& buffer, juce::MidiBuffer& midiMessages, int startSample, int endSample);
+    void start(int pitch, int vel);
+    void renderVoice(juce::AudioBuffer<float>& buffer, int startSample, int endSample);
+    void skip(int startSample, int endSample);
     void setFilter(int type, float cutoff, float res, bool key, float ktA);
     void setEnvRouting(bool v, bool d, bool f);
-    void processFilter(std::unique_ptr<juce::AudioBuffer<float>>& buffer);
+    int beginSegment(int maxSamples);
+    void processFilter(juce::AudioBuffer<float>& buffer, int startSample, int endSample);
     void setADSR(juce::ADSR::Parameters envParams, float depth);
     void noteOn();
     void noteOff();
+    void retrigger();
+    bool isActive();
     bool isRelease();
     int getPitch();
+    int getPlayedSamples();
     void setPitchOffset(int offset);
     void getEnvSamples(int numSamples);
-    void addSound(std::unique_ptr<juce::AudioFormatReader>& formatReader);
+    void setSound(const juce::AudioBuffer<float>* waveform, double waveformSampleRate);
     void setLoop(bool isLoop);
     float returnEnvSample();
     void setRepitch(bool shouldRepitch);
+    void setInterpolation(Interpolation quality) { interpolation = quality; }
     
 private:
     float midiToFreq(int midiNote);
     float normVelocity(int vel);
     void setFrequency(float frequency);
-    float interpolateLinearly();
+    void updateFrequency();
+    float interpolate();
     float getSample();
     
-    juce::AudioBuffer<float>* sample;
+    const juce::AudioBuffer<float>* sample = nullptr;
     float index = 0.f;
     float prevSample = 0.f;
     float indexIncrement = 0.f;
+    Interpolation interpolation = Interpolation::linear;
     
-    float sampleRate;
-    float sampleSampleRate;
-    int pitch;
+    float sampleRate = 44100;
+    float sampleSampleRate = 44100;
+    int pitch = 0;
     int pitchOffset = 0;
     bool repitch = true;
-    int vel;
-    bool active = true;
+    int vel = 0;
+    bool active = false;
     bool noise = false;
     bool release = false;
     bool cycleEnv = false;
     float envSampleStart = 0.f;
     float envSampleEnd = 0.f;
+    ControlClock controlClock;
+    float controlEnv = 0.f; /// the envelope at the last control point, drives the filter cutoff and distortion
     bool loop = false;
-    int curSample;
-    int sampleLength;
+    int curSample = 0;
     
     juce::dsp::StateVariableTPTFilter<float> TPT;
-    juce::dsp::LadderFilter<float>* ladder;
+    juce::dsp::LadderFilter<float> ladder;
     float filterType = 1;
     int curTPTMode = 1;
     int curLadderMode = 1;
@@ -79,7 +94,7 @@ private:
     bool envToVol = false;
     bool envToDist = false;
     
-    juce::ADSR env;
+    Envelope env;
     float ADSRDepth = 0.f;
 };
 
@@ -0,0 +1,196 @@
+#ifndef Colin_SimdLanes_H
+#define Colin_SimdLanes_H
+
+#include <cstdint>
+#include <cstring>
+
+/*
+  ==============================================================================
+
+    SimdLanes.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+#if defined(__AVX2__)
+ #define CAPSTONE_SIMD_WIDTH 8
+ #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || defined(__ARM_NEON) || defined(__ARM_NEON__)
+ #define CAPSTONE_SIMD_WIDTH 4
+ #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+  #include <arm_neon.h>
+ #else
+  #include <emmintrin.h>
+ #endif
+#else
+ #define CAPSTONE_SIMD_WIDTH 1
+#endif
+
+/// Shared by the OscillatorBank (one lane per voice) and Unison (one lane per detuned copy of a voice), so both read
+/// the tables with the same arithmetic as WavetableOscillator, and by NoiseGenerator (one generator per lane)
+namespace Colin
+{
+namespace Lanes
+{
+
+constexpr int WIDTH = CAPSTONE_SIMD_WIDTH;
+
+/// The handful of lane operations the oscillator kernels need, for each instruction set. Floats has + - * and a
+/// broadcasting constructor, so the Interpolator kernels run on it unchanged. Gathers are real on AVX2 and loads into
+/// a register elsewhere
+
+#if CAPSTONE_SIMD_WIDTH == 8
+
+struct Floats {
+    Floats() = default;
+    Floats(__m256 x) : v(x) {}
+    Floats(float x) : v(_mm256_set1_ps(x)) {}
+    __m256 v;
+};
+struct Ints {
+    Ints() = default;
+    Ints(__m256i x) : v(x) {}
+    __m256i v;
+};
+inline Floats operator+(Floats a, Floats b) { return _mm256_add_ps(a.v, b.v); }
+inline Floats operator-(Floats a, Floats b) { return _mm256_sub_ps(a.v, b.v); }
+inline Floats operator*(Floats a, Floats b) { return _mm256_mul_ps(a.v, b.v); }
+template <typename T> inline Ints loadInts(const T* p) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(p)); }
+template <typename T> inline void storeInts(T* p, Ints x) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), x.v); }
+inline Floats loadFloats(const float* p) { return _mm256_load_ps(p); }
+inline void storeFloats(float* p, Floats x) { _mm256_store_ps(p, x.v); }
+inline Ints add(Ints a, Ints b) { return _mm256_add_epi32(a.v, b.v); }
+inline Ints mask(Ints a, Ints b) { return _mm256_and_si256(a.v, b.v); }
+inline Ints startedBy(int t, Ints start) { return _mm256_cmpgt_epi32(_mm256_set1_epi32(t + 1), start.v); }
+template <int bits> inline Ints shiftRight(Ints a) { return _mm256_srli_epi32(a.v, bits); }
+template <int bits> inline Ints shiftLeft(Ints a) { return _mm256_slli_epi32(a.v, bits); }
+inline Ints truncate(Floats a) { return _mm256_cvttps_epi32(a.v); }
+inline Floats toFloats(Ints a) { return _mm256_cvtepi32_ps(a.v); }
+inline Ints broadcast(std::uint32_t x) { return _mm256_set1_epi32(static_cast<int>(x)); }
+inline Floats gather(const float* base, Ints index) { return _mm256_i32gather_ps(base, index.v, 4); }
+inline Ints bitOr(Ints a, Ints b) { return _mm256_or_si256(a.v, b.v); }
+inline Ints bitXor(Ints a, Ints b) { return _mm256_xor_si256(a.v, b.v); }
+inline Floats asFloats(Ints a) { return _mm256_castsi256_ps(a.v); }
+inline void storeUnaligned(float* p, Floats x) { _mm256_storeu_ps(p, x.v); }
+inline void storeUnaligned(std::uint32_t* p, Ints x) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x.v); }
+
+#elif CAPSTONE_SIMD_WIDTH == 4 && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+
+struct Floats {
+    Floats() = default;
+    Floats(float32x4_t x) : v(x) {}
+    Floats(float x) : v(vdupq_n_f32(x)) {}
+    float32x4_t v;
+};
+struct Ints {
+    Ints() = default;
+    Ints(uint32x4_t x) : v(x) {}
+    uint32x4_t v;
+};
+inline Floats operator+(Floats a, Floats b) { return vaddq_f32(a.v, b.v); }
+inline Floats operator-(Floats a, Floats b) { return vsubq_f32(a.v, b.v); }
+inline Floats operator*(Floats a, Floats b) { return vmulq_f32(a.v, b.v); }
+template <typename T> inline Ints loadInts(const T* p) { return vld1q_u32(reinterpret_cast<const std::uint32_t*>(p)); }
+template <typename T> inline void storeInts(T* p, Ints x) { vst1q_u32(reinterpret_cast<std::uint32_t*>(p), x.v); }
+inline Floats loadFloats(const float* p) { return vld1q_f32(p); }
+inline void storeFloats(float* p, Floats x) { vst1q_f32(p, x.v); }
+inline Ints add(Ints a, Ints b) { return vaddq_u32(a.v, b.v); }
+inline Ints mask(Ints a, Ints b) { return vandq_u32(a.v, b.v); }
+inline Ints startedBy(int t, Ints start) { return vcgeq_s32(vdupq_n_s32(t), vreinterpretq_s32_u32(start.v)); }
+template <int bits> inline Ints shiftRight(Ints a) { return vshrq_n_u32(a.v, bits); }
+template <int bits> inline Ints shiftLeft(Ints a) { return vshlq_n_u32(a.v, bits); }
+inline Ints truncate(Floats a) { return vreinterpretq_u32_s32(vcvtq_s32_f32(a.v)); }
+inline Floats toFloats(Ints a) { return vcvtq_f32_s32(vreinterpretq_s32_u32(a.v)); }
+inline Ints broadcast(std::uint32_t x) { return vdupq_n_u32(x); }
+inline Floats gather(const float* base, Ints index) {
+    alignas(16) std::int32_t i[4];
+    vst1q_s32(i, vreinterpretq_s32_u32(index.v));
+    alignas(16) const float x[4] = { base[i[0]], base[i[1]], base[i[2]], base[i[3]] };
+    return vld1q_f32(x);
+}
+inline Ints bitOr(Ints a, Ints b) { return vorrq_u32(a.v, b.v); }
+inline Ints bitXor(Ints a, Ints b) { return veorq_u32(a.v, b.v); }
+inline Floats asFloats(Ints a) { return vreinterpretq_f32_u32(a.v); }
+inline void storeUnaligned(float* p, Floats x) { vst1q_f32(p, x.v); }
+inline void storeUnaligned(std::uint32_t* p, Ints x) { vst1q_u32(p, x.v); }
+
+#elif CAPSTONE_SIMD_WIDTH == 4
+
+struct Floats {
+    Floats() = default;
+    Floats(__m128 x) : v(x) {}
+    Floats(float x) : v(_mm_set1_ps(x)) {}
+    __m128 v;
+};
+struct Ints {
+    Ints() = default;
+    Ints(__m128i x) : v(x) {}
+    __m128i v;
+};
+inline Floats operator+(Floats a, Floats b) { return _mm_add_ps(a.v, b.v); }
+inline Floats operator-(Floats a, Floats b) { return _mm_sub_ps(a.v, b.v); }
+inline Floats operator*(Floats a, Floats b) { return _mm_mul_ps(a.v, b.v); }
+template <typename T> inline Ints loadInts(const T* p) { return _mm_load_si128(reinterpret_cast<const __m128i*>(p)); }
+template <typename T> inline void storeInts(T* p, Ints x) { _mm_store_si128(reinterpret_cast<__m128i*>(p), x.v); }
+inline Floats loadFloats(const float* p) { return _mm_load_ps(p); }
+inline void storeFloats(float* p, Floats x) { _mm_store_ps(p, x.v); }
+inline Ints add(Ints a, Ints b) { return _mm_add_epi32(a.v, b.v); }
+inline Ints mask(Ints a, Ints b) { return _mm_and_si128(a.v, b.v); }
+inline Ints startedBy(int t, Ints start) { return _mm_cmpgt_epi32(_mm_set1_epi32(t + 1), start.v); }
+template <int bits> inline Ints shiftRight(Ints a) { return _mm_srli_epi32(a.v, bits); }
+template <int bits> inline Ints shiftLeft(Ints a) { return _mm_slli_epi32(a.v, bits); }
+inline Ints truncate(Floats a) { return _mm_cvttps_epi32(a.v); }
+inline Floats toFloats(Ints a) { return _mm_cvtepi32_ps(a.v); }
+inline Ints broadcast(std::uint32_t x) { return _mm_set1_epi32(static_cast<int>(x)); }
+inline Floats gather(const float* base, Ints index) {
+    alignas(16) std::int32_t i[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(i), index.v);
+    return _mm_setr_ps(base[i[0]], base[i[1]], base[i[2]], base[i[3]]);
+}
+inline Ints bitOr(Ints a, Ints b) { return _mm_or_si128(a.v, b.v); }
+inline Ints bitXor(Ints a, Ints b) { return _mm_xor_si128(a.v, b.v); }
+inline Floats asFloats(Ints a) { return _mm_castsi128_ps(a.v); }
+inline void storeUnaligned(float* p, Floats x) { _mm_storeu_ps(p, x.v); }
+inline void storeUnaligned(std::uint32_t* p, Ints x) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), x.v); }
+
+#else
+
+using Floats = float;
+using Ints = std::uint32_t;
+template <typename T> inline Ints loadInts(const T* p) { return static_cast<Ints>(*p); }
+template <typename T> inline void storeInts(T* p, Ints x) { *p = static_cast<T>(x); }
+inline Floats loadFloats(const float* p) { return *p; }
+inline void storeFloats(float* p, Floats x) { *p = x; }
+inline Ints add(Ints a, Ints b) { return a + b; }
+inline Ints mask(Ints a, Ints b) { return a & b; }
+inline Ints startedBy(int t, Ints start) { return t >= static_cast<int>(start) ? ~0u : 0u; }
+template <int bits> inline Ints shiftRight(Ints a) { return a >> bits; }
+template <int bits> inline Ints shiftLeft(Ints a) { return a << bits; }
+inline Ints truncate(Floats a) { return static_cast<Ints>(static_cast<int>(a)); }
+inline Floats toFloats(Ints a) { return static_cast<float>(static_cast<int>(a)); }
+inline Ints broadcast(std::uint32_t x) { return x; }
+inline Floats gather(const float* base, Ints index) { return base[static_cast<int>(index)]; }
+inline Ints bitOr(Ints a, Ints b) { return a | b; }
+inline Ints bitXor(Ints a, Ints b) { return a ^ b; }
+inline Floats asFloats(Ints a) { Floats x; std::memcpy(&x, &a, sizeof(x)); return x; }
+inline void storeUnaligned(float* p, Floats x) { *p = x; }
+inline void storeUnaligned(std::uint32_t* p, Ints x) { *p = x; }
+
+#endif
+
+/// Adds the lanes together, once per sample rather than once per lane
+inline float sum(Floats x) {
+    alignas(32) float lanes[WIDTH];
+    storeFloats(lanes, x);
+    float total = lanes[0];
+    for(int l = 1; l < WIDTH; l++) total += lanes[l];
+    return total;
+}
+
+template <int bits> inline Ints rotateLeft(Ints a) { return bitOr(shiftLeft<bits>(a), shiftRight<32 - bits>(a)); }
+
+}
+}
+
+#endif
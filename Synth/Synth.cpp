@@ -9,76 +9,65 @@
 */
 
 #include "Synth.h"
+#include "WavetableVectors.h"
 
 namespace Colin  {
 
-Synth::Synth() {}
-
-Synth::~Synth() {
-    voices.clear();
+Synth::Synth() {
+    wavetable = &wavetables->getMipmap(oscType);
 }
 
+Synth::~Synth() {}
+
 void Synth::prepareToPlay(juce::dsp::ProcessSpec s)
 {
-    voices.clear();
     spec = s;
     this->sampleRate = s.sampleRate;
     dist.setType(Distortion_Type::none);
     dist.setOutputGain(-3.f);
+    notesStarted = 0;
+    nextNoiseStream = 0;
+    wavetable = &wavetables->getMipmap(oscType);
+    bank.setWavetable(*wavetable);
+    sharedNoise.setSize(NOISE_STREAMS, static_cast<int>(s.maximumBlockSize));
+    sharedNoiseActive = false;
+    for(auto& generator : sharedGenerators) generator.prepare(s.sampleRate);
+    seedSharedNoise();
 }
 
-std::vector<float> Synth::getWavetable() {
-    if(oscType == Oscillator_Type::sine) {
-        return sineWavetable();
-    }
-    else if(oscType == Oscillator_Type::triangle) {
-        return triangleWavetable();
-    }
-    else if(oscType == Oscillator_Type::square) {
-        return squareWavetable();
-    }
-    else if(oscType == Oscillator_Type::saw) {
-        return sawWavetable();
-    }
-    else if(oscType == Oscillator_Type::fourtyFour) {
-        return fourtyFour();
-    }
-    else if(oscType == Oscillator_Type::echo) {
-        return echo();
-    }
-    else if(oscType == Oscillator_Type::juliett) {
-        return juliett();
-    }
-    else if(oscType == Oscillator_Type::crayon) {
-        return crayon();
-    }
-    else if(oscType == Oscillator_Type::gritty) {
-        return gritty();
-    }
+void Synth::seedSharedNoise() {
+    juce::Random random;
+    for(size_t s = 0; s < sharedGenerators.size(); s++)
+        sharedGenerators[s].seed(noiseSeed != 0 ? noiseSeed + 0x9e3779b97f4a7c15ull * (s + 1) : static_cast<std::uint64_t>(random.nextInt64()));
+}
+
+/// The noise source's voices don't depend on pitch, so in shared mode a few streams are rendered once per block and
+/// each voice only applies its velocity, envelope, distortion and filter to one of them. Voices fall back to their own
+/// generators if the host sends a block bigger than it said it would
+void Synth::renderSharedNoise(bool enabled, int numSamples) {
+    sharedNoiseActive = enabled && isNoise && numSamples <= sharedNoise.getNumSamples();
+    if(!sharedNoiseActive) return;
+    for(int s = 0; s < NOISE_STREAMS; s++)
+        sharedGenerators[static_cast<size_t>(s)].render(noiseType, sharedNoise.getWritePointer(s), numSamples);
 }
 
+const std::vector<float>& Synth::getWavetable() const {
+    return wavetables->getTable(oscType);
+}
+
+/// A stretch of the noise the voices play, from a fixed seed so the picture holds still between repaints
 std::vector<float> Synth::getNoise() {
-    if(noiseType == Noise_Type::gauss) {
-        return gauss();
-    }
-    else if(noiseType == Noise_Type::binary) {
-        return binary();
-    }
-    else if(noiseType == Noise_Type::lp) {
-        return lpNoise();
-    }
-    else if(noiseType == Noise_Type::hp) {
-        return hpNoise();
-    }
+    NoiseGenerator preview;
+    preview.seed(1);
+    std::vector<float> noise(WAVETABLE_LENGTH);
+    preview.render(noiseType, noise.data(), WAVETABLE_LENGTH);
+    return noise;
 }
 
 void Synth::setEnvRouting(bool v, bool d, bool f) {
     envToVol = v;
     envToDist = d;
     envToFilter = f;
-    for(int i=0; i<voices.size(); i++) {
-        voices[i]->setEnvRouting(v, d, f);
-    }
 }
 
 void Synth::setDistortion(int type, float input, float output, float coeff, float mix, AuxPort::Bezier* b) {
@@ -95,19 +84,35 @@ void Synth::setOscillator(int type) {
     if(!isNoise) {
         if(static_cast<Oscillator_Type>(type) == oscType) return;
         oscType = static_cast<Oscillator_Type>(type);
-        for(int i=0; i<voices.size(); i++) {
-            voices[i]->initializeOscillator(oscType);
-        }
+        wavetable = &wavetables->getMipmap(oscType);
+        bank.setWavetable(*wavetable);
     }
     else {
         if(static_cast<Noise_Type>(type) == noiseType) return;
         noiseType = static_cast<Noise_Type>(type);
-        for(int i=0; i<voices.size(); i++) {
-            voices[i]->initializeNoise(noiseType);
-        }
     }
 }
 
+void Synth::setInterpolation(Interpolation quality) {
+    interpolation = quality;
+    bank.setInterpolation(quality);
+}
+
+/// FM carriers keep playing the single oscillator, their modulator moves the phase per sample
+void Synth::setUnison(int voices, float detune, float spread) {
+    unisonVoices = voices;
+    unisonDetune = detune;
+    unisonSpread = spread;
+}
+
+/// A new seed starts counting notes again, so a render seeded the same way gets the same noise note for note
+void Synth::setNoiseSeed(std::uint64_t seed) {
+    if(seed == noiseSeed) return;
+    noiseSeed = seed;
+    notesStarted = 0;
+    seedSharedNoise();
+}
+
 void Synth::setNoise(bool isNoise) {
     this->isNoise = isNoise;
 }
@@ -121,11 +126,7 @@ void Synth::setKeytrack(bool key) {
 }
 
 void Synth::setPitch(float pitch) {
-    int p = static_cast<int>(std::roundf(pitch));
-    if(pitchOffset != p) {
-        pitchOffset = p;
-        updateFreqs();
-    }
+    pitchOffset = static_cast<int>(std::roundf(pitch));
 }
 
 void Synth::setFilter(int type, float cutoff, float res, bool key, float ktA) {
@@ -134,46 +135,92 @@ void Synth::setFilter(int type, float cutoff, float res, bool key, float ktA) {
     filterType = type;
     keytrack = key;
     keytrackAmount = ktA;
-    for(int i=0; i<voices.size(); i++) {
-        voices[i]->setFilter(type, cutoff, res, key, ktA);
+}
+
+void Synth::startVoice(Voice& voice, int note, int vel) {
+    voice.setNoise(isNoise);
+    if(noiseSeed != 0) voice.seed(noiseSeed + 0x9e3779b97f4a7c15ull * ++notesStarted);
+    voice.setNoiseStream(nextNoiseStream);
+    nextNoiseStream = (nextNoiseStream + 1) % NOISE_STREAMS;
+    voice.start(note, vel);
+    if(!isNoise) voice.initializeOscillator(oscType, *wavetable);
+    else voice.initializeNoise(noiseType);
+    updateVoice(voice);
+    voice.noteOn();
+}
+
+/// Voices only compare against their current settings, so calling this every block is cheap
+void Synth::updateVoice(Voice& voice) {
+    if(!isNoise) {
+        if(voice.getOscillatorType() != oscType) voice.initializeOscillator(oscType, *wavetable);
     }
+    else if(voice.getNoiseType() != noiseType) voice.initializeNoise(noiseType);
+    voice.setADSR(envParams, ADSRDepth);
+    voice.setEnvRouting(envToVol, envToDist, envToFilter);
+    voice.setFilter(filterType, curCutoff, curRes, keytrack, keytrackAmount);
+    voice.setPitch(pitchOffset);
+    voice.setInterpolation(interpolation);
+    voice.setUnison(unisonVoices, unisonDetune, unisonSpread);
 }
 
-void Synth::processBuffer(std::unique_ptr<juce::AudioBuffer<float>>& buffer, juce::MidiBuffer& midiMessages, int i)
+/// startSample is where the note begins in this block (0 if it was already playing), releaseSample is where its note-off lands (-1 if none)
+void Synth::processBuffer(Voice& voice, juce::AudioBuffer<float>& buffer, int startSample, int releaseSample)
 {
-    auto currentSample = 0;
-    for (const auto midiMessage : midiMessages) {
-        const auto midiEvent = midiMessage.getMessage();
-        const auto midiEventSample = static_cast<int>(midiEvent.getTimeStamp());
-        if(voices.size() >= 1) voices[i]->renderVoice(buffer, currentSample, midiEventSample);
-        currentSample = midiEventSample;
-        handleMidiEvent(midiEvent);
-    }
-    voices[i]->renderVoice(buffer, currentSample, buffer->getNumSamples());
-    buffer->applyGain(oscVol);
-    processDist(buffer, i);
-    voices[i]->processFilter(buffer);
+    updateVoice(voice);
+    voice.setSharedNoise(sharedNoiseActive ? sharedNoise.getReadPointer(voice.getNoiseStream()) : nullptr);
+    renderSegments(voice, buffer, nullptr, startSample, releaseSample);
+    voice.setPrerendered(false);
 }
 
-void Synth::processBufferFM(std::unique_ptr<juce::AudioBuffer<float>>& carrierBuffer, std::unique_ptr<juce::AudioBuffer<float>>& modBuffer, juce::MidiBuffer& midiMessages, int i)
+/// Queues the voice's oscillator for renderOscillatorBank(), processBuffer() then skips the table reads for it.
+/// Only for voices that go through processBuffer() this block, FM carriers read their modulator per sample. Voices with a
+/// unison stack render it themselves, it already runs its copies as SIMD lanes
+void Synth::addToOscillatorBank(Voice& voice, juce::AudioBuffer<float>& buffer, int startSample)
 {
-    auto currentSample = 0;
-    for (const auto midiMessage : midiMessages) {
-        const auto midiEvent = midiMessage.getMessage();
-        const auto midiEventSample = static_cast<int>(midiEvent.getTimeStamp());
-        if(voices.size() >= 1) voices[i]->renderVoiceFM(carrierBuffer, modBuffer, currentSample, midiEventSample, FMdepth);
-        currentSample = midiEventSample;
-        handleMidiEvent(midiEvent);
-    }
-    voices[i]->renderVoiceFM(carrierBuffer, modBuffer, currentSample, carrierBuffer->getNumSamples(), FMdepth);
-    carrierBuffer->applyGain(oscVol);
-    processDist(carrierBuffer, i);
-    voices[i]->processFilter(carrierBuffer);
+    updateVoice(voice);
+    if(isNoise || !voice.isPlaying() || voice.hasUnison()) return;
+    bank.addVoice(voice.getOscillator(), voice.getVelocityGain(), startSample, buffer.getWritePointer(0));
+    voice.setPrerendered(true);
+}
+
+void Synth::processBufferFM(Voice& voice, juce::AudioBuffer<float>& carrierBuffer, juce::AudioBuffer<float>& modBuffer, int startSample, int releaseSample)
+{
+    updateVoice(voice);
+    renderSegments(voice, carrierBuffer, &modBuffer, startSample, releaseSample);
 }
 
-void Synth::deleteVoice(int i) {
-    if(i+1>voices.size()) return;
-    voices.erase(voices.begin()+i);
+/// Renders, distorts and filters the voice one control-rate segment at a time (see ControlRate.h), so the envelope,
+/// its distortion drive and the filter cutoff move every CONTROL_BLOCK samples whatever the host block size
+void Synth::renderSegments(Voice& voice, juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>* modBuffer, int startSample, int releaseSample)
+{
+    /// Work on a copy, the envelope changes the input gain per voice and voices may render on different threads
+    Distortion voiceDist = dist;
+    const int numSamples = buffer.getNumSamples();
+    for(int sample = startSample; sample < numSamples && voice.isPlaying();) {
+        if(sample == releaseSample) voice.noteOff();
+        const int limit = releaseSample > sample ? releaseSample : numSamples;
+        const int segment = voice.beginSegment(limit - sample);
+        if(modBuffer != nullptr) voice.renderVoiceFM(buffer, *modBuffer, sample, sample + segment, FMdepth);
+        else voice.renderVoice(buffer, sample, sample + segment);
+        buffer.applyGain(sample, segment, oscVol);
+        processDist(voice, voiceDist, buffer, sample, segment);
+        voice.processFilter(buffer, sample, sample + segment);
+        sample += segment;
+    }
+    /// The voice can stop before its note-off comes round, it still has to see it
+    if(releaseSample >= startSample && !voice.isRelease()) voice.noteOff();
+}
+
+/// For muted sources, keeps the voice's note-off, phase and envelope where processBuffer() would have left them
+void Synth::skipBuffer(Voice& voice, int numSamples, int startSample, int releaseSample)
+{
+    updateVoice(voice);
+    if(releaseSample >= startSample) {
+        voice.skip(startSample, releaseSample);
+        voice.noteOff();
+        startSample = releaseSample;
+    }
+    voice.skip(startSample, numSamples);
 }
 
 void Synth::setADSR(float atk, float dec, float sus, float rel, float depth) {
@@ -184,19 +231,17 @@ void Synth::setADSR(float atk, float dec, float sus, float rel, float depth) {
     envParams.decay = dec;
     envParams.sustain = sus;
     envParams.release = rel;
-    for(int i=0; i<voices.size(); i++) {
-        voices[i]->setADSR(envParams, ADSRDepth);
-    }
 }
 
-void Synth::processDist(std::unique_ptr<juce::AudioBuffer<float>>& buffer, int i) {
+/// The buffer passed on only refers to the segment's samples, nothing is copied or allocated
+void Synth::processDist(Voice& voice, Distortion& voiceDist, juce::AudioBuffer<float>& buffer, int startSample, int numSamples) {
     if(distType == 1) return;
     if(envToDist) {
-        float envSample = voices[i]->getEnvSample();
-        dist.setEnv(envSample, ADSRDepth);
+        voiceDist.setEnv(voice.getEnvSample(), ADSRDepth);
     }
-    if(distType == 2) dist.processBufferWaveshaper(*buffer, bezier);
-    else dist.processBuffer(*buffer);
+    juce::AudioBuffer<float> segment(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), startSample, numSamples);
+    if(distType == 2) voiceDist.processBufferWaveshaper(segment, bezier);
+    else voiceDist.processBuffer(segment);
 }
 
 float Synth::midiToFreq(int midiNote)
@@ -206,50 +251,5 @@ float Synth::midiToFreq(int midiNote)
     constexpr float NOTES_IN_OCTAVE = 12.f;
     return A4_FREQ * std::powf(2, (static_cast<float>(midiNote) - A4_MIDINOTE + pitchOffset) / NOTES_IN_OCTAVE);
 }
-
-void Synth::updateFreqs() {
-    for(int i=0; i<voices.size(); i++) {
-        voices[i]->setPitch(static_cast<int>(pitchOffset));
-    }
-}
-
-void Synth::handleMidiEvent(const juce::MidiMessage& midiEvent) {
-    if(midiEvent.isNoteOn()) {
-        const auto note = midiEvent.getNoteNumber();
-        int vel = midiEvent.getVelocity();
-        for(int i=0; i<voices.size(); i++) {
-            if(voices[i]->getPitch() == note && !voices[i]->isRelease()) {
-                return;
-            }
-        }
-        std::unique_ptr<Voice> v = std::make_unique<Voice>(note, vel, isNoise);
-        //Voice* v = new Voice(note, vel, isNoise);
-        v->prepareToPlay(spec);
-        if(!isNoise) v->initializeOscillator(oscType);
-        else v->initializeNoise(noiseType);
-        v->setADSR(envParams, ADSRDepth);
-        v->setEnvRouting(envToVol, envToDist, envToFilter);
-        v->setFilter(filterType, curCutoff, curRes, keytrack, keytrackAmount);
-        v->setPitch(pitchOffset);
-        v->noteOn();
-        voices.push_back(std::move(v));
-        if(voices.size() > 8) {
-            voices.erase(voices.begin());
-        }
-    }
-    if(midiEvent.isNoteOff()) {
-        const auto note = midiEvent.getNoteNumber();
-        for(int i=0; i<voices.size(); i++) {
-            if(voices[i]->getPitch() == note && !voices[i]->isRelease()) {
-                voices[i]->noteOff();
-            }
-        }
-    }
-    if(midiEvent.isAllNotesOff()) {
-        for (int i=0; i<voices.size(); i++) {
-            voices[i]->noteOff();
-        }
-    }
-}
  
 }
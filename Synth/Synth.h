@@ -5,24 +5,29 @@
 #include "JuceHeader.h"
 #include "../Biquad.h"
 #include "../Conversions.h"
-#include "WavetableVectors.h"
 #include "../Distortion.h"
 #include "../AuxShaper/AuxBezier.h"
 #include "Voice.h"
+#include "OscillatorBank.h"
+#include "WavetableRegistry.h"
 
 namespace Colin
 {
 
+/// A Synth holds the settings for one source, the per-note state lives in the Voices owned by the VoiceManager.
+/// Settings are pushed to a voice when it starts and again each block before it renders.
+
 class Synth {
 public:
     Distortion dist;
     static constexpr auto WAVETABLE_LENGTH = 1024;
     static constexpr auto OSCILLATORS_COUNT = 256;
+    static constexpr int NOISE_STREAMS = 4; /// decorrelated shared noise blocks, voices take them in turn
     
     Synth();
     ~Synth();
     void prepareToPlay(juce::dsp::ProcessSpec spec);
-    std::vector<float> getWavetable();
+    const std::vector<float>& getWavetable() const;
     std::vector<float> getNoise();
     void setEnvRouting(bool v, bool d, bool f);
     void setDistortion(int type, float input, float output, float coeff, float mix, AuxPort::Bezier* b);
@@ -32,23 +37,44 @@ public:
     void setKeytrack(bool key);
     void setPitch(float pitch);
     void setFilter(int type, float cutoff, float res, bool key, float ktA);
-    void processBuffer(std::unique_ptr<juce::AudioBuffer<float>>&, juce::MidiBuffer&, int i);
-    void processBufferFM(std::unique_ptr<juce::AudioBuffer<float>>&, std::unique_ptr<juce::AudioBuffer<float>>&, juce::MidiBuffer&, int i);
+    void startVoice(Voice& voice, int note, int vel);
+    void processBuffer(Voice& voice, juce::AudioBuffer<float>& buffer, int startSample, int releaseSample);
+    void processBufferFM(Voice& voice, juce::AudioBuffer<float>& carrierBuffer, juce::AudioBuffer<float>& modBuffer, int startSample, int releaseSample);
+    void skipBuffer(Voice& voice, int numSamples, int startSample, int releaseSample);
+    void beginOscillatorBank() { bank.clear(); }
+    void addToOscillatorBank(Voice& voice, juce::AudioBuffer<float>& buffer, int startSample);
+    void renderOscillatorBank(int numSamples) { bank.render(numSamples); }
+    void renderSharedNoise(bool enabled, int numSamples);
     void setADSR(float atk, float dec, float sus, float rel, float depth);
-    void deleteVoice(int i);
     void setOscVol(float newVol) { oscVol = newVol; }
+    void setInterpolation(Interpolation quality);
+    void setUnison(int voices, float detune, float spread);
+    void setNoiseSeed(std::uint64_t seed);
     
 private:
-    void initializeVoices();
-    std::vector<std::unique_ptr<Voice>> voices;
     juce::dsp::ProcessSpec spec;
     float FMdepth = 0.f;
     int pitchOffset = 0;
+    juce::SharedResourcePointer<WavetableRegistry> wavetables; /// shared by every Synth in the process
+    const WavetableMipmap* wavetable = nullptr; /// the current oscillator's tables, voices point at them
+    OscillatorBank bank;
+    Interpolation interpolation = Interpolation::linear;
+    int unisonVoices = 1;
+    float unisonDetune = 0.f;  /// cents at the outermost copies
+    float unisonSpread = 0.f;  /// 0 - 1
+    std::uint64_t noiseSeed = 0; /// 0 leaves every voice's noise free running
+    std::uint64_t notesStarted = 0;
+    std::array<NoiseGenerator, NOISE_STREAMS> sharedGenerators;
+    juce::AudioBuffer<float> sharedNoise; /// one channel per stream, sized in prepareToPlay
+    bool sharedNoiseActive = false;
+    int nextNoiseStream = 0;
+    
+    void seedSharedNoise();
 
-    void processDist(std::unique_ptr<juce::AudioBuffer<float>>&, int i);
-    void handleMidiEvent(const juce::MidiMessage& midiEvent);
+    void updateVoice(Voice& voice);
+    void renderSegments(Voice& voice, juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>* modBuffer, int startSample, int releaseSample);
+    void processDist(Voice& voice, Distortion& voiceDist, juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
     float midiToFreq(int midiNote);
-    void updateFreqs();
 
     uint32 sampleRate;
     Oscillator_Type oscType = Oscillator_Type::sine;
@@ -68,8 +94,6 @@ private:
     bool keytrack = false;
     float keytrackAmount = 1;
     float oscVol = 0.2f;
-    float prevHPNoiseSample = 0;
-    float prevLPNoiseSample = 0;
     AuxPort::Bezier* bezier;
 };
      
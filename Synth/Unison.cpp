@@ -0,0 +1,164 @@
+/*
+  ==============================================================================
+
+    Unison.cpp
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+#include "Unison.h"
+#include "SimdLanes.h"
+
+namespace Colin
+{
+
+using namespace Lanes;
+
+static_assert(Unison::MAX_VOICES % WIDTH == 0, "copies are rendered in whole groups");
+
+void Unison::prepare(double newSampleRate) {
+    sampleRate = newSampleRate;
+    setFrequency(frequency);
+}
+
+/// Only recomputes when something moved, Synth::updateVoice() calls this every block
+void Unison::setVoices(int count, float detuneCents, float spreadAmount) {
+    count = juce::jlimit(1, MAX_VOICES, count);
+    spreadAmount = juce::jlimit(0.f, 1.f, spreadAmount);
+    if(count == numVoices && detuneCents == detune && spreadAmount == spread) return;
+    numVoices = count;
+    detune = detuneCents;
+    spread = spreadAmount;
+    updateGains();
+    setFrequency(frequency);
+}
+
+/// -1 for the lowest, leftmost copy to +1 for the highest, rightmost one
+float Unison::position(int lane) const {
+    if(numVoices < 2) return 0.f;
+    return 2.f * static_cast<float>(lane) / static_cast<float>(numVoices - 1) - 1.f;
+}
+
+/// Equal power panning, normalised so a centred copy gets 1 / sqrt(copies) on each side
+void Unison::updateGains() {
+    const float norm = juce::MathConstants<float>::sqrt2 / std::sqrt(static_cast<float>(numVoices));
+    for(int lane = 0; lane < MAX_VOICES; lane++) {
+        const size_t l = static_cast<size_t>(lane);
+        if(lane >= numVoices) {
+            leftGain[l] = 0.f;
+            rightGain[l] = 0.f;
+            continue;
+        }
+        const float angle = (position(lane) * spread + 1.f) * juce::MathConstants<float>::pi * 0.25f;
+        leftGain[l] = norm * std::cos(angle);
+        rightGain[l] = norm * std::sin(angle);
+    }
+}
+
+void Unison::setFrequency(float newFrequency) {
+    frequency = newFrequency;
+    for(int lane = 0; lane < MAX_VOICES; lane++) {
+        const size_t l = static_cast<size_t>(lane);
+        if(lane >= numVoices) {
+            increment[l] = 0;
+            level[l] = WavetableMipmap::GUARD_BEFORE;
+            nextLevel[l] = WavetableMipmap::GUARD_BEFORE;
+            levelFade[l] = 0.f;
+            continue;
+        }
+        const float ratio = std::exp2(position(lane) * detune / 1200.f);
+        const float tableIncrement = juce::jlimit(0.f, WavetableOscillator::TABLE_SIZE - 1.f,
+                                                  frequency * ratio * WavetableOscillator::TABLE_SIZE / static_cast<float>(sampleRate));
+        increment[l] = WavetableOscillator::toPhaseIncrement(tableIncrement);
+        const auto selection = WavetableMipmap::select(tableIncrement);
+        level[l] = selection.first;
+        nextLevel[l] = selection.second;
+        levelFade[l] = selection.fade;
+    }
+}
+
+/// Every lane, not just the copies in use. Voice::start() resets before the new note's count reaches setVoices(), and
+/// copies added then or later in the note would otherwise start together at phase 0
+void Unison::reset(juce::Random& random) {
+    for(auto& p : phase) p = static_cast<std::uint32_t>(random.nextInt());
+}
+
+void Unison::skip(int numSamples) {
+    for(int lane = 0; lane < numVoices; lane++)
+        phase[static_cast<size_t>(lane)] += increment[static_cast<size_t>(lane)] * static_cast<std::uint32_t>(numSamples);
+}
+
+void Unison::render(float* left, float* right, float gain, int numSamples) {
+    if(table == nullptr) {
+        std::fill(left, left + numSamples, 0.f);
+        if(right != nullptr) std::fill(right, right + numSamples, 0.f);
+        return;
+    }
+    switch(interpolation) {
+        case Interpolation::draft: renderLoop<Interpolation::draft>(left, right, gain, numSamples); break;
+        case Interpolation::hermite: renderLoop<Interpolation::hermite>(left, right, gain, numSamples); break;
+        case Interpolation::sinc: renderLoop<Interpolation::sinc>(left, right, gain, numSamples); break;
+        case Interpolation::linear:
+        case Interpolation::end: renderLoop<Interpolation::linear>(left, right, gain, numSamples); break;
+    }
+}
+
+/// The OscillatorBank's table read, with every group of copies held in registers for the whole block. Each sample the
+/// groups are panned and summed lane-wise, and only the two totals are added across lanes
+template <Interpolation quality>
+void Unison::renderLoop(float* left, float* right, float gain, int numSamples) {
+    using Interpolator::read;
+    constexpr int MAX_GROUPS = MAX_VOICES / WIDTH;
+    const int numGroups = (numVoices + WIDTH - 1) / WIDTH;
+    const float* t0 = table;
+    const float* sinc = Interpolator::sincTable.coefficients.data() + Interpolator::TAPS_BEFORE;
+    static_assert(Interpolator::SINC_TAPS == 1 << 3, "rows are found by shifting");
+
+    const Ints fractionMask = broadcast(WavetableOscillator::FRACTION_MASK);
+    const Floats fractionScale = WavetableOscillator::FRACTION_SCALE;
+    const Floats sincPhases = static_cast<float>(Interpolator::SINC_PHASES);
+    Ints p[MAX_GROUPS], inc[MAX_GROUPS], firstLevel[MAX_GROUPS], secondLevel[MAX_GROUPS];
+    Floats fade[MAX_GROUPS], gainLeft[MAX_GROUPS], gainRight[MAX_GROUPS];
+    for(int g = 0; g < numGroups; g++) {
+        const size_t first = static_cast<size_t>(g * WIDTH);
+        p[g] = loadInts(&phase[first]);
+        inc[g] = loadInts(&increment[first]);
+        firstLevel[g] = loadInts(&level[first]);
+        secondLevel[g] = loadInts(&nextLevel[first]);
+        fade[g] = loadFloats(&levelFade[first]);
+        gainLeft[g] = loadFloats(&leftGain[first]);
+        gainRight[g] = loadFloats(&rightGain[first]);
+    }
+
+    for(int t = 0; t < numSamples; t++) {
+        Floats l = 0.f, r = 0.f;
+        for(int g = 0; g < numGroups; g++) {
+            const Ints index = shiftRight<WavetableOscillator::FRACTION_BITS>(p[g]);
+            const Floats fraction = toFloats(mask(p[g], fractionMask)) * fractionScale;
+            const Ints a = add(index, firstLevel[g]);
+            const Ints b = add(index, secondLevel[g]);
+            Ints row {};
+            if constexpr (quality == Interpolation::sinc)
+                row = shiftLeft<3>(truncate(fraction * sincPhases));
+            auto coefficient = [sinc, row](int k) { return gather(sinc + k, row); };
+
+            const Floats first = read<quality>([t0, a](int k) { return gather(t0 + k, a); }, coefficient, fraction);
+            const Floats second = read<quality>([t0, b](int k) { return gather(t0 + k, b); }, coefficient, fraction);
+            const Floats y = first + fade[g] * (second - first);
+            l = l + y * gainLeft[g];
+            r = r + y * gainRight[g];
+            p[g] = add(p[g], inc[g]);
+        }
+        if(right != nullptr) {
+            left[t] = sum(l) * gain;
+            right[t] = sum(r) * gain;
+        }
+        else {
+            left[t] = sum(l + r) * (0.5f * gain);
+        }
+    }
+    for(int g = 0; g < numGroups; g++) storeInts(&phase[static_cast<size_t>(g * WIDTH)], p[g]);
+}
+
+}
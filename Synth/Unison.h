@@ -0,0 +1,79 @@
+#ifndef Colin_Unison_H
+#define Colin_Unison_H
+
+#include <array>
+#include <cstdint>
+#include <JuceHeader.h>
+#include "WavetableOsc.h"
+
+/*
+  ==============================================================================
+
+    Unison.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+
+/// Up to 16 detuned copies of one voice's oscillator spread across the stereo field, the supersaw stack. The copies
+/// are the SIMD lanes of the same table read the OscillatorBank runs (see SimdLanes.h), so a 7 copy stack is two passes
+/// of the kernel on AVX2 rather than seven oscillators, and the voice's envelope, distortion and filter run once on
+/// the sum.
+///
+/// Copies are spaced evenly in pitch from -detune to +detune cents and in pan from -spread to +spread, each with its own
+/// pair of mipmap levels. The stack is scaled by 1 / sqrt(copies), so it gets thicker without getting much louder.
+
+class Unison {
+public:
+    static constexpr int MAX_VOICES = 16;
+
+    void prepare(double sampleRate);
+
+    /// The mipmap belongs to the Synth and outlives the stack
+    void setWavetable(const WavetableMipmap& mipmap) { table = mipmap.data(); }
+    void setInterpolation(Interpolation quality) { interpolation = quality; }
+
+    /// detune is in cents at the outermost copies, spread runs from 0 (all centred) to 1 (outermost hard left and right)
+    void setVoices(int count, float detuneCents, float spreadAmount);
+    int getNumVoices() const { return numVoices; }
+    bool isActive() const { return numVoices > 1; }
+
+    /// The centre pitch, the copies sit either side of it
+    void setFrequency(float newFrequency);
+
+    /// Scatters the copies' phases, a stack that starts in phase sounds like one loud oscillator until it drifts apart
+    void reset(juce::Random& random);
+
+    /// Writes numSamples to left and right, scaled by gain. right is nullptr for a mono buffer, left then gets the average
+    void render(float* left, float* right, float gain, int numSamples);
+    void skip(int numSamples);
+
+private:
+    template <Interpolation quality> void renderLoop(float* left, float* right, float gain, int numSamples);
+    float position(int lane) const;
+    void updateGains();
+
+    double sampleRate = 44100.0;
+    const float* table = nullptr;
+    Interpolation interpolation = Interpolation::linear;
+    int numVoices = 1;
+    float detune = 0.f;
+    float spread = 0.f;
+    float frequency = 0.f;
+
+    /// One lane per copy, lanes past numVoices stay silent and still
+    alignas(32) std::array<std::uint32_t, MAX_VOICES> phase {};
+    alignas(32) std::array<std::uint32_t, MAX_VOICES> increment {};
+    alignas(32) std::array<int, MAX_VOICES> level {};
+    alignas(32) std::array<int, MAX_VOICES> nextLevel {};
+    alignas(32) std::array<float, MAX_VOICES> levelFade {};
+    alignas(32) std::array<float, MAX_VOICES> leftGain {};
+    alignas(32) std::array<float, MAX_VOICES> rightGain {};
+};
+
+}
+
+#endif
@@ -12,95 +12,67 @@
 
 namespace Colin  {
 
-Voice::Voice(int p, int v, bool n) {
-    pitch = p;
-    vel = v;
-    noise = n;
-    ladder = new juce::dsp::LadderFilter<float>();
-}
-
-Voice::~Voice() {
-    delete oscillator;
-    delete ladder;
-}
-
 void Voice::prepareToPlay(juce::dsp::ProcessSpec spec)
 {
     sampleRate = spec.sampleRate;
-    initializeOscillator(Oscillator_Type::sine);
+    oscillator.prepare(sampleRate);
+    unison.prepare(sampleRate);
+    noiseGenerator.prepare(sampleRate);
     env.setSampleRate(sampleRate);
     TPT.reset();
     TPT.prepare(spec);
     TPT.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
     TPT.setCutoffFrequency(curCutoff);
     TPT.setCutoffFrequency(curRes);
-    ladder->reset();
-    ladder->prepare(spec);
-    ladder->setMode(juce::dsp::LadderFilterMode::LPF12);
-    ladder->setCutoffFrequencyHz(curCutoff);
-    ladder->setResonance(curRes);
-    ladder->setDrive(3.f);
+    ladder.reset();
+    ladder.prepare(spec);
+    ladder.setMode(juce::dsp::LadderFilterMode::LPF12);
+    ladder.setCutoffFrequencyHz(curCutoff);
+    ladder.setResonance(curRes);
+    ladder.setDrive(3.f);
+    seed(static_cast<std::uint64_t>(juce::Random().nextInt64()));
 }
 
-void Voice::initializeOscillator(Oscillator_Type osc) {
-    oscType = osc;
-    const auto wavetable = getWavetable();
-    oscillator = new WavetableOscillator(wavetable, sampleRate, pitch);
+void Voice::seed(std::uint64_t seed) {
+    noiseGenerator.seed(seed);
+    random.setSeed(static_cast<juce::int64>(seed));
 }
 
-void Voice::initializeNoise(Noise_Type noi) {
-    noise = true;
-    noiseType = noi;
+void Voice::start(int p, int v) {
+    pitch = p;
+    vel = v;
+    active = true;
+    release = false;
+    envSampleStart = 0.f;
+    envSampleEnd = 0.f;
+    controlClock.reset();
+    controlEnv = 0.f;
+    noiseGenerator.reset();
+    env.reset();
+    TPT.reset();
+    ladder.reset();
+    oscillator.reset();
+    oscillator.setPitch(pitch + pitchOffset);
+    unison.reset(random);
+    unison.setFrequency(oscillator.getFrequency());
 }
 
-std::vector<float> Voice::getWavetable() {
-    if(oscType == Oscillator_Type::sine) {
-        return sineWavetable();
-    }
-    else if(oscType == Oscillator_Type::triangle) {
-        return triangleWavetable();
-    }
-    else if(oscType == Oscillator_Type::square) {
-        return squareWavetable();
-    }
-    else if(oscType == Oscillator_Type::saw) {
-        return sawWavetable();
-    }
-    else if(oscType == Oscillator_Type::fourtyFour) {
-        return fourtyFour();
-    }
-    else if(oscType == Oscillator_Type::echo) {
-        return echo();
-    }
-    else if(oscType == Oscillator_Type::juliett) {
-        return juliett();
-    }
-    else if(oscType == Oscillator_Type::crayon) {
-        return crayon();
-    }
-    else if(oscType == Oscillator_Type::gritty) {
-        return gritty();
-    }
+void Voice::initializeOscillator(Oscillator_Type osc, const WavetableMipmap& wavetable) {
+    oscType = osc;
+    oscillator.setWavetable(wavetable);
+    unison.setWavetable(wavetable);
 }
 
-std::vector<float> Voice::getNoise() {
-    if(noiseType == Noise_Type::gauss) {
-        return gauss();
-    }
-    else if(noiseType == Noise_Type::binary) {
-        return binary();
-    }
-    else if(noiseType == Noise_Type::lp) {
-        return lpNoise();
-    }
-    else if(noiseType == Noise_Type::hp) {
-        return hpNoise();
-    }
+void Voice::initializeNoise(Noise_Type noi) {
+    noise = true;
+    noiseType = noi;
 }
 
 void Voice::setPitch(int p) {
+    if(p == pitchOffset) return;
     pitchOffset = p;
-    oscillator->setPitch(p + pitch);
+    oscillator.setPitch(p + pitch);
+    unison.setFrequency(oscillator.getFrequency());
 }
 
 int Voice::getPitch() {
@@ -124,8 +96,11 @@ void Voice::setNoise(bool isNoise) {
 }
 
 void Voice::setADSR(juce::ADSR::Parameters envParams, float depth) {
-    env.setParameters(envParams);
     ADSRDepth = depth;
+    const auto& cur = env.getParameters();
+    if(envParams.attack == cur.attack && envParams.decay == cur.decay && envParams.sustain == cur.sustain && envParams.release == cur.release)
+        return;
+    env.setParameters(envParams);
 }
 
 void Voice::noteOn() {
@@ -169,18 +144,18 @@ void Voice::setFilter(int type, float cutoff, float res, bool key, float ktA) {
             if(type == 5) t = juce::dsp::LadderFilterMode::LPF24;
             else if(type == 6) t = juce::dsp::LadderFilterMode::HPF12;
             else if(type == 7) t = juce::dsp::LadderFilterMode::HPF24;
-            ladder->setMode(t);
+            ladder.setMode(t);
         }
     }
     if(cutoff != curCutoff) {
         curCutoff = cutoff;
         TPT.setCutoffFrequency(cutoff);
-        ladder->setCutoffFrequencyHz(cutoff);
+        ladder.setCutoffFrequencyHz(cutoff);
     }
     if(res != curRes) {
         curRes = res;
         TPT.setResonance(res);
-        ladder->setResonance(res);
+        ladder.setResonance(res);
     }
 }
 
@@ -190,54 +165,50 @@ void Voice::setEnvRouting(bool v, bool d, bool f) {
     envToDist = d;
 }
 
-float Voice::getEnvSample() {
-    return envSampleStart;
+void Voice::setUnison(int voices, float detune, float spread) {
+    unison.setVoices(voices, detune, spread);
 }
 
-float Voice::renderNoise() {
-    if(noiseType == Noise_Type::gauss) {
-        return (((float)rand() / (float)RAND_MAX ) - 0.5);
-    }
-    else if(noiseType == Noise_Type::binary) {
-        float ran = (((float)rand() / (float)RAND_MAX ) - 0.5);
-        float sample;
-        if(ran >= 0) sample = 0.5;
-        else sample = -0.5;
-        return sample;
-    }
-    else if(noiseType == Noise_Type::hp) {
-        float ran = (((float)rand() / (float)RAND_MAX ) - 0.5);
-        float y = -0.5 * ran + 0.5 * prevHPNoiseSample;
-        prevHPNoiseSample = ran;
-        return y;
-    }
-    else if(noiseType == Noise_Type::lp) {
-        float ran = (((float)rand() / (float)RAND_MAX ) - 0.5);
-        float y = 0.5 * ran - 0.5 * prevLPNoiseSample;
-        prevLPNoiseSample = y;
-        return y;
-    }
+/// Starts the next control-rate segment, at most maxSamples long, and reads the envelope if it's on the grid
+int Voice::beginSegment(int maxSamples) {
+    const int numSamples = controlClock.next(maxSamples);
+    if(controlClock.isControlPoint()) controlEnv = env.getValue();
+    return numSamples;
 }
 
-void Voice::renderVoice(std::unique_ptr<juce::AudioBuffer<float>>& buffer, int startSample, int endSample) {
+float Voice::getEnvSample() {
+    return controlEnv;
+}
+
+void Voice::renderVoice(juce::AudioBuffer<float>& buffer, int startSample, int endSample) {
     if(!active) return;
     
-    auto* firstChannel = buffer->getWritePointer(0);
+    auto* firstChannel = buffer.getWritePointer(0);
     getEnvSamples(endSample - startSample);
 
     if(!noise) {
         if(!env.isActive()) {
             if(envToVol) {
-                oscillator->stop();
+                oscillator.stop();
                 active = false;
+                /// The bank rendered the whole block, what's left of it has to go silent like an unrendered voice
+                if(prerendered) buffer.clear(startSample, buffer.getNumSamples() - startSample);
                 return;
             }
         }
-        for (auto sample = startSample; sample < endSample; sample++) {
-            firstChannel[sample] += oscillator->getSample() * normVelocity(vel);
+        /// The buffer starts the block cleared, so the oscillator can write rather than add. A unison stack writes
+        /// both sides itself, the OscillatorBank never takes it
+        const bool stereo = unison.isActive() && buffer.getNumChannels() > 1;
+        if(unison.isActive()) {
+            float* right = stereo ? buffer.getWritePointer(1) + startSample : nullptr;
+            unison.render(firstChannel + startSample, right, normVelocity(vel), endSample - startSample);
+        }
+        else if(!prerendered) {
+            oscillator.renderBlock(firstChannel + startSample, endSample - startSample);
+            juce::FloatVectorOperations::multiply(firstChannel + startSample, normVelocity(vel), endSample - startSample);
         }
-        for (auto channel = 1; channel < buffer->getNumChannels(); channel++) {
-            std::copy(firstChannel + startSample, firstChannel + endSample, buffer->getWritePointer(channel) + startSample);
+        for (auto channel = stereo ? 2 : 1; channel < buffer.getNumChannels(); channel++) {
+            std::copy(firstChannel + startSample, firstChannel + endSample, buffer.getWritePointer(channel) + startSample);
         }
     }
         
@@ -248,52 +219,74 @@ void Voice::renderVoice(std::unique_ptr<juce::AudioBuffer<float>>& buffer, int s
                 return;
             }
         }
-        for (auto sample = startSample; sample < endSample; sample++) {
-            firstChannel[sample] += renderNoise() * normVelocity(vel);
+        if(sharedNoise != nullptr) {
+            juce::FloatVectorOperations::multiply(firstChannel + startSample, sharedNoise + startSample, normVelocity(vel), endSample - startSample);
+        }
+        else {
+            noiseGenerator.render(noiseType, firstChannel + startSample, endSample - startSample);
+            juce::FloatVectorOperations::multiply(firstChannel + startSample, normVelocity(vel), endSample - startSample);
         }
-        for (auto channel = 1; channel < buffer->getNumChannels(); channel++) {
-            std::copy(firstChannel + startSample, firstChannel + endSample, buffer->getWritePointer(channel) + startSample);
+        for (auto channel = 1; channel < buffer.getNumChannels(); channel++) {
+            std::copy(firstChannel + startSample, firstChannel + endSample, buffer.getWritePointer(channel) + startSample);
         }
     }
     if(envToVol) {
-        buffer->applyGainRamp(startSample, endSample-startSample, envSampleStart, envSampleEnd);
+        buffer.applyGainRamp(startSample, endSample-startSample, envSampleStart, envSampleEnd);
     }
 }
 
-void Voice::renderVoiceFM(std::unique_ptr<juce::AudioBuffer<float>>& carrierBuffer, std::unique_ptr<juce::AudioBuffer<float>>& modBuffer, int startSample, int endSample, float depth) {
+void Voice::renderVoiceFM(juce::AudioBuffer<float>& carrierBuffer, juce::AudioBuffer<float>& modBuffer, int startSample, int endSample, float depth) {
     if(!active) return;
     
-    auto* firstChannel = carrierBuffer->getWritePointer(0);
-    float fmSample = 0.f;
+    auto* firstChannel = carrierBuffer.getWritePointer(0);
     getEnvSamples(endSample - startSample);
     
     if(!env.isActive()) {
         if(envToVol) {
-            oscillator->stop();
+            oscillator.stop();
             active = false;
         }
     }
-    for (auto sample = startSample; sample < endSample; sample++) {
-        fmSample = modBuffer->getSample(0, sample);
-        oscillator->setPM(fmSample * depth);
-        firstChannel[sample] += oscillator->getSample() * normVelocity(vel);
-        
-    }
-    for (auto channel = 1; channel < carrierBuffer->getNumChannels(); channel++) {
-        std::copy(firstChannel + startSample, firstChannel + endSample, carrierBuffer->getWritePointer(channel) + startSample);
+    oscillator.renderBlockPM(firstChannel + startSample, modBuffer.getReadPointer(0) + startSample, depth, endSample - startSample);
+    juce::FloatVectorOperations::multiply(firstChannel + startSample, normVelocity(vel), endSample - startSample);
+    for (auto channel = 1; channel < carrierBuffer.getNumChannels(); channel++) {
+        std::copy(firstChannel + startSample, firstChannel + endSample, carrierBuffer.getWritePointer(channel) + startSample);
     }
     if(envToVol) {
-        carrierBuffer->applyGainRamp(startSample, endSample-startSample, envSampleStart, envSampleEnd);
+        carrierBuffer.applyGainRamp(startSample, endSample-startSample, envSampleStart, envSampleEnd);
     }
 }
 
+/// Used instead of rendering while the source is muted: the phase and envelope move on as if the
+/// block had been rendered, and the filters start clean when the source comes back
+void Voice::skip(int startSample, int endSample) {
+    if(!active) return;
+    if(!env.isActive() && envToVol) {
+        if(!noise) oscillator.stop();
+        active = false;
+        return;
+    }
+    const int numSamples = endSample - startSample;
+    env.skip(numSamples);
+    controlClock.skip(numSamples);
+    controlEnv = env.getValue();
+    if(!noise) {
+        oscillator.skip(numSamples);
+        unison.skip(numSamples);
+    }
+    TPT.reset();
+    ladder.reset();
+}
+
+/// Advances the envelope exactly numSamples, like Envelope::skip(), keeping the first and last values for the gain
+/// ramp. A 1 sample segment ramps from a value to itself
 void Voice::getEnvSamples(int numSamples) {
+    if(numSamples <= 0) return;
     envSampleStart = env.getNextSample();
-    for(int j=0; j<numSamples-2; j++) {
-        env.getNextSample();
+    envSampleEnd = envSampleStart;
+    for(int j=1; j<numSamples; j++) {
+        envSampleEnd = env.getNextSample();
     }
-    envSampleEnd = env.getNextSample();
-    //cycleEnv = true;
 }
 
 float Voice::midiToFreq(int midiNote)
@@ -304,23 +297,26 @@ float Voice::midiToFreq(int midiNote)
     return A4_FREQ * std::powf(2, (static_cast<float>(midiNote) - A4_MIDINOTE + pitchOffset) / NOTES_IN_OCTAVE);
 }
 
-void Voice::processFilter(std::unique_ptr<juce::AudioBuffer<float>>& buffer) {
+/// Filters one segment, keytracking and the envelope only move the cutoff when the segment starts on a control point
+void Voice::processFilter(juce::AudioBuffer<float>& buffer, int startSample, int endSample) {
     if(!active) return;
-    float cutoff = curCutoff;
-    if(keytrack) {
-        float newcutoff = midiToFreq(pitch) * keytrackAmount + curCutoff;
-        cutoff = newcutoff < 20000 ? newcutoff : 20000;
-        ladder->setCutoffFrequencyHz(cutoff);
-        TPT.setCutoffFrequency(cutoff);
-    }
-    if(envToFilter) {
-        ladder->setCutoffFrequencyHz((cutoff * (1-ADSRDepth)) + (cutoff * envSampleStart * ADSRDepth));
-        TPT.setCutoffFrequency((cutoff * (1-ADSRDepth)) + (cutoff * envSampleStart * ADSRDepth));
+    if(controlClock.isControlPoint()) {
+        float cutoff = curCutoff;
+        if(keytrack) {
+            float newcutoff = midiToFreq(pitch) * keytrackAmount + curCutoff;
+            cutoff = newcutoff < 20000 ? newcutoff : 20000;
+            ladder.setCutoffFrequencyHz(cutoff);
+            TPT.setCutoffFrequency(cutoff);
+        }
+        if(envToFilter) {
+            ladder.setCutoffFrequencyHz((cutoff * (1-ADSRDepth)) + (cutoff * controlEnv * ADSRDepth));
+            TPT.setCutoffFrequency((cutoff * (1-ADSRDepth)) + (cutoff * controlEnv * ADSRDepth));
+        }
     }
-    juce::dsp::AudioBlock<float> block(*buffer);
+    auto block = juce::dsp::AudioBlock<float>(buffer).getSubBlock(static_cast<size_t>(startSample), static_cast<size_t>(endSample - startSample));
     auto pc = juce::dsp::ProcessContextReplacing<float>(block);
     if(filterType <= 3) TPT.process(pc);
-    else ladder->process(pc);
+    else ladder.process(pc);
 }
 
 }
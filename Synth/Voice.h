@@ -2,8 +2,11 @@
 #define Colin_Voice_H
 
 #include <JuceHeader.h>
-#include "WavetableVectors.h"
 #include "WavetableOsc.h"
+#include "Unison.h"
+#include "NoiseGenerator.h"
+#include "Envelope.h"
+#include "ControlRate.h"
 
 /*
   ==============================================================================
@@ -22,19 +25,21 @@ enum class Oscillator_Type {
     sine = 1, triangle, saw, square, fourtyFour, echo, juliett, crayon, gritty, end
 };
 
-enum class Noise_Type {
-    gauss = 1, binary, lp, hp, end
-};
+/// Voices are owned by a GlobalVoice in the VoiceManager and reused between notes,
+/// prepareToPlay() does all the allocation and start() only resets state for a new note
 
 class Voice {
 public:
-    Voice(int p, int v, bool n);
-    ~Voice();
+    Voice() = default;
+    ~Voice() = default;
     void prepareToPlay(juce::dsp::ProcessSpec spec);
-    void initializeOscillator(Oscillator_Type osc);
+    /// Restarts the noise and the unison phases from seed, so a seeded render comes out the same every time
+    void seed(std::uint64_t seed);
+    void start(int p, int v);
+    void initializeOscillator(Oscillator_Type osc, const WavetableMipmap& wavetable);
     void initializeNoise(Noise_Type noi);
-    std::vector<float> getWavetable();
-    std::vector<float> getNoise();
+    Oscillator_Type getOscillatorType() { return oscType; }
+    Noise_Type getNoiseType() { return noiseType; }
     void setPitch(int p);
     int getPitch();
     void setVelocity(int v);
@@ -44,41 +49,61 @@ public:
     void setNoise(bool isNoise);
     void setFilter(int type, float cutoff, float res, bool key, float ktA);
     void setEnvRouting(bool v, bool d, bool f);
+    void setUnison(int voices, float detune, float spread);
+    bool hasUnison() const { return unison.isActive(); }
+    int beginSegment(int maxSamples);
     float getEnvSample();
     void noteOn();
     void noteOff();
     void setVol(float v);
     
-    float renderNoise();
-    void renderVoice(std::unique_ptr<juce::AudioBuffer<float>>& buffer, int startSample, int endSample);
-    void renderVoiceFM(std::unique_ptr<juce::AudioBuffer<float>>& carrierBuffer, std::unique_ptr<juce::AudioBuffer<float>>& modBuffer, int startSample, int endSample, float depth);
-    void processFilter(std::unique_ptr<juce::AudioBuffer<float>>& buffer);
+    void renderVoice(juce::AudioBuffer<float>& buffer, int startSample, int endSample);
+    void renderVoiceFM(juce::AudioBuffer<float>& carrierBuffer, juce::AudioBuffer<float>& modBuffer, int startSample, int endSample, float depth);
+    void skip(int startSample, int endSample);
+    void processFilter(juce::AudioBuffer<float>& buffer, int startSample, int endSample);
+    void processFilter(juce::AudioBuffer<float>& buffer) { processFilter(buffer, 0, buffer.getNumSamples()); }
     float midiToFreq(int midiNote);
     bool isRelease();
     
     float normVelocity(int vel);
     void getEnvSamples(int numSamples);
+    
+    /// Set while the source's OscillatorBank has already written this block's oscillator into the voice's buffer
+    void setPrerendered(bool isPrerendered) { prerendered = isPrerendered; }
+    /// Set while the noise source renders shared noise, the voice then reads this block instead of its own generator
+    void setSharedNoise(const float* block) { sharedNoise = block; }
+    void setNoiseStream(int stream) { noiseStream = stream; }
+    int getNoiseStream() const { return noiseStream; }
+    WavetableOscillator& getOscillator() { return oscillator; }
+    void setInterpolation(Interpolation quality) { oscillator.setInterpolation(quality); unison.setInterpolation(quality); }
+    float getVelocityGain() { return normVelocity(vel); }
 
         
 private:
-    float sampleRate;
-    int pitch;
+    float sampleRate = 44100;
+    int pitch = 0;
     int pitchOffset = 0;
-    int vel;
-    bool active = true;
+    int vel = 0;
+    bool active = false;
     bool noise = false;
     bool release = false;
     bool cycleEnv = false;
+    bool prerendered = false;
+    const float* sharedNoise = nullptr;
+    int noiseStream = 0;
     
     float envSampleStart = 0.f;
     float envSampleEnd = 0.f;
+    ControlClock controlClock;
+    float controlEnv = 0.f; /// the envelope at the last control point, drives the filter cutoff and distortion
     
-    WavetableOscillator* oscillator;
+    WavetableOscillator oscillator;
+    Unison unison; /// replaces the oscillator when there's more than one copy, except as an FM carrier
     Oscillator_Type oscType = Oscillator_Type::sine;
     Noise_Type noiseType = Noise_Type::gauss;
     
     juce::dsp::StateVariableTPTFilter<float> TPT;
-    juce::dsp::LadderFilter<float>* ladder;
+    juce::dsp::LadderFilter<float> ladder;
     float filterType = 1;
     int curTPTMode = 1;
     int curLadderMode = 1;
@@ -91,10 +116,10 @@ private:
     bool envToVol = false;
     bool envToDist = false;
     
-    float prevHPNoiseSample = 0;
-    float prevLPNoiseSample = 0;
+    NoiseGenerator noiseGenerator;
+    juce::Random random; /// for the unison phases, one per voice so threads never share it
 
-    juce::ADSR env;
+    Envelope env;
     float ADSRDepth = 0.f;
 
 };
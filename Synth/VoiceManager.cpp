@@ -0,0 +1,203 @@
+/*
+  ==============================================================================
+
+    VoiceManager.cpp
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+#include "VoiceManager.h"
+
+namespace Colin
+{
+
+void GlobalVoice::prepareToPlay(juce::dsp::ProcessSpec spec) {
+    osc1.prepareToPlay(spec);
+    osc2.prepareToPlay(spec);
+    noise.prepareToPlay(spec);
+    noise.setNoise(true);
+    sampler.prepareToPlay(spec);
+    
+    /// Distortion::processBuffer always writes two channels, so the buffers are at least stereo
+    const int numChannels = juce::jmax(2, static_cast<int>(spec.numChannels));
+    const int maxBlock = static_cast<int>(spec.maximumBlockSize);
+    osc1Buffer.setSize(numChannels, maxBlock);
+    osc2Buffer.setSize(numChannels, maxBlock);
+    noiseBuffer.setSize(numChannels, maxBlock);
+    samplerBuffer.setSize(numChannels, maxBlock);
+    setBlockSize(numChannels, maxBlock);
+    
+    adsr.setSampleRate(spec.sampleRate);
+    adsr.reset();
+    release = false;
+}
+
+void GlobalVoice::start(int note, int vel, int sample, const juce::ADSR::Parameters& params) {
+    pitch = note;
+    velocity = vel;
+    release = false;
+    startSample = sample;
+    releaseSample = -1;
+    adsr.setParameters(params);
+    adsr.reset();
+    adsr.noteOn();
+    controlClock.reset();
+}
+
+/// The envelope is released when applyADSR() reaches the sample, not now
+void GlobalVoice::noteOff(int sample) {
+    if(release) return;
+    release = true;
+    releaseSample = juce::jmax(sample, startSample);
+}
+
+/// Matches the buffers to the current block and clears them, setSize() keeps the allocation made in prepareToPlay()
+void GlobalVoice::setBlockSize(int numChannels, int numSamples) {
+    numChannels = juce::jmax(2, numChannels);
+    osc1Buffer.setSize(numChannels, numSamples, false, false, true);
+    osc2Buffer.setSize(numChannels, numSamples, false, false, true);
+    noiseBuffer.setSize(numChannels, numSamples, false, false, true);
+    samplerBuffer.setSize(numChannels, numSamples, false, false, true);
+    osc1Buffer.clear();
+    osc2Buffer.clear();
+    noiseBuffer.clear();
+    samplerBuffer.clear();
+    startSample = 0;
+    releaseSample = -1;
+}
+
+void GlobalVoice::setADSRParameters(const juce::ADSR::Parameters& params) {
+    // JUCE documentation recommends calling reset() when changing ADSR parameters, but that's lame
+    adsr.setParameters(params);
+}
+
+/// One gain ramp per control-rate segment rather than per host block, so long blocks don't smear the attack.
+/// Sample accurate: the envelope starts on the note-on sample (nothing was rendered before it) and releases on the note-off sample
+void GlobalVoice::applyADSR() {
+    const int numSamples = osc1Buffer.getNumSamples();
+    for(int start = startSample; start < numSamples;) {
+        if(start == releaseSample) adsr.noteOff();
+        const int limit = releaseSample > start ? releaseSample : numSamples;
+        const int segment = controlClock.next(limit - start);
+        float envSampleStart = adsr.getNextSample();
+        for(int i=2; i<segment; i++) {
+            adsr.getNextSample();
+        }
+        float envSampleEnd = segment > 1 ? adsr.getNextSample() : envSampleStart;
+        /// A muted source's buffer is only read as an FM modulator, which happened before this, so leave it alone
+        if(osc1Vol != 0.f) osc1Buffer.applyGainRamp(start, segment, envSampleStart, envSampleEnd);
+        if(osc2Vol != 0.f) osc2Buffer.applyGainRamp(start, segment, envSampleStart, envSampleEnd);
+        if(noiseVol != 0.f) noiseBuffer.applyGainRamp(start, segment, envSampleStart, envSampleEnd);
+        if(samplerVol != 0.f) samplerBuffer.applyGainRamp(start, segment, envSampleStart, envSampleEnd);
+        start += segment;
+    }
+}
+
+void GlobalVoice::setVolume(float osc1, float osc2, float noise, float sampler) {
+    osc1Vol = osc1;
+    osc2Vol = osc2;
+    noiseVol = noise;
+    samplerVol = sampler;
+}
+
+/// Mixes the four source buffers into output a whole channel at a time, gain is folded into each source volume once per block
+void GlobalVoice::addTo(juce::AudioBuffer<float>& output, float gain) {
+    const int numSamples = juce::jmin(output.getNumSamples(), osc1Buffer.getNumSamples());
+    const int numChannels = juce::jmin(output.getNumChannels(), osc1Buffer.getNumChannels());
+    const float gains[] = { osc1Vol * gain, osc2Vol * gain, noiseVol * gain, samplerVol * gain };
+    const juce::AudioBuffer<float>* sources[] = { &osc1Buffer, &osc2Buffer, &noiseBuffer, &samplerBuffer };
+    for(int channel = 0; channel < numChannels; channel++) {
+        auto* out = output.getWritePointer(channel);
+        for(int i=0; i<4; i++) {
+            if(gains[i] == 0.f) continue;
+            juce::FloatVectorOperations::addWithMultiply(out, sources[i]->getReadPointer(channel), gains[i], numSamples);
+        }
+    }
+}
+
+bool GlobalVoice::isActive() {
+    return adsr.isActive();
+}
+
+//==============================================================================
+
+void VoiceManager::setPolyphony(int n) {
+    requestedVoices = juce::jlimit(1, MAX_VOICES, n);
+}
+
+/// Voices are only reallocated when the count changed, they're all re-prepared either way
+void VoiceManager::prepareToPlay(juce::dsp::ProcessSpec spec) {
+    const int n = requestedVoices.load();
+    if(n != numVoices || voices == nullptr) {
+        voices = std::make_unique<GlobalVoice[]>(static_cast<size_t>(n));
+        numVoices = n;
+    }
+    freeList.assign(static_cast<size_t>(numVoices), nullptr);
+    active.assign(static_cast<size_t>(numVoices), nullptr);
+    for(int i=0; i<numVoices; i++) {
+        voices[i].prepareToPlay(spec);
+        freeList[i] = &voices[numVoices - 1 - i];
+    }
+    numFree = numVoices;
+    numActive = 0;
+    blockChannels = static_cast<int>(spec.numChannels);
+    blockSamples = static_cast<int>(spec.maximumBlockSize);
+}
+
+void VoiceManager::beginBlock(int numChannels, int numSamples) {
+    blockChannels = numChannels;
+    blockSamples = numSamples;
+    for(int i=0; i<numActive; i++) {
+        active[i]->setBlockSize(numChannels, numSamples);
+    }
+}
+
+/// Returns the voice the sources should start, stealing the oldest one when everything is in use
+GlobalVoice* VoiceManager::noteOn(int note, int vel, int sample, const juce::ADSR::Parameters& params) {
+    if(numFree == 0) free(0);
+    GlobalVoice* v = freeList[--numFree];
+    v->setBlockSize(blockChannels, blockSamples);
+    v->start(note, vel, sample, params);
+    active[numActive++] = v;
+    return v;
+}
+
+void VoiceManager::noteOff(int note, int sample) {
+    for(int i=0; i<numActive; i++) {
+        if(active[i]->getPitch() == note && !active[i]->isRelease()) {
+            active[i]->noteOff(sample);
+        }
+    }
+}
+
+void VoiceManager::allNotesOff(int sample) {
+    for(int i=0; i<numActive; i++) {
+        active[i]->noteOff(sample);
+    }
+}
+
+void VoiceManager::setADSRParameters(const juce::ADSR::Parameters& params) {
+    for(int i=0; i<numActive; i++) {
+        active[i]->setADSRParameters(params);
+    }
+}
+
+/// Called at the end of the block, hands voices whose global envelope has finished back to the free list
+void VoiceManager::releaseFinished() {
+    for(int i=numActive-1; i>=0; i--) {
+        if(!active[i]->isActive()) free(i);
+    }
+}
+
+void VoiceManager::free(int activeIndex) {
+    jassert(activeIndex >= 0 && activeIndex < numActive);
+    jassert(numFree < numVoices);
+    freeList[numFree++] = active[activeIndex];
+    for(int i=activeIndex; i<numActive-1; i++) {
+        active[i] = active[i+1];
+    }
+    numActive--;
+}
+
+}
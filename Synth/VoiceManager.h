@@ -0,0 +1,113 @@
+#ifndef Colin_VoiceManager_H
+#define Colin_VoiceManager_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <JuceHeader.h>
+#include "Voice.h"
+#include "SamplerVoice.h"
+#include "ControlRate.h"
+
+/*
+  ==============================================================================
+
+    VoiceManager.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+
+/// Everything one note needs: a voice for each source, their render buffers and the global volume envelope from the main tab
+
+class GlobalVoice {
+public:
+    GlobalVoice() = default;
+    ~GlobalVoice() = default;
+    void prepareToPlay(juce::dsp::ProcessSpec spec);
+    void start(int note, int vel, int sample, const juce::ADSR::Parameters& params);
+    void noteOff(int sample);
+    void setBlockSize(int numChannels, int numSamples);
+    void setADSRParameters(const juce::ADSR::Parameters& params);
+    void applyADSR();
+    void setVolume(float osc1, float osc2, float noise, float sampler);
+    void addTo(juce::AudioBuffer<float>& output, float gain);
+    bool isActive();
+    bool isRelease() { return release; }
+    int getPitch() { return pitch; }
+    int getVelocity() { return velocity; }
+    int getStartSample() { return startSample; }
+    int getReleaseSample() { return releaseSample; }
+    
+    juce::AudioBuffer<float>& getOsc1Buffer() { return osc1Buffer; }
+    juce::AudioBuffer<float>& getOsc2Buffer() { return osc2Buffer; }
+    juce::AudioBuffer<float>& getNoiseBuffer() { return noiseBuffer; }
+    juce::AudioBuffer<float>& getSamplerBuffer() { return samplerBuffer; }
+    
+    Voice osc1;
+    Voice osc2;
+    Voice noise;
+    SamplerVoice sampler;
+    
+private:
+    juce::AudioBuffer<float> osc1Buffer;
+    juce::AudioBuffer<float> osc2Buffer;
+    juce::AudioBuffer<float> noiseBuffer;
+    juce::AudioBuffer<float> samplerBuffer;
+    juce::ADSR adsr;
+    ControlClock controlClock;
+    int pitch = 0;
+    int velocity = 0;
+    bool release = false;
+    int startSample = 0;    /// where the note-on landed in the current block
+    int releaseSample = -1; /// where the note-off landed in the current block, -1 if it didn't
+    
+    float osc1Vol = 0.f;
+    float osc2Vol = 0.f;
+    float noiseVol = 0.f;
+    float samplerVol = 0.f;
+};
+
+/// Owns every GlobalVoice and makes the allocate / steal / free decisions once per note for all four sources.
+/// The voice count is fixed when prepareToPlay() allocates the storage, so nothing here allocates on the audio thread.
+
+class VoiceManager {
+public:
+    static constexpr int MAX_VOICES = 64;
+    static constexpr int DEFAULT_VOICES = 16;
+    
+    VoiceManager() = default;
+    ~VoiceManager() = default;
+    /// Takes effect on the next prepareToPlay(), clamped to 1 - MAX_VOICES
+    void setPolyphony(int numVoices);
+    int getPolyphony() const { return requestedVoices; }
+    void prepareToPlay(juce::dsp::ProcessSpec spec);
+    void beginBlock(int numChannels, int numSamples);
+    GlobalVoice* noteOn(int note, int vel, int sample, const juce::ADSR::Parameters& params);
+    void noteOff(int note, int sample);
+    void allNotesOff(int sample);
+    void setADSRParameters(const juce::ADSR::Parameters& params);
+    void releaseFinished();
+    int getNumActive() { return numActive; }
+    GlobalVoice& getVoice(int i) { return *active[i]; }
+    
+private:
+    void free(int activeIndex);
+    
+    std::atomic<int> requestedVoices { DEFAULT_VOICES };
+    int numVoices = 0;
+    std::unique_ptr<GlobalVoice[]> voices;
+    std::vector<GlobalVoice*> freeList;
+    std::vector<GlobalVoice*> active; /// in note-on order, so the oldest voice is always active[0]
+    int numFree = 0;
+    int numActive = 0;
+    int blockChannels = 2;
+    int blockSamples = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef Colin_WavetableData_H
+#define Colin_WavetableData_H
+
+#include <array>
+
+/*
+  ==============================================================================
+
+    WavetableData.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+namespace WavetableData
+{
+
+/// The drawn tables, defined in WavetableData.cpp. Aligned to a cache line so a table never straddles one more than
+/// it has to and SIMD loads from the start of it are aligned
+constexpr int LENGTH = 1024;
+using Table = std::array<float, LENGTH>;
+
+alignas(64) extern const Table triangle;
+alignas(64) extern const Table square;
+alignas(64) extern const Table fourtyFour;
+alignas(64) extern const Table echo;
+alignas(64) extern const Table juliett;
+alignas(64) extern const Table crayon;
+alignas(64) extern const Table gritty;
+alignas(64) extern const Table airCon;
+alignas(64) extern const Table airCan;
+
+}
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    WavetableMipmap.cpp
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+#include "WavetableMipmap.h"
+
+namespace Colin
+{
+
+static_assert(WavetableMipmap::LENGTH == 1 << 10, "the FFT order below assumes 1024 sample tables");
+
+WavetableMipmap::WavetableMipmap(const std::vector<float>& table)
+: levels(static_cast<size_t>(NUM_LEVELS * STRIDE), 0.f)
+{
+    jassert(table.size() == static_cast<size_t>(LENGTH));
+    juce::dsp::FFT fft(10);
+    std::vector<float> spectrum(static_cast<size_t>(2 * LENGTH), 0.f);
+    std::copy_n(table.begin(), juce::jmin(table.size(), spectrum.size() / 2), spectrum.begin());
+    fft.performRealOnlyForwardTransform(spectrum.data(), true);
+
+    std::vector<float> level(static_cast<size_t>(2 * LENGTH));
+    for(int k=0; k<NUM_LEVELS; k++) {
+        /// Harmonic h read at an increment of 2^k lands at h * 2^k / 1024 of the sample rate, it has to stay under half
+        const int highest = (LENGTH / 2 >> k) - 1;
+        std::fill(level.begin(), level.end(), 0.f);
+        for(int h=0; h<=highest; h++) {
+            const size_t re = static_cast<size_t>(2 * h);
+            level[re] = spectrum[re];
+            level[re + 1] = spectrum[re + 1];
+            /// The mirrored bin, in case the FFT engine doesn't rebuild the negative frequencies itself
+            if(h > 0) {
+                const size_t mirror = static_cast<size_t>(2 * (LENGTH - h));
+                level[mirror] = spectrum[re];
+                level[mirror + 1] = -spectrum[re + 1];
+            }
+        }
+        fft.performRealOnlyInverseTransform(level.data());
+
+        float* destination = levels.data() + offset(k);
+        std::copy_n(level.begin(), LENGTH, destination);
+        for(int i = 1; i <= GUARD_BEFORE; i++) destination[-i] = destination[LENGTH - i];
+        for(int i = 0; i < GUARD_AFTER; i++) destination[LENGTH + i] = destination[i];
+    }
+}
+
+}
@@ -0,0 +1,71 @@
+#ifndef Colin_WavetableMipmap_H
+#define Colin_WavetableMipmap_H
+
+#include <cmath>
+#include <vector>
+#include <JuceHeader.h>
+#include "Interpolation.h"
+
+/*
+  ==============================================================================
+
+    WavetableMipmap.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+
+/// One oscillator table band-limited once per octave, so no pitch reads harmonics above Nyquist.
+///
+/// Level k keeps harmonics below 512 / 2^k, which is alias-free for any phase increment up to 2^k table samples per
+/// output sample. The increment alone picks the level, so a note keeps the same harmonics at 44.1 kHz and gets more at
+/// 96 or 192 kHz, and the read costs the same at any pitch. Between octaves the two levels that bracket the increment
+/// are crossfaded, so a glide or FM sweep changes brightness smoothly instead of stepping.
+///
+/// Built with an FFT from a 1024 sample table when a Synth is made, never on the audio thread. Every level is stored
+/// back to back with the points either side of it that the widest Interpolation reads copied from the other end, so
+/// reading never wraps.
+
+class WavetableMipmap {
+public:
+    static constexpr int LENGTH = 1024;
+    static constexpr int NUM_LEVELS = 9;  /// the last level is the fundamental alone
+    static constexpr int GUARD_BEFORE = Interpolator::TAPS_BEFORE;
+    static constexpr int GUARD_AFTER = Interpolator::TAPS_AFTER;
+    static constexpr int STRIDE = GUARD_BEFORE + LENGTH + GUARD_AFTER;
+
+    /// Where the first sample of each of the two levels for an increment is in data(), and how far to fade from the
+    /// first to the second
+    struct Selection {
+        int first = 0;
+        int second = 0;
+        float fade = 0.f;
+    };
+
+    WavetableMipmap() = default;
+    explicit WavetableMipmap(const std::vector<float>& table);
+
+    /// Level ceil(log2(increment)) fading into the next one up, so both are alias-free
+    static Selection select(float increment) {
+        if(!(increment > 0.5f)) return { GUARD_BEFORE, GUARD_BEFORE, 0.f };
+        const float position = std::log2(increment);
+        const int level = juce::jmax(0, static_cast<int>(std::ceil(position)));
+        if(level >= NUM_LEVELS - 1) return { offset(NUM_LEVELS - 1), offset(NUM_LEVELS - 1), 0.f };
+        return { offset(level), offset(level + 1), juce::jlimit(0.f, 1.f, position - static_cast<float>(level - 1)) };
+    }
+
+    const float* data() const { return levels.data(); }
+    bool isEmpty() const { return levels.empty(); }
+
+private:
+    static constexpr int offset(int level) { return level * STRIDE + GUARD_BEFORE; }
+
+    std::vector<float> levels;
+};
+
+}
+
+#endif
@@ -12,17 +12,61 @@
 
 namespace Colin {
 
-WavetableOscillator::WavetableOscillator(std::vector<float> wavetable, double sampleRate, int midi)
-: wavetable{std::move(wavetable)}, sampleRate{sampleRate}, midi{midi}
-{}
+namespace {
+
+constexpr float PHASE_ONE = static_cast<float>(1u << WavetableOscillator::FRACTION_BITS); /// one table sample
+
+/// A signed offset in table samples as a phase step. Offsets of a table or more wrap round like the phase does, so
+/// deep modulation at high notes keeps wrapping instead of flattening out. The offset is brought into [0, LENGTH]
+/// first, which keeps the conversion defined, and a full table comes out as 2^32 and wraps to 0
+std::uint32_t toPhase(float tableSamples) {
+    if(!std::isfinite(tableSamples)) return 0;
+    const double length = static_cast<double>(WavetableMipmap::LENGTH);
+    const double offset = static_cast<double>(tableSamples);
+    const double wrapped = offset - length * std::floor(offset / length);
+    return static_cast<std::uint32_t>(static_cast<std::uint64_t>(wrapped * static_cast<double>(PHASE_ONE)));
+}
+
+}
+
+WavetableOscillator::WavetableOscillator(const WavetableMipmap& mipmap, double sampleRate, int midi)
+: mipmap{&mipmap}, sampleRate{sampleRate}, midi{midi}
+{
+    selectLevels();
+}
+
+void WavetableOscillator::prepare(double sampleRate) {
+    this->sampleRate = sampleRate;
+}
+
+/// Only points at the mipmap, so changing oscillator type on the audio thread copies nothing
+void WavetableOscillator::setWavetable(const WavetableMipmap& newMipmap) {
+    mipmap = &newMipmap;
+    selectLevels();
+}
+
+void WavetableOscillator::reset() {
+    phase = 0;
+}
 
 void WavetableOscillator::setFrequency(float frequency) {
     freq = frequency;
-    indexIncrement = frequency * static_cast<float>(wavetable.size()) / static_cast<float>(sampleRate);
+    setIncrement(frequency * TABLE_SIZE / static_cast<float>(sampleRate));
+}
+
+/// Anything up to the whole table per sample fits the 32-bit phase step
+void WavetableOscillator::setIncrement(float increment) {
+    indexIncrement = juce::jlimit(0.f, TABLE_SIZE - 1.f, increment);
+    phaseIncrement = toPhaseIncrement(indexIncrement);
+    selectLevels();
+}
+
+std::uint32_t WavetableOscillator::toPhaseIncrement(float increment) {
+    return static_cast<std::uint32_t>(static_cast<double>(juce::jlimit(0.f, TABLE_SIZE - 1.f, increment)) * PHASE_ONE + 0.5);
 }
 
 void WavetableOscillator::isNoise() {
-    indexIncrement = 1;
+    setIncrement(1.f);
 }
 
 void WavetableOscillator::setPitch(int midi) {
@@ -44,44 +88,123 @@ float WavetableOscillator::midiToFreq(int midiNote)
     return A4_FREQ * std::powf(2, (static_cast<float>(midiNote) - A4_MIDINOTE) / NOTES_IN_OCTAVE);
 }
 
+/// The carrier's pitch moves every sample under FM, so its level does too
 void WavetableOscillator::setFM(float modSample) {
     float newFreq = freq + modSample;
     if (newFreq < 0) newFreq = std::abs(newFreq);
     if (newFreq > (sampleRate / 2)) newFreq = newFreq - (sampleRate/2);
-    indexIncrement = newFreq * static_cast<float>(wavetable.size()) / static_cast<float>(sampleRate);
+    setIncrement(newFreq * TABLE_SIZE / static_cast<float>(sampleRate));
 }
 
 void WavetableOscillator::setPM(float modSample) {
-    index += modSample * indexIncrement;
-    while(index < 0) index = wavetable.size() + index;
+    phase += toPhase(modSample * indexIncrement);
 }
 
 float WavetableOscillator::getSample() {
-    auto sample = interpolateLinearly();
-    index += indexIncrement;
-    index = std::fmod(index, static_cast<float>(wavetable.size()));
+    auto sample = interpolate();
+    phase += phaseIncrement;
     return sample;
 }
 
+void WavetableOscillator::renderBlock(float* out, int numSamples) {
+    render<false>(out, nullptr, 0.f, numSamples);
+}
+
+void WavetableOscillator::renderBlockPM(float* out, const float* mod, float depth, int numSamples) {
+    render<true>(out, mod, depth, numSamples);
+}
+
+/// Picks the loop for the interpolation and whether the levels crossfade once, outside it
+template <bool modulated>
+void WavetableOscillator::render(float* out, const float* mod, float depth, int numSamples) {
+    if(level == nullptr) {
+        std::fill(out, out + numSamples, 0.f);
+        return;
+    }
+    const bool crossfade = levelFade != 0.f;
+    switch(interpolation) {
+        case Interpolation::draft:
+            if(crossfade) renderLoop<Interpolation::draft, true, modulated>(out, mod, depth, numSamples);
+            else renderLoop<Interpolation::draft, false, modulated>(out, mod, depth, numSamples);
+            break;
+        case Interpolation::hermite:
+            if(crossfade) renderLoop<Interpolation::hermite, true, modulated>(out, mod, depth, numSamples);
+            else renderLoop<Interpolation::hermite, false, modulated>(out, mod, depth, numSamples);
+            break;
+        case Interpolation::sinc:
+            if(crossfade) renderLoop<Interpolation::sinc, true, modulated>(out, mod, depth, numSamples);
+            else renderLoop<Interpolation::sinc, false, modulated>(out, mod, depth, numSamples);
+            break;
+        case Interpolation::linear:
+        case Interpolation::end:
+            if(crossfade) renderLoop<Interpolation::linear, true, modulated>(out, mod, depth, numSamples);
+            else renderLoop<Interpolation::linear, false, modulated>(out, mod, depth, numSamples);
+            break;
+    }
+}
+
+/// The same arithmetic as getSample()
+template <Interpolation quality, bool crossfade, bool modulated>
+void WavetableOscillator::renderLoop(float* out, const float* mod, float depth, int numSamples) {
+    const float* a = level;
+    const float* b = nextLevel;
+    const float fade = levelFade;
+    const float modScale = depth * indexIncrement;
+    std::uint32_t p = phase;
+    for(int i = 0; i < numSamples; i++) {
+        if constexpr (modulated) p += toPhase(mod[i] * modScale);
+        const int index = static_cast<int>(p >> FRACTION_BITS); /// int, the taps can be negative offsets
+        const float fraction = static_cast<float>(p & FRACTION_MASK) * FRACTION_SCALE;
+        const float* row = Interpolator::sincRow(fraction);
+        auto coefficient = [row](int k) { return row[k]; };
+        const float first = Interpolator::read<quality>([a, index](int k) { return a[index + k]; }, coefficient, fraction);
+        if constexpr (crossfade) {
+            const float second = Interpolator::read<quality>([b, index](int k) { return b[index + k]; }, coefficient, fraction);
+            out[i] = first + fade * (second - first);
+        }
+        else {
+            out[i] = first;
+        }
+        p += phaseIncrement;
+    }
+    phase = p;
+}
+
+/// Advances the phase by numSamples without reading the table, the multiply wraps exactly as many steps would
+void WavetableOscillator::skip(int numSamples) {
+    phase += phaseIncrement * static_cast<std::uint32_t>(numSamples);
+}
+
 float WavetableOscillator::getSampleRaw() {
-    auto sample = wavetable[index];
-    index += indexIncrement;
-    index = std::fmod(index, static_cast<float>(wavetable.size()));
+    auto sample = level != nullptr ? level[phase >> FRACTION_BITS] : 0.f;
+    phase += phaseIncrement;
     return sample;
 }
 
-float WavetableOscillator::interpolateLinearly() {
-    const auto truncatedIndex = static_cast<int>(index) % static_cast<int>(wavetable.size());
-    const auto nextIndex = (truncatedIndex + 1) % static_cast<int>(wavetable.size());
-    const auto nextIndexWeight = index - static_cast<float>(truncatedIndex);
-    const auto truncatedIndexWeight = 1.f - nextIndexWeight;
-    
-    return truncatedIndexWeight * wavetable[truncatedIndex] + nextIndexWeight * wavetable[nextIndex];
+/// Each level has guard points either side, so the taps never wrap. The crossfade is written the way the OscillatorBank computes it, so the
+/// two agree
+float WavetableOscillator::interpolate() {
+    if(level == nullptr) return 0.f;
+    const auto index = static_cast<int>(phase >> FRACTION_BITS);
+    const auto fraction = static_cast<float>(phase & FRACTION_MASK) * FRACTION_SCALE;
+
+    const float first = Interpolator::read(interpolation, [this, index](int k) { return level[index + k]; }, fraction);
+    if(levelFade == 0.f) return first;
+    const float second = Interpolator::read(interpolation, [this, index](int k) { return nextLevel[index + k]; }, fraction);
+    return first + levelFade * (second - first);
+}
+
+void WavetableOscillator::selectLevels() {
+    if(mipmap == nullptr || mipmap->isEmpty()) return;
+    const auto selection = WavetableMipmap::select(indexIncrement);
+    level = mipmap->data() + selection.first;
+    nextLevel = mipmap->data() + selection.second;
+    levelFade = selection.fade;
 }
 
 void WavetableOscillator::stop() {
-    index = 0.f;
-    indexIncrement = 0.f;
+    phase = 0;
+    setIncrement(0.f);
 }
 
 bool WavetableOscillator::isPlaying() {
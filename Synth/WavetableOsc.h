@@ -12,38 +12,81 @@
 #define Colin_WOSC_H
 
 #include <cmath>
+#include <cstdint>
 #include <vector>
 #include "JuceHeader.h"
+#include "WavetableMipmap.h"
 
 namespace Colin
 {
 
+/// Reads a WavetableMipmap, choosing the band-limited level from the phase increment whenever the pitch changes.
+/// The mipmap belongs to the Synth and outlives every oscillator reading it.
+///
+/// The phase is 32-bit fixed point: the top 10 bits are the table index and the other 22 the fraction, so it wraps
+/// by overflowing, never drifts however long the note, and the render loops have no fmod or branches in them
+
 class WavetableOscillator
 {
 public:
-    WavetableOscillator(std::vector<float> wavetable, double sampleRate, int midi);
+    WavetableOscillator() = default;
+    WavetableOscillator(const WavetableMipmap& mipmap, double sampleRate, int midi);
+    void prepare(double sampleRate);
+    void setWavetable(const WavetableMipmap& newMipmap);
+    void reset();
     void setFrequency(float frequency);
     void setPitch(int midi);
     void setFM(float modSample);
     void setPM(float modSample);
     void isNoise();
     float getSample();
+    /// Writes numSamples samples to out. The PM version adds mod[i] * depth periods of the carrier's increment to the
+    /// phase before each sample, like setPM() then getSample()
+    void renderBlock(float* out, int numSamples);
+    void renderBlockPM(float* out, const float* mod, float depth, int numSamples);
+    void skip(int numSamples);
     float getSampleRaw();
-    float interpolateLinearly();
+    float interpolate();
+    void setInterpolation(Interpolation quality) { interpolation = quality; }
+    Interpolation getInterpolation() const { return interpolation; }
     void stop();
     bool isPlaying();
     float midiToFreq(int midiNote);
     float getFrequency();
     
+    static constexpr int FRACTION_BITS = 22;
+    static constexpr std::uint32_t FRACTION_MASK = (1u << FRACTION_BITS) - 1;
+    static constexpr float FRACTION_SCALE = 1.f / static_cast<float>(1u << FRACTION_BITS);
+    static_assert(WavetableMipmap::LENGTH == 1 << (32 - FRACTION_BITS), "the index is the phase's top bits");
+    
+    /// For the OscillatorBank, which renders many oscillators' phases at once
+    std::uint32_t getPhase() const { return phase; }
+    void setPhase(std::uint32_t newPhase) { phase = newPhase; }
+    std::uint32_t getPhaseIncrement() const { return phaseIncrement; }
+    float getIncrement() const { return indexIncrement; }
+    /// An increment in table samples as the fixed-point phase step, clamped to what fits, for Unison's copies
+    static std::uint32_t toPhaseIncrement(float increment);
+    static constexpr float TABLE_SIZE = static_cast<float>(WavetableMipmap::LENGTH);
+    
 private:
-    std::vector<float> wavetable;
-    double sampleRate;
-    float index = 0.f;
-    float indexIncrement = 0.f;
+    void setIncrement(float increment);
+    void selectLevels();
+    template <bool modulated> void render(float* out, const float* mod, float depth, int numSamples);
+    template <Interpolation quality, bool crossfade, bool modulated> void renderLoop(float* out, const float* mod, float depth, int numSamples);
+    
+    const WavetableMipmap* mipmap = nullptr;
+    const float* level = nullptr;     /// the two band-limited levels for the current increment
+    const float* nextLevel = nullptr;
+    float levelFade = 0.f;
+    Interpolation interpolation = Interpolation::linear;
+    double sampleRate = 44100;
+    std::uint32_t phase = 0;
+    std::uint32_t phaseIncrement = 0;
+    float indexIncrement = 0.f; /// in table samples, picks the mipmap levels
     bool oversample = false;
     float prevSample = 0.f;
-    int midi;
-    float freq;
+    int midi = 0;
+    float freq = 0.f;
 };
 
 }
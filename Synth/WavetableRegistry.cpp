@@ -0,0 +1,40 @@
+/*
+  ==============================================================================
+
+    WavetableRegistry.cpp
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+#include "WavetableRegistry.h"
+#include "WavetableVectors.h"
+
+namespace Colin
+{
+
+WavetableRegistry::WavetableRegistry() {
+    for(int type = static_cast<int>(Oscillator_Type::sine); type < static_cast<int>(Oscillator_Type::end); type++) {
+        tables.push_back(makeTable(static_cast<Oscillator_Type>(type)));
+        mipmaps.emplace_back(tables.back());
+    }
+}
+
+std::vector<float> WavetableRegistry::makeTable(Oscillator_Type oscType) {
+    switch(oscType) {
+        case Oscillator_Type::sine: return sineWavetable();
+        case Oscillator_Type::triangle: return triangleWavetable();
+        case Oscillator_Type::saw: return sawWavetable();
+        case Oscillator_Type::square: return squareWavetable();
+        case Oscillator_Type::fourtyFour: return fourtyFour();
+        case Oscillator_Type::echo: return echo();
+        case Oscillator_Type::juliett: return juliett();
+        case Oscillator_Type::crayon: return crayon();
+        case Oscillator_Type::gritty: return gritty();
+        case Oscillator_Type::end: break;
+    }
+    jassertfalse;
+    return sineWavetable();
+}
+
+}
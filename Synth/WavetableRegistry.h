@@ -0,0 +1,50 @@
+#ifndef Colin_WavetableRegistry_H
+#define Colin_WavetableRegistry_H
+
+#include <vector>
+#include <JuceHeader.h>
+#include "WavetableMipmap.h"
+#include "Voice.h"
+
+/*
+  ==============================================================================
+
+    WavetableRegistry.h
+    Author:  Colin Raab
+
+  ==============================================================================
+*/
+
+namespace Colin
+{
+
+/// Every oscillator table and its mipmap, built once for the whole process and read-only from then on.
+/// Hold it through juce::SharedResourcePointer<WavetableRegistry>: the first Synth of the first plugin instance builds
+/// it, every other Synth and instance shares it, and it goes when the last one does. Oscillators keep only pointers
+/// into it, so a note-on or a change of oscillator type never builds or copies a table.
+
+class WavetableRegistry {
+public:
+    WavetableRegistry();
+
+    const WavetableMipmap& getMipmap(Oscillator_Type type) const { return mipmaps[index(type)]; }
+
+    /// The table as drawn, before band-limiting, for the UI
+    const std::vector<float>& getTable(Oscillator_Type type) const { return tables[index(type)]; }
+
+private:
+    static size_t index(Oscillator_Type type) {
+        jassert(type >= Oscillator_Type::sine && type < Oscillator_Type::end);
+        return static_cast<size_t>(type) - static_cast<size_t>(Oscillator_Type::sine);
+    }
+    static std::vector<float> makeTable(Oscillator_Type type);
+
+    std::vector<std::vector<float>> tables;
+    std::vector<WavetableMipmap> mipmaps;
+
+    JUCE_DECLARE_NON_COPYABLE(WavetableRegistry)
+};
+
+}
+
+#endif
@@ -13,8 +13,10 @@
 
 #include <vector>
 #include <random>
+#include "WavetableData.h"
 
 // this is a bunch of wavetable vectors borrowed from a variety of places
+// the drawn tables are stored once, in WavetableData.cpp
 
 //static const int WAVETABLE_LENGTH = 1024;
 
@@ -61,102 +63,39 @@ static std::vector<float> sawWavetable() {
 }
 
 static std::vector<float> triangleWavetable() {
-    std::vector<float> w({0.0243699625134468, -0.0274505354464054, -0.0226974580436945, -0.0177311031147838, -0.0131087554618716, -0.00829318212345243, -0.00347421434707940, 0.00137152371462435, 0.00598581228405237, 0.0106437369249761, 0.0153727745637298, 0.0202061040326953, 0.0248257322236896, 0.0294210910797119, 0.0339856911450625, 0.0385603681206703, 0.0431575793772936, 0.0477342959493399, 0.0521425511687994, 0.0566452033817768, 0.0610627587884665, 0.0655274651944637, 0.0700302310287952, 0.0745850317180157, 0.0792450122535229, 0.0836101323366165, 0.0880478248000145, 0.0924694165587425, 0.0970745012164116, 0.101401317864656, 0.105849515646696, 0.110165834426880, 0.114579051733017, 0.119204431772232, 0.123433876782656, 0.127696044743061, 0.132186554372311, 0.136667609214783, 0.140879034996033, 0.145366303622723, 0.149644285440445, 0.153922893106937, 0.158139400184155, 0.162419825792313, 0.166720837354660, 0.171056024730206, 0.175436623394489, 0.179606378078461, 0.183909252285957, 0.188371688127518, 0.192413404583931, 0.196571968495846, 0.200973317027092, 0.205124549567699, 0.209156513214111, 0.213292688131332, 0.217564187943935, 0.221710182726383, 0.225801743566990, 0.229976356029511, 0.234072588384151, 0.238157711923122, 0.242182083427906, 0.246363110840321, 0.250414110720158, 0.254385113716126, 0.258335009217262, 0.262547433376312, 0.266560405492783, 0.270520001649857, 0.274571031332016, 0.278566882014275, 0.282561734318733, 0.286724016070366, 0.290737524628639, 0.294603705406189, 0.298612341284752, 0.302555561065674, 0.306491643190384, 0.310293942689896, 0.314113155007362, 0.317998453974724, 0.321856409311295, 0.325848713517189, 0.329570502042770, 0.333375260233879, 0.337008610367775, 0.340903654694557, 0.344839915633202, 0.348454222083092, 0.352181583642960, 0.356047824025154, 0.359774008393288, 0.363461762666702, 0.367209643125534, 0.370908379554749, 0.374607011675835, 0.378288835287094, 0.382040888071060, 0.385549217462540, 0.389031797647476, 0.392492651939392, 0.396024659276009, 0.399643048644066, 0.403232991695404, 0.406676769256592, 0.410143554210663, 0.413659706711769, 0.417314961552620, 0.421049386262894, 0.424455195665360, 0.427908927202225, 0.431303456425667, 0.434841975569725, 0.438239559531212, 0.441499009728432, 0.444965839385986, 0.448357984423637, 0.451616495847702, 0.454940393567085, 0.458483815193176, 0.461834579706192, 0.465305730700493, 0.468658939003944, 0.471819609403610, 0.475170716643333, 0.478515386581421, 0.481830045580864, 0.485134974122047, 0.488396242260933, 0.491562202572823, 0.494967475533485, 0.498232901096344, 0.501401573419571, 0.504607439041138, 0.507788300514221, 0.510870814323425, 0.514093756675720, 0.517237305641174, 0.520342528820038, 0.523382991552353, 0.526464253664017, 0.529530256986618, 0.532526642084122, 0.535603702068329, 0.538717567920685, 0.541806846857071, 0.544875115156174, 0.547818243503571, 0.550723999738693, 0.553983122110367, 0.557181596755981, 0.560103118419647, 0.563159734010696, 0.566286563873291, 0.569336831569672, 0.572276890277863, 0.575191408395767, 0.578370511531830, 0.581302314996719, 0.584527224302292, 0.587440252304077, 0.590328216552734, 0.593234300613403, 0.596213489770889, 0.599466949701309, 0.602188318967819, 0.605047017335892, 0.607957035303116, 0.610829204320908, 0.613676518201828, 0.616335690021515, 0.619139403104782, 0.621951878070831, 0.624564081430435, 0.627242058515549, 0.629800856113434, 0.632687360048294, 0.635323733091354, 0.637895673513413, 0.640737950801849, 0.643397986888886, 0.646054357290268, 0.648551315069199, 0.651406675577164, 0.653971552848816, 0.656771570444107, 0.659285783767700, 0.661999493837357, 0.664859950542450, 0.667301833629608, 0.669811546802521, 0.672474265098572, 0.674977004528046, 0.677556902170181, 0.680004268884659, 0.682642072439194, 0.685266405344009, 0.688016325235367, 0.690586984157562, 0.692991316318512, 0.695515871047974, 0.697998344898224, 0.700556725263596, 0.703111916780472, 0.705702096223831, 0.708127021789551, 0.710536360740662, 0.713242053985596, 0.715850830078125, 0.718402236700058, 0.720876514911652, 0.723434180021286, 0.725858926773071, 0.728514492511749, 0.731344699859619, 0.733955800533295, 0.736411631107330, 0.739019066095352, 0.741464167833328, 0.743974983692169, 0.746442288160324, 0.748952031135559, 0.751318693161011, 0.753750681877136, 0.756142288446426, 0.758456945419312, 0.760831922292709, 0.763278514146805, 0.765654623508453, 0.768176764249802, 0.770633369684219, 0.772455960512161, 0.774515002965927, 0.776464492082596, 0.778644174337387, 0.780883550643921, 0.783101886510849, 0.785369604825974, 0.787848979234695, 0.789895415306091, 0.791881442070007, 0.794181406497955, 0.796599149703980, 0.798919081687927, 0.801288217306137, 0.803350269794464, 0.805610239505768, 0.807758480310440, 0.810108125209808, 0.812582194805145, 0.814864575862885, 0.817189633846283, 0.819529056549072, 0.821754097938538, 0.824118822813034, 0.826156884431839, 0.828218579292297, 0.830568611621857, 0.832885891199112, 0.834830671548843, 0.836811751127243, 0.838705182075501, 0.840613484382629, 0.842642575502396, 0.844964087009430, 0.846932739019394, 0.848691105842590, 0.850872516632080, 0.853244364261627, 0.855416446924210, 0.857410192489624, 0.859457701444626, 0.861508846282959, 0.863775879144669, 0.865797489881516, 0.867740660905838, 0.869576930999756, 0.871646016836166, 0.873573333024979, 0.875541031360626, 0.877668797969818, 0.879761695861816, 0.884073257446289, 0.885823458433151, 0.888630121946335, 0.891658693552017, 0.895276784896851, 0.898525953292847, 0.901388913393021, 0.904047727584839, 0.906609892845154, 0.908701568841934, 0.910908579826355, 0.912854284048080, 0.914894372224808, 0.916732460260391, 0.918363898992539, 0.920269012451172, 0.921964645385742, 0.923522382974625, 0.925485998392105, 0.927189379930496, 0.928886473178864, 0.930519849061966, 0.932280719280243, 0.933705270290375, 0.935614734888077, 0.937443643808365, 0.939207136631012, 0.940722078084946, 0.942472994327545, 0.944159060716629, 0.945950061082840, 0.948008596897125, 0.949411004781723, 0.951280683279038, 0.952934354543686, 0.954723060131073, 0.956560403108597, 0.958045005798340, 0.959724545478821, 0.961499363183975, 0.963340491056442, 0.965122252702713, 0.966889411211014, 0.968312233686447, 0.969900816679001, 0.971563905477524, 0.973389983177185, 0.975131034851074, 0.976544290781021, 0.978154391050339, 0.979337424039841, 0.980802714824677, 0.981954216957092, 0.983284682035446, 0.984562247991562, 0.985739290714264, 0.987171620130539, 0.988244742155075, 0.989126354455948, 0.990148991346359, 0.990287780761719, 0.990703523159027, 0.990735769271851, 0.990105122327805, 0.989404618740082, 0.988038301467896, 0.985945641994476, 0.983636856079102, 0.980541795492172, 0.977304637432098, 0.973767131567001, 0.969936311244965, 0.965869754552841, 0.961176484823227, 0.956349402666092, 0.951281905174255, 0.946017205715179, 0.940388441085815, 0.934661120176315, 0.928814411163330, 0.922917395830154, 0.916927665472031, 0.910900384187698, 0.904516577720642, 0.898154854774475, 0.892102718353272, 0.885551631450653, 0.878941833972931, 0.872460275888443, 0.865958303213120, 0.859157681465149, 0.852533429861069, 0.845878809690476, 0.839435696601868, 0.832746297121048, 0.825895667076111, 0.819235265254974, 0.812439233064652, 0.805651724338532, 0.798716127872467, 0.792193949222565, 0.784940689802170, 0.778011828660965, 0.771128177642822, 0.764119118452072, 0.757342070341110, 0.750432014465332, 0.743624716997147, 0.736856579780579, 0.729819178581238, 0.722574353218079, 0.715068578720093, 0.707850366830826, 0.700807869434357, 0.693714827299118, 0.686739355325699, 0.679602861404419, 0.672901898622513, 0.665919721126556, 0.658781200647354, 0.652220755815506, 0.645598381757736, 0.639043331146240, 0.632209181785584, 0.625297248363495, 0.618553817272186, 0.611868470907211, 0.605243951082230, 0.598692864179611, 0.592242240905762, 0.585617363452911, 0.579309344291687, 0.572653234004974, 0.566057354211807, 0.559535950422287, 0.552805334329605, 0.546356737613678, 0.539844214916229, 0.533250391483307, 0.526237279176712, 0.519715636968613, 0.513237655162811, 0.506679505109787, 0.500172942876816, 0.493725016713142, 0.487017378211021, 0.480861991643906, 0.474496409296989, 0.468271225690842, 0.462002307176590, 0.455773517489433, 0.449261397123337, 0.443076536059380, 0.436768084764481, 0.430306732654572, 0.423894435167313, 0.417580291628838, 0.411504819989204, 0.405033245682716, 0.398892298340797, 0.392771482467651, 0.386696085333824, 0.380335152149200, 0.374355912208557, 0.368292838335037, 0.362290844321251, 0.356210187077522, 0.350153774023056, 0.344131097197533, 0.337951168417931, 0.331686705350876, 0.325575351715088, 0.319735884666443, 0.313757404685020, 0.307438597083092, 0.301660954952240, 0.295675054192543, 0.289565384387970, 0.283650845289230, 0.277995899319649, 0.271873444318771, 0.266039878129959, 0.260455518960953, 0.254821598529816, 0.249062761664391, 0.243400134146214, 0.237468704581261, 0.231797382235527, 0.226019911468029, 0.220193825662136, 0.214518442749977, 0.208881534636021, 0.203264527022839, 0.197454817593098, 0.191633507609367, 0.186053805053234, 0.180356718599796, 0.174502007663250, 0.169007137417793, 0.163318425416946, 0.157394602894783, 0.151575036346912, 0.146179519593716, 0.140485920011997, 0.134911283850670, 0.129399552941322, 0.123770017176867, 0.118409991264343, 0.113107677549124, 0.107541624456644, 0.102172449231148, 0.0965990535914898, 0.0913635566830635, 0.0862745866179466, 0.0809698663651943, 0.0756748095154762, 0.0704322531819344, 0.0653241910040379, 0.0600722674280405, 0.0548807643353939, 0.0498063731938601, 0.0444921050220728, 0.0394703913480043, 0.0344423949718475, 0.0293758688494563, 0.0244386270642281, 0.0192202068865299, 0.0141859701834619, 0.00908469781279564, 0.00414230767637491, -0.000970433873590082, -0.00600191811099649, -0.0111806821078062, -0.0161816440522671, -0.0211753193289042, -0.0260171163827181, -0.0310838529840112, -0.0360274817794561, -0.0410035736858845, -0.0457689408212900, -0.0506682693958283, -0.0555299408733845, -0.0603558942675591, -0.0652515478432179, -0.0701393261551857, -0.0748920403420925, -0.0797189101576805, -0.0845429860055447, -0.0890901461243630, -0.0938458293676376, -0.0986065752804279, -0.103501245379448, -0.108317650854588, -0.112868007272482, -0.117446862161160, -0.121992658823729, -0.126665763556957, -0.131220810115337, -0.135857224464417, -0.140241488814354, -0.144939713180065, -0.149483941495419, -0.154211029410362, -0.158600054681301, -0.163067795336247, -0.167664051055908, -0.172122277319431, -0.176525793969631, -0.180937200784683, -0.185538522899151, -0.189844556152821, -0.194400176405907, -0.198904618620873, -0.203315757215023, -0.207694567739964, -0.211943760514259, -0.216350607573986, -0.220840685069561, -0.225059464573860, -0.229394868016243, -0.233725167810917, -0.238026447594166, -0.242161393165588, -0.246167741715908, -0.250446930527687, -0.254524618387222, -0.258597642183304, -0.262878283858299, -0.267163872718811, -0.271178543567657, -0.275391563773155, -0.279465332627296, -0.283311828970909, -0.287543192505837, -0.291645184159279, -0.295663267374039, -0.299684941768646, -0.303731024265289, -0.307526350021362, -0.311497449874878, -0.315492764115334, -0.319435358047485, -0.323302268981934, -0.327125191688538, -0.331078961491585, -0.334991827607155, -0.338942810893059, -0.342901244759560, -0.346674531698227, -0.350627154111862, -0.354439824819565, -0.358214184641838, -0.362046673893929, -0.365849152207375, -0.369496241211891, -0.373412534594536, -0.377283945679665, -0.380981206893921, -0.384604141116142, -0.388547822833061, -0.392148911952972, -0.395829766988754, -0.399635970592499, -0.403231576085091, -0.406832084059715, -0.410640850663185, -0.414371386170387, -0.417909413576126, -0.421511068940163, -0.425043269991875, -0.428472876548767, -0.432143166661263, -0.435801029205322, -0.439351305365562, -0.442822083830833, -0.446262151002884, -0.449736803770065, -0.453131616115570, -0.456622645258904, -0.459982603788376, -0.463466450572014, -0.466781243681908, -0.470213219523430, -0.473684147000313, -0.477078944444656, -0.480585709214211, -0.483891710639000, -0.487073421478272, -0.490317732095718, -0.493705570697784, -0.496858760714531, -0.500195309519768, -0.503545045852661, -0.506739974021912, -0.510080277919769, -0.513438403606415, -0.516561269760132, -0.519698470830917, -0.522948652505875, -0.525998979806900, -0.529259145259857, -0.532596796751022, -0.535720765590668, -0.538848370313644, -0.542175769805908, -0.545228183269501, -0.548090904951096, -0.551286756992340, -0.554417312145233, -0.557322949171066, -0.560153573751450, -0.563064515590668, -0.565892934799194, -0.568707585334778, -0.571621745824814, -0.574478179216385, -0.577347040176392, -0.580097645521164, -0.582750856876373, -0.585499882698059, -0.588173657655716, -0.590942859649658, -0.593771189451218, -0.596491962671280, -0.599124670028687, -0.601764768362045, -0.604344785213471, -0.607103526592255, -0.609820157289505, -0.612350523471832, -0.614987790584564, -0.617632657289505, -0.620452225208283, -0.623116075992584, -0.625662952661514, -0.628277719020844, -0.630802661180496, -0.633515357971191, -0.636044502258301, -0.638689368963242, -0.641199678182602, -0.643715083599091, -0.646360546350479, -0.648746758699417, -0.651130288839340, -0.653846830129623, -0.656292349100113, -0.658673852682114, -0.660904884338379, -0.663112401962280, -0.665418356657028, -0.667924344539642, -0.670347750186920, -0.672624826431274, -0.674902141094208, -0.677033245563507, -0.679476827383041, -0.681863129138947, -0.684055536985397, -0.686390578746796, -0.688500791788101, -0.690833419561386, -0.693029433488846, -0.695330411195755, -0.697321683168411, -0.699423670768738, -0.701626658439636, -0.703596085309982, -0.705669552087784, -0.707880020141602, -0.709952056407929, -0.712114304304123, -0.713849991559982, -0.715806812047958, -0.717872768640518, -0.719699442386627, -0.721600711345673, -0.723574727773666, -0.725337684154511, -0.727104216814041, -0.729217231273651, -0.731104195117950, -0.733001887798309, -0.734986662864685, -0.736913770437241, -0.738970041275024, -0.740798354148865, -0.742549270391464, -0.744541376829147, -0.746446251869202, -0.748185604810715, -0.750302255153656, -0.752115875482559, -0.754146844148636, -0.755952805280685, -0.757822364568710, -0.759620159864426, -0.761288195848465, -0.762984484434128, -0.764670968055725, -0.766419619321823, -0.767854750156403, -0.769473373889923, -0.771266371011734, -0.772821635007858, -0.774545580148697, -0.776185244321823, -0.777568846940994, -0.779048353433609, -0.780531644821167, -0.781841993331909, -0.783286929130554, -0.784772902727127, -0.786122560501099, -0.787686467170715, -0.789116978645325, -0.790538758039475, -0.791901141405106, -0.793403774499893, -0.794905722141266, -0.796240985393524, -0.797509133815765, -0.798867702484131, -0.800300180912018, -0.801719754934311, -0.803084403276444, -0.804478436708450, -0.805754840373993, -0.807145416736603, -0.808349758386612, -0.809618592262268, -0.810842543840408, -0.812091261148453, -0.813276797533035, -0.814503401517868, -0.815553426742554, -0.816676706075668, -0.817760467529297, -0.818779975175858, -0.819767922163010, -0.820841997861862, -0.822117447853088, -0.823107719421387, -0.824228733778000, -0.825405746698380, -0.826475143432617, -0.827307194471359, -0.828590929508209, -0.829727113246918, -0.830544292926788, -0.831490099430084, -0.832446396350861, -0.833392918109894, -0.834278106689453, -0.835231274366379, -0.835839718580246, -0.836792141199112, -0.837750077247620, -0.838476926088333, -0.839519083499908, -0.840341448783875, -0.841136544942856, -0.841924875974655, -0.842572897672653, -0.843347072601318, -0.844385951757431, -0.844939261674881, -0.845797061920166, -0.846427649259567, -0.847083151340485, -0.847815692424774, -0.848250716924667, -0.848902434110642, -0.849655747413635, -0.850050568580627, -0.850696206092835, -0.851261496543884, -0.852018207311630, -0.852441996335983, -0.852779895067215, -0.853235542774200, -0.853732109069824, -0.854303508996964, -0.854726314544678, -0.855041533708572, -0.855974823236466, -0.857288748025894, -0.864738941192627, -0.883993119001389, -0.910977303981781, -0.938244611024857, -0.961505562067032, -0.978652626276016, -0.989809721708298, -0.996328264474869, -0.999303877353668, -0.999949961900711, -0.998818695545197, -0.996454924345017, -0.993812948465347, -0.990860164165497, -0.987656325101852, -0.984188497066498, -0.980621099472046, -0.977210462093353, -0.973720788955689, -0.969610452651978, -0.965719848871231, -0.962094634771347, -0.958373576402664, -0.954441368579865, -0.950591713190079, -0.946657210588455, -0.942425072193146, -0.938760697841644, -0.934733837842941, -0.930827558040619, -0.926746994256973, -0.922599047422409, -0.918452978134155, -0.913990586996079, -0.909476429224014, -0.905191004276276, -0.900383621454239, -0.896052151918411, -0.891095995903015, -0.886334925889969, -0.881560325622559, -0.876482099294663, -0.871168583631516, -0.866214841604233, -0.860918164253235, -0.855875283479691, -0.850727975368500, -0.845563828945160, -0.840395808219910, -0.834806978702545, -0.829093426465988, -0.823727846145630, -0.818134218454361, -0.812619686126709, -0.806879460811615, -0.801344633102417, -0.795526325702667, -0.789728581905365, -0.784042209386826, -0.778400152921677, -0.772224336862564, -0.766544729471207, -0.760988742113113, -0.755034118890762, -0.749393731355667, -0.743719846010208, -0.737903535366058, -0.732142329216003, -0.726380556821823, -0.720358669757843, -0.714655429124832, -0.708923846483231, -0.702865511178970, -0.696918576955795, -0.690964639186859, -0.685087800025940, -0.679018855094910, -0.672795414924622, -0.667003810405731, -0.660751998424530, -0.654707252979279, -0.648461341857910, -0.641939312219620, -0.635334372520447, -0.629022032022476, -0.623023569583893, -0.616854250431061, -0.610764235258102, -0.604504525661469, -0.598463743925095, -0.592723906040192, -0.586873233318329, -0.580945014953613, -0.575045883655548, -0.569101631641388, -0.563435286283493, -0.557471424341202, -0.551706731319428, -0.545869916677475, -0.540217727422714, -0.534549385309219, -0.528768658638001, -0.523192793130875, -0.517320513725281, -0.511470049619675, -0.505525171756744, -0.499791949987412, -0.494155377149582, -0.488276481628418, -0.482476353645325, -0.476723924279213, -0.470885276794434, -0.465047895908356, -0.459424406290054, -0.453695252537727, -0.447865724563599, -0.442080140113831, -0.436449751257896, -0.430532678961754, -0.425100654363632, -0.419532358646393, -0.413814425468445, -0.408179163932800, -0.402610540390015, -0.397041916847229, -0.391537144780159, -0.386088654398918, -0.380326956510544, -0.374827206134796, -0.369177192449570, -0.363706067204475, -0.358213499188423, -0.352696061134338, -0.347131833434105, -0.341778069734573, -0.336239740252495, -0.331099539995194, -0.325628340244293, -0.320115953683853, -0.314615115523338, -0.309141576290131, -0.303899288177490, -0.298516646027565, -0.293061017990112, -0.287769138813019, -0.282451897859573, -0.276881545782089, -0.271538466215134, -0.266230016946793, -0.260810241103172, -0.255275085568428, -0.250256977975369, -0.244981549680233, -0.239482022821903, -0.234243676066399, -0.229077011346817, -0.223985828459263, -0.218823373317719, -0.213446579873562, -0.208229854702950, -0.203059889376163, -0.197750709950924, -0.192747063934803, -0.187504179775715, -0.182389929890633, -0.177217543125153, -0.171924278140068, -0.166774630546570, -0.161785751581192, -0.156633131206036, -0.151579089462757, -0.146486774086952, -0.141248725354671, -0.136320501565933, -0.131224654614925, -0.126108497381210, -0.121002320200205, -0.115863408893347, -0.110862344503403, -0.105683516710997, -0.100704137235880, -0.0956911295652390, -0.0908080786466599, -0.0857942961156368, -0.0806992426514626, -0.0757131054997444, -0.0708913691341877, -0.0660011805593967, -0.0609614383429289, -0.0559930652379990, -0.0510514825582504, -0.0462313126772642, -0.0413336884230375, -0.0364414341747761});
-    return w;
+    return { Colin::WavetableData::triangle.begin(), Colin::WavetableData::triangle.end() };
 }
 
 static std::vector<float> squareWavetable() {
-    std::vector<float> w({-0.0170402545481920, 0.0353123489767313, 0.121378585696220, 0.204850666224957, 0.291023313999176, 0.377352207899094, 0.464399471879005, 0.549855023622513, 0.638996422290802, 0.706852465867996, 0.724098175764084, 0.720780074596405, 0.721479415893555, 0.720614224672318, 0.721030116081238, 0.720302343368530, 0.720601350069046, 0.720011591911316, 0.720214098691940, 0.719732075929642, 0.719824343919754, 0.719468951225281, 0.719461500644684, 0.719187289476395, 0.719075709581375, 0.718855708837509, 0.718721270561218, 0.718526959419251, 0.718364983797073, 0.718190461397171, 0.718017429113388, 0.717837184667587, 0.717654228210449, 0.717477113008499, 0.717288076877594, 0.717106878757477, 0.716928035020828, 0.716734886169434, 0.716552734375000, 0.716372847557068, 0.716192513704300, 0.716007053852081, 0.715822428464890, 0.715648114681244, 0.715476632118225, 0.715297847986221, 0.715120077133179, 0.714942604303360, 0.714761137962341, 0.714587479829788, 0.714414000511169, 0.714232623577118, 0.714060723781586, 0.713888764381409, 0.713703870773315, 0.713532894849777, 0.713359177112579, 0.713188022375107, 0.713011384010315, 0.712830901145935, 0.712661206722260, 0.712488740682602, 0.712310075759888, 0.712131619453430, 0.711961716413498, 0.711795210838318, 0.711610615253449, 0.711451411247253, 0.711267590522766, 0.711093813180924, 0.710915803909302, 0.710755139589310, 0.710566729307175, 0.710402786731720, 0.710228204727173, 0.710055738687515, 0.709880769252777, 0.709700435400009, 0.709519445896149, 0.709346413612366, 0.709183663129807, 0.709010392427445, 0.708836495876312, 0.708662450313568, 0.708486855030060, 0.708315223455429, 0.708142250776291, 0.707968235015869, 0.707797557115555, 0.707632422447205, 0.707442998886108, 0.707275897264481, 0.707120597362518, 0.706946283578873, 0.706765204668045, 0.706595629453659, 0.706423670053482, 0.706247866153717, 0.706071406602860, 0.705912411212921, 0.705736041069031, 0.705564320087433, 0.705387383699417, 0.705214262008667, 0.705049574375153, 0.704869538545609, 0.704716086387634, 0.704536706209183, 0.704366773366928, 0.704200327396393, 0.704020023345947, 0.703866928815842, 0.703694641590118, 0.703518599271774, 0.703346371650696, 0.703178018331528, 0.703012079000473, 0.702847063541412, 0.702668488025665, 0.702492833137512, 0.702337622642517, 0.702175348997116, 0.701999366283417, 0.701840519905090, 0.701682895421982, 0.701504111289978, 0.701325207948685, 0.701128691434860, 0.700951665639877, 0.700770378112793, 0.700594305992127, 0.700425088405609, 0.700257241725922, 0.700089573860169, 0.699906080961227, 0.699750959873200, 0.699579149484634, 0.699396073818207, 0.699226051568985, 0.699033021926880, 0.698845952749252, 0.698673903942108, 0.698508292436600, 0.698328793048859, 0.698152244091034, 0.697968184947968, 0.697775423526764, 0.697596251964569, 0.697435945272446, 0.697276413440704, 0.697109788656235, 0.696939021348953, 0.696765601634979, 0.696597486734390, 0.696426451206207, 0.696254312992096, 0.696087688207626, 0.695917576551437, 0.695748507976532, 0.695582389831543, 0.695410609245300, 0.695243686437607, 0.695081591606140, 0.694914251565933, 0.694749146699905, 0.694576233625412, 0.694409757852554, 0.694235533475876, 0.694069594144821, 0.693906873464584, 0.693731844425201, 0.693568587303162, 0.693403661251068, 0.693230450153351, 0.693056762218475, 0.692899256944656, 0.692732721567154, 0.692561656236649, 0.692400276660919, 0.692221522331238, 0.692061722278595, 0.691895276308060, 0.691715717315674, 0.691554665565491, 0.691387325525284, 0.691217064857483, 0.691057860851288, 0.690891325473785, 0.690718829631805, 0.690542668104172, 0.690376937389374, 0.690213710069656, 0.690050423145294, 0.689885705709457, 0.689719140529633, 0.689553350210190, 0.689378261566162, 0.689211964607239, 0.689051955938339, 0.688875764608383, 0.688706517219544, 0.688545823097229, 0.688378155231476, 0.688207060098648, 0.688035309314728, 0.687869876623154, 0.687703281641007, 0.687531083822250, 0.687362551689148, 0.687198638916016, 0.687031149864197, 0.686856180429459, 0.686698138713837, 0.686520904302597, 0.686352610588074, 0.686193197965622, 0.686028391122818, 0.685864031314850, 0.685686528682709, 0.685507625341415, 0.685345113277435, 0.685186862945557, 0.685022324323654, 0.684854090213776, 0.684680730104446, 0.684506297111511, 0.684337943792343, 0.684175968170166, 0.684004485607147, 0.683840364217758, 0.683687746524811, 0.683514565229416, 0.683341175317764, 0.683179855346680, 0.683005839586258, 0.682837963104248, 0.682668209075928, 0.682490140199661, 0.682333290576935, 0.682164371013641, 0.681986838579178, 0.681831657886505, 0.681663393974304, 0.681497007608414, 0.681334078311920, 0.681170135736466, 0.681009560823441, 0.680857241153717, 0.680694341659546, 0.680526435375214, 0.680357068777084, 0.680179327726364, 0.680011987686157, 0.679823666810989, 0.679664105176926, 0.679489433765411, 0.679323107004166, 0.679178625345230, 0.679009407758713, 0.678838014602661, 0.678682923316956, 0.678522169589996, 0.678352236747742, 0.678189069032669, 0.678026616573334, 0.677862763404846, 0.677699744701386, 0.677529454231262, 0.677361816167831, 0.677209734916687, 0.677046895027161, 0.676871478557587, 0.676712930202484, 0.676541656255722, 0.676368147134781, 0.676209211349487, 0.676051259040833, 0.675879567861557, 0.675721794366837, 0.675550013780594, 0.675382196903229, 0.675222158432007, 0.675065547227860, 0.674895137548447, 0.674732834100723, 0.674565225839615, 0.674397468566895, 0.674240440130234, 0.674076169729233, 0.673900872468948, 0.673740446567535, 0.673577219247818, 0.673402160406113, 0.673240035772324, 0.673076927661896, 0.672913461923599, 0.672760069370270, 0.672593504190445, 0.672423958778381, 0.672261446714401, 0.672103971242905, 0.671936839818955, 0.671772927045822, 0.671608567237854, 0.671443760395050, 0.671288162469864, 0.671119421720505, 0.670948654413223, 0.670786172151566, 0.670626610517502, 0.670464277267456, 0.670303046703339, 0.670137792825699, 0.669977664947510, 0.669809877872467, 0.669640064239502, 0.669480830430985, 0.669317394495010, 0.669153988361359, 0.668998330831528, 0.668825417757034, 0.668662160634995, 0.668496310710907, 0.668345779180527, 0.668170809745789, 0.668004602193832, 0.667853891849518, 0.667678743600845, 0.667519032955170, 0.667363852262497, 0.667198419570923, 0.667037099599838, 0.666870296001434, 0.666710197925568, 0.666548490524292, 0.666380703449249, 0.666212230920792, 0.666050940752029, 0.665898382663727, 0.665737807750702, 0.665573030710220, 0.665406346321106, 0.665242195129395, 0.665087521076202, 0.664923191070557, 0.664761364459992, 0.664602428674698, 0.664440602064133, 0.664273053407669, 0.664113044738770, 0.663952142000198, 0.663794577121735, 0.663613110780716, 0.663529574871063, 0.663329333066940, 0.663076519966126, 0.662964344024658, 0.662813097238541, 0.662656486034393, 0.662516087293625, 0.662335425615311, 0.662178397178650, 0.662018626928330, 0.661851614713669, 0.661686986684799, 0.661529541015625, 0.661371260881424, 0.661205440759659, 0.661040067672730, 0.660876899957657, 0.660711586475372, 0.660555183887482, 0.660389155149460, 0.660229444503784, 0.660080850124359, 0.659931778907776, 0.659775048494339, 0.659611046314240, 0.659454941749573, 0.659301072359085, 0.659140467643738, 0.658983170986176, 0.658829927444458, 0.658662557601929, 0.658502131700516, 0.658350467681885, 0.658177763223648, 0.658016860485077, 0.657871335744858, 0.657693654298782, 0.657529473304749, 0.657366544008255, 0.657224029302597, 0.657071799039841, 0.656916886568070, 0.656758785247803, 0.656603723764420, 0.656444609165192, 0.656270980834961, 0.656095743179321, 0.655926465988159, 0.655763268470764, 0.655590951442719, 0.655427008867264, 0.655251234769821, 0.655070483684540, 0.654898464679718, 0.654733896255493, 0.654576480388641, 0.654409855604172, 0.654239505529404, 0.654083222150803, 0.653925746679306, 0.653775036334992, 0.653637379407883, 0.653482109308243, 0.653319686651230, 0.653171151876450, 0.653013646602631, 0.652843207120895, 0.652689516544342, 0.652537941932678, 0.652369439601898, 0.652215152978897, 0.652057319879532, 0.651886254549027, 0.651727765798569, 0.651570558547974, 0.651416540145874, 0.651262253522873, 0.651091575622559, 0.650939911603928, 0.650777757167816, 0.650612115859985, 0.650450229644775, 0.650299519300461, 0.650142312049866, 0.649985760450363, 0.649815618991852, 0.649661153554916, 0.649497628211975, 0.649349272251129, 0.649188697338104, 0.649018734693527, 0.648852020502091, 0.648700535297394, 0.648538827896118, 0.648375749588013, 0.648221999406815, 0.648060232400894, 0.647890895605087, 0.647726178169251, 0.647570192813873, 0.647414654493332, 0.647256195545197, 0.647095233201981, 0.646939605474472, 0.646784126758575, 0.646624714136124, 0.646454393863678, 0.646296411752701, 0.646132439374924, 0.645958334207535, 0.645797818899155, 0.645642518997192, 0.645486682653427, 0.645321100950241, 0.645146161317825, 0.644996792078018, 0.644812345504761, 0.644634932279587, 0.644449353218079, 0.644277602434158, 0.644108265638351, 0.643932998180389, 0.643779247999191, 0.643622547388077, 0.643460303544998, 0.643300890922546, 0.643144398927689, 0.642981410026550, 0.642828673124313, 0.642674148082733, 0.642508119344711, 0.642344802618027, 0.642192989587784, 0.642035871744156, 0.641865819692612, 0.641704231500626, 0.641547352075577, 0.641384571790695, 0.641230493783951, 0.641070336103439, 0.640891432762146, 0.640734732151032, 0.640599250793457, 0.640450894832611, 0.640278935432434, 0.640103638172150, 0.639944404363632, 0.639780730009079, 0.639611482620239, 0.639428466558456, 0.639265954494476, 0.639126032590866, 0.638980805873871, 0.638839632272720, 0.638695985078812, 0.638539940118790, 0.638545572757721, 0.637792378664017, 0.638745278120041, 0.636331170797348, 0.640036612749100, 0.633661150932312, 0.643311053514481, 0.628344774246216, 0.651221573352814, 0.612897068262100, 0.720457643270493, 0.254176110029221, -0.687037974596024, -0.923363268375397, -0.834659844636917, -0.876952081918716, -0.843978554010391, -0.872110694646835, -0.846830606460571, -0.868917614221573, -0.849458158016205, -0.865707486867905, -0.852133214473724, -0.862700462341309, -0.854435145854950, -0.860272973775864, -0.856002300977707, -0.858583420515060, -0.856751829385757, -0.857516914606094, -0.856854587793350, -0.856891036033630, -0.856645554304123, -0.856437712907791, -0.856262445449829, -0.856078326702118, -0.855909168720245, -0.855730593204498, -0.855545938014984, -0.855365753173828, -0.855182290077210, -0.855001628398895, -0.854829281568527, -0.854643911123276, -0.854476362466812, -0.854298949241638, -0.854118198156357, -0.853934675455093, -0.853755503892899, -0.853590995073319, -0.853420376777649, -0.853233605623245, -0.853047758340836, -0.852875024080277, -0.852699458599091, -0.852518975734711, -0.852340757846832, -0.852171003818512, -0.852005183696747, -0.851833760738373, -0.851638019084930, -0.851449936628342, -0.851283609867096, -0.851110160350800, -0.850937515497208, -0.850759685039520, -0.850592970848084, -0.850410223007202, -0.850237190723419, -0.850068539381027, -0.849880427122116, -0.849716007709503, -0.849523276090622, -0.849352955818176, -0.849183738231659, -0.849005222320557, -0.848834007978439, -0.848652929067612, -0.848472058773041, -0.848297536373138, -0.848126679658890, -0.847956836223602, -0.847780525684357, -0.847596704959869, -0.847422838211060, -0.847252368927002, -0.847081780433655, -0.846908569335938, -0.846731841564179, -0.846554130315781, -0.846369355916977, -0.846195012331009, -0.846030026674271, -0.845861256122589, -0.845678478479385, -0.845497786998749, -0.845328420400620, -0.845156997442246, -0.844983279705048, -0.844807446002960, -0.844633042812347, -0.844452708959580, -0.844265133142471, -0.844106078147888, -0.843931585550308, -0.843750774860382, -0.843590199947357, -0.843406438827515, -0.843231499195099, -0.843065649271011, -0.842886716127396, -0.842715084552765, -0.842541366815567, -0.842372000217438, -0.842199802398682, -0.842032670974731, -0.841857880353928, -0.841686785221100, -0.841520816087723, -0.841348737478256, -0.841169506311417, -0.840985268354416, -0.840799808502197, -0.840621888637543, -0.840456485748291, -0.840291708707809, -0.840118139982224, -0.839947938919067, -0.839787989854813, -0.839620292186737, -0.839444041252136, -0.839281201362610, -0.839101523160934, -0.838920474052429, -0.838760405778885, -0.838583886623383, -0.838417381048203, -0.838245362043381, -0.838075369596481, -0.837906599044800, -0.837726652622223, -0.837557852268219, -0.837391287088394, -0.837210685014725, -0.837050467729569, -0.836875736713409, -0.836699575185776, -0.836531400680542, -0.836375921964645, -0.836195588111877, -0.836026579141617, -0.835843980312347, -0.835681051015854, -0.835513263940811, -0.835345089435577, -0.835161566734314, -0.834995150566101, -0.834833085536957, -0.834663897752762, -0.834489136934280, -0.834310561418533, -0.834150880575180, -0.833984583616257, -0.833810418844223, -0.833645373582840, -0.833471834659576, -0.833301365375519, -0.833124101161957, -0.832961231470108, -0.832787275314331, -0.832616299390793, -0.832451969385147, -0.832275986671448, -0.832104891538620, -0.831947207450867, -0.831773817539215, -0.831602364778519, -0.831437319517136, -0.831261992454529, -0.831093639135361, -0.830938875675201, -0.830770373344421, -0.830583930015564, -0.830425262451172, -0.830259591341019, -0.830077171325684, -0.829899907112122, -0.829742968082428, -0.829561531543732, -0.829407900571823, -0.829241782426834, -0.829068481922150, -0.828897356987000, -0.828720033168793, -0.828557699918747, -0.828397214412689, -0.828224390745163, -0.828058212995529, -0.827898263931274, -0.827728241682053, -0.827550262212753, -0.827381968498230, -0.827212840318680, -0.827039986848831, -0.826890051364899, -0.826707124710083, -0.826535105705261, -0.826366961002350, -0.826208263635635, -0.826039075851440, -0.825878143310547, -0.825708806514740, -0.825534909963608, -0.825362116098404, -0.825216829776764, -0.825040310621262, -0.824878603219986, -0.824707597494125, -0.824539840221405, -0.824377208948135, -0.824203103780747, -0.824037611484528, -0.823852300643921, -0.823728591203690, -0.823544651269913, -0.823340356349945, -0.823184758424759, -0.823027640581131, -0.822864234447479, -0.822698235511780, -0.822526544332504, -0.822362124919891, -0.822204321622849, -0.822037756443024, -0.821874499320984, -0.821711003780365, -0.821534216403961, -0.821365177631378, -0.821199506521225, -0.821035474538803, -0.820863783359528, -0.820697903633118, -0.820536613464356, -0.820371091365814, -0.820217728614807, -0.820047765970230, -0.819897741079330, -0.819727241992950, -0.819565385580063, -0.819404840469360, -0.819242775440216, -0.819075345993042, -0.818917065858841, -0.818748205900192, -0.818583220243454, -0.818425804376602, -0.818258464336395, -0.818084686994553, -0.817913532257080, -0.817745596170425, -0.817585766315460, -0.817442834377289, -0.817288219928742, -0.817120105028153, -0.816965103149414, -0.816803723573685, -0.816626042127609, -0.816449433565140, -0.816276311874390, -0.816099971532822, -0.815919399261475, -0.815748840570450, -0.815584659576416, -0.815406590700150, -0.815225511789322, -0.815048336982727, -0.814878433942795, -0.814714878797531, -0.814545720815659, -0.814390540122986, -0.814223200082779, -0.814059287309647, -0.813907474279404, -0.813738882541657, -0.813590735197067, -0.813432276248932, -0.813275068998337, -0.813119411468506, -0.812947690486908, -0.812789320945740, -0.812623798847199, -0.812461316585541, -0.812290757894516, -0.812129080295563, -0.811955481767654, -0.811798661947250, -0.811633348464966, -0.811479389667511, -0.811309516429901, -0.811143368482590, -0.810980051755905, -0.810815870761871, -0.810668826103210, -0.810503810644150, -0.810335189104080, -0.810173094272614, -0.810001760721207, -0.809836685657501, -0.809673339128494, -0.809509634971619, -0.809353142976761, -0.809188663959503, -0.809016078710556, -0.808849334716797, -0.808682382106781, -0.808527797460556, -0.808359324932098, -0.808191984891892, -0.808029621839523, -0.807865142822266, -0.807701826095581, -0.807538598775864, -0.807370662689209, -0.807216495275497, -0.807061105966568, -0.806890577077866, -0.806721657514572, -0.806553423404694, -0.806398719549179, -0.806236773729324, -0.806070744991303, -0.805903792381287, -0.805737763643265, -0.805585831403732, -0.805415838956833, -0.805253297090530, -0.805105686187744, -0.804934233427048, -0.804761439561844, -0.804598093032837, -0.804430216550827, -0.804273813962936, -0.804111182689667, -0.803936243057251, -0.803771317005158, -0.803612083196640, -0.803452253341675, -0.803292810916901, -0.803133606910706, -0.802963525056839, -0.802806586027145, -0.802643150091171, -0.802476346492767, -0.802313566207886, -0.802151232957840, -0.801985740661621, -0.801815032958984, -0.801660567522049, -0.801483750343323, -0.801326036453247, -0.801152259111404, -0.800987482070923, -0.800837248563767, -0.800654262304306, -0.800507932901382, -0.800364881753922, -0.800203919410706, -0.800005167722702, -0.799989104270935, -0.799947440624237, -0.799784690141678, -0.799619078636169, -0.799450397491455, -0.799312531948090, -0.799175888299942, -0.799034595489502, -0.798884958028793, -0.798721045255661, -0.798553884029388, -0.798385322093964, -0.798210769891739, -0.798041522502899, -0.797878861427307, -0.797720164060593, -0.797570228576660, -0.797404170036316, -0.797251075506210, -0.797086507081986, -0.796914517879486, -0.796747922897339, -0.796583831310272, -0.796420693397522, -0.796266764402390, -0.796107828617096, -0.795933961868286, -0.795770615339279, -0.795584678649902, -0.795415908098221, -0.795244723558426, -0.795081853866577, -0.794904142618179, -0.794732838869095, -0.794563859701157, -0.794396638870239, -0.794217407703400, -0.794050395488739, -0.793874144554138, -0.793702155351639, -0.793527603149414, -0.793348193168640, -0.793169945478439, -0.792995303869247, -0.792818307876587, -0.792641937732697, -0.792460799217224, -0.792298585176468, -0.792132198810577, -0.791939020156860, -0.791763335466385, -0.791585981845856, -0.791403412818909, -0.791237026453018, -0.791056811809540, -0.790881574153900, -0.790697544813156, -0.790525197982788, -0.790342479944229, -0.790150672197342, -0.789970427751541, -0.789792180061340, -0.789610177278519, -0.789433866739273, -0.789241284132004, -0.789059638977051, -0.788876354694367, -0.788689136505127, -0.788511812686920, -0.788322627544403, -0.788125008344650, -0.787950694561005, -0.787774741649628, -0.787585914134979, -0.787380754947662, -0.787198394536972, -0.787003785371780, -0.786836028099060, -0.786621659994125, -0.786356747150421, -0.786139160394669, -0.785955935716629, -0.785773724317551, -0.785580515861511, -0.785373717546463, -0.785178840160370, -0.784986436367035, -0.784788012504578, -0.784595042467117, -0.784394353628159, -0.784195840358734, -0.784002959728241, -0.783799409866333, -0.783596754074097, -0.783402830362320, -0.783181786537170, -0.782982796430588, -0.782759636640549, -0.782561659812927, -0.782354772090912, -0.782130211591721, -0.781921863555908, -0.781721204519272, -0.781508982181549, -0.781279116868973, -0.781056523323059, -0.780838310718536, -0.780609309673309, -0.780403107404709, -0.780162423849106, -0.779925584793091, -0.779683202505112, -0.779455333948135, -0.779215842485428, -0.778963327407837, -0.778714329004288, -0.778465181589127, -0.778210908174515, -0.777945816516876, -0.777682662010193, -0.777405232191086, -0.777119010686874, -0.776833713054657, -0.776528805494309, -0.776210099458695, -0.775889188051224, -0.775562018156052, -0.775204002857208, -0.774835735559464, -0.774448543787003, -0.774041593074799, -0.773588806390762, -0.773139804601669, -0.772549688816071, -0.772019058465958, -0.771134912967682, -0.770502358675003, -0.769018262624741, -0.763856440782547, -0.720537036657333, -0.638998985290527, -0.553637623786926, -0.467023670673370, -0.381585195660591, -0.295403137803078, -0.206498846411705, -0.112712901085615});
-    return w;
+    return { Colin::WavetableData::square.begin(), Colin::WavetableData::square.end() };
 }
 
 static std::vector<float> fourtyFour() {
-    std::vector<float> w({-0.00477941241115332, -0.0239184601232409, -0.0429205074906349, -0.0616023000329733, -0.0797018446028233, -0.0970673598349094, -0.113468375056982, -0.128766886889935, -0.142803847789764, -0.155495196580887, -0.166697762906551, -0.176402881741524, -0.184582464396954, -0.191208392381668, -0.196350961923599, -0.200052194297314, -0.202414631843567, -0.203532665967941, -0.203562304377556, -0.202632084488869, -0.200932987034321, -0.198628619313240, -0.195885181427002, -0.192871257662773, -0.189747802913189, -0.186708770692348, -0.183868564665318, -0.181384555995464, -0.179333284497261, -0.177833884954453, -0.176934093236923, -0.176692545413971, -0.177126660943031, -0.178222298622131, -0.179965004324913, -0.182308234274387, -0.185204654932022, -0.188552848994732, -0.192260637879372, -0.196256101131439, -0.200433962047100, -0.204665869474411, -0.208854362368584, -0.212933421134949, -0.216770596802235, -0.220297574996948, -0.223478198051453, -0.226242840290070, -0.228543139994144, -0.230385698378086, -0.231755077838898, -0.232669122517109, -0.233157254755497, -0.233271740376949, -0.233054280281067, -0.232603669166565, -0.231940574944019, -0.231188215315342, -0.230402968823910, -0.229687586426735, -0.229123122990131, -0.228733986616135, -0.228637196123600, -0.228823818266392, -0.229400739073753, -0.230336524546146, -0.231680832803249, -0.233425535261631, -0.235526956617832, -0.238011583685875, -0.240788131952286, -0.243823431432247, -0.247071966528893, -0.250452101230621, -0.253905057907105, -0.257371470332146, -0.260767310857773, -0.264031618833542, -0.267115026712418, -0.269943311810493, -0.272490084171295, -0.274740859866142, -0.276644423604012, -0.278185725212097, -0.279410943388939, -0.280329897999764, -0.280927851796150, -0.281276434659958, -0.281423315405846, -0.281416624784470, -0.281317442655563, -0.281200006604195, -0.281101748347282, -0.281110584735870, -0.281265124678612, -0.281642034649849, -0.282268300652504, -0.283183723688126, -0.284415766596794, -0.285966753959656, -0.287877216935158, -0.290098547935486, -0.292645722627640, -0.295469671487808, -0.298520669341087, -0.301774457097054, -0.305141851305962, -0.308623403310776, -0.312102943658829, -0.315515190362930, -0.318859562277794, -0.322017699480057, -0.324988260865212, -0.327690988779068, -0.330137193202972, -0.332245841622353, -0.334054335951805, -0.335573896765709, -0.336749419569969, -0.337671831250191, -0.338352829217911, -0.338817626237869, -0.339131817221642, -0.339361667633057, -0.339560464024544, -0.339768543839455, -0.340067103505135, -0.340537995100021, -0.341182380914688, -0.342096582055092, -0.343295872211456, -0.344823032617569, -0.346652671694756, -0.348855197429657, -0.351405411958694, -0.354263961315155, -0.357405126094818, -0.360816627740860, -0.364444628357887, -0.368220880627632, -0.372090503573418, -0.375984326004982, -0.379860371351242, -0.383634582161903, -0.387278139591217, -0.390663802623749, -0.393832236528397, -0.396683424711227, -0.399229571223259, -0.401426389813423, -0.403300285339355, -0.404806762933731, -0.406029149889946, -0.407008558511734, -0.407715171575546, -0.408247530460358, -0.408690854907036, -0.409087672829628, -0.409495353698730, -0.410014852881432, -0.410718977451324, -0.411637693643570, -0.412830099463463, -0.414370194077492, -0.416288942098618, -0.418602809309959, -0.421343103051186, -0.424497246742249, -0.428023457527161, -0.431952923536301, -0.436199352145195, -0.440705522894859, -0.445457786321640, -0.450309649109840, -0.455261468887329, -0.460195109248161, -0.464976727962494, -0.469650089740753, -0.474065691232681, -0.478162392973900, -0.481878876686096, -0.485258087515831, -0.488163411617279, -0.490667611360550, -0.492708519101143, -0.494389384984970, -0.495708405971527, -0.496709242463112, -0.497481137514114, -0.498113974928856, -0.498667806386948, -0.499263852834702, -0.499993667006493, -0.500934064388275, -0.502208232879639, -0.503909260034561, -0.506085097789764, -0.508783847093582, -0.512084573507309, -0.516036003828049, -0.520625531673431, -0.525809586048126, -0.531606048345566, -0.537955611944199, -0.544752061367035, -0.551935106515884, -0.559412956237793, -0.567031145095825, -0.574727803468704, -0.582315802574158, -0.589700788259506, -0.596740931272507, -0.603387713432312, -0.609482347965241, -0.614975422620773, -0.619785696268082, -0.623894602060318, -0.627330631017685, -0.630059570074081, -0.632189244031906, -0.633764714002609, -0.633799374103546, -0.633193582296372, -0.632429361343384, -0.631775468587875, -0.631326138973236, -0.631379932165146, -0.632061064243317, -0.633619010448456, -0.636223763227463, -0.640107095241547, -0.645343422889710, -0.652131885290146, -0.660529971122742, -0.670626312494278, -0.682431042194367, -0.695907533168793, -0.711034834384918, -0.727667659521103, -0.745692253112793, -0.764902532100678, -0.785061866044998, -0.805934935808182, -0.827240854501724, -0.848591744899750, -0.869755744934082, -0.890317052602768, -0.910015523433685, -0.928453892469406, -0.945343971252441, -0.960398882627487, -0.973333060741425, -0.983892768621445, -0.991917431354523, -0.997246950864792, -0.999722033739090, -0.999367207288742, -0.996115535497665, -0.990067839622498, -0.981278836727142, -0.969894200563431, -0.956165313720703, -0.940251439809799, -0.922432392835617, -0.903047174215317, -0.882357776165009, -0.860715866088867, -0.838425934314728, -0.815881848335266, -0.793340057134628, -0.771131277084351, -0.749569654464722, -0.728922903537750, -0.709367811679840, -0.691154986619949, -0.674414604902268, -0.659231305122376, -0.645749002695084, -0.633887708187103, -0.623731195926666, -0.615184754133225, -0.608168780803680, -0.602544784545898, -0.598204523324966, -0.594951450824738, -0.592649012804031, -0.591028392314911, -0.589954793453217, -0.589205414056778, -0.588603019714356, -0.587970674037933, -0.587132632732391, -0.586001604795456, -0.584373861551285, -0.582251071929932, -0.579488962888718, -0.576089829206467, -0.572070449590683, -0.567403942346573, -0.562136113643646, -0.556327283382416, -0.550080806016922, -0.543499588966370, -0.536657214164734, -0.529655754566193, -0.522668957710266, -0.515768975019455, -0.509070575237274, -0.502688229084015, -0.496692687273026, -0.491182953119278, -0.486186012625694, -0.481785997748375, -0.477937847375870, -0.474696785211563, -0.472046375274658, -0.469913348555565, -0.468253210186958, -0.467021554708481, -0.466145977377892, -0.465511813759804, -0.465061545372009, -0.464695557951927, -0.464286461472511, -0.463792070746422, -0.463142350316048, -0.462225198745728, -0.460985481739044, -0.459410309791565, -0.457458868622780, -0.455104604363441, -0.452334985136986, -0.449165523052216, -0.445695385336876, -0.441870003938675, -0.437774196267128, -0.433520168066025, -0.429136291146278, -0.424650847911835, -0.420230388641357, -0.415902346372604, -0.411721691489220, -0.407784387469292, -0.404117196798325, -0.400787875056267, -0.397836372256279, -0.395233914256096, -0.393047675490379, -0.391248732805252, -0.389808326959610, -0.388711363077164, -0.387915730476379, -0.387365713715553, -0.386978879570961, -0.386754482984543, -0.386583432555199, -0.386397749185562, -0.386156886816025, -0.385780021548271, -0.385213643312454, -0.384377598762512, -0.383299916982651, -0.381914272904396, -0.380221888422966, -0.378170356154442, -0.375828027725220, -0.373182713985443, -0.370302408933640, -0.367161348462105, -0.363853842020035, -0.360420554876328, -0.356928393244743, -0.353457272052765, -0.350020304322243, -0.346696913242340, -0.343565881252289, -0.340639770030975, -0.338009968400002, -0.335635840892792, -0.333582133054733, -0.331886947154999, -0.330509573221207, -0.329435586929321, -0.328663811087608, -0.328153818845749, -0.327878504991531, -0.327745765447617, -0.327768012881279, -0.327814728021622, -0.327872887253761, -0.327877610921860, -0.327751576900482, -0.327469483017921, -0.326967418193817, -0.326207742094994, -0.325165733695030, -0.323842585086823, -0.322175353765488, -0.320242315530777, -0.317993447184563, -0.315506666898727, -0.312783062458038, -0.309874609112740, -0.306832939386368, -0.303734868764877, -0.300593361258507, -0.297497302293777, -0.294522419571877, -0.291680827736855, -0.289060324430466, -0.286697790026665, -0.284617245197296, -0.282855242490768, -0.281422942876816, -0.280318975448608, -0.279541924595833, -0.279052972793579, -0.278863310813904, -0.278872042894363, -0.279103204607964, -0.279431611299515, -0.279844552278519, -0.280254885554314, -0.280613213777542, -0.280845761299133, -0.280928283929825, -0.280763059854507, -0.280314326286316, -0.279558733105660, -0.278485447168350, -0.277071341872215, -0.275293529033661, -0.273202478885651, -0.270799532532692, -0.268134787678719, -0.265245869755745, -0.262170210480690, -0.259005501866341, -0.255824744701386, -0.252640128135681, -0.249584235250950, -0.246680676937103, -0.244036920368671, -0.241651788353920, -0.239620029926300, -0.237951993942261, -0.236693829298019, -0.235819853842258, -0.235375918447971, -0.235288724303246, -0.235580407083035, -0.236154340207577, -0.236985579133034, -0.237990207970142, -0.239108383655548, -0.240268930792809, -0.241342209279537, -0.242281660437584, -0.243005804717541, -0.243410281836987, -0.243461519479752, -0.243102788925171, -0.242277801036835, -0.240953832864761, -0.239156469702721, -0.236841633915901, -0.234081231057644, -0.230888992547989, -0.227359361946583, -0.223517000675201, -0.219478525221348, -0.215336829423904, -0.211207129061222, -0.207181014120579, -0.203406624495983, -0.199951305985451, -0.196938887238503, -0.194446876645088, -0.192586354911327, -0.191376961767674, -0.190894745290279, -0.191136173903942, -0.192086406052113, -0.193753212690353, -0.196054317057133, -0.198885500431061, -0.202188059687614, -0.205791734158993, -0.209572121500969, -0.213360965251923, -0.216957740485668, -0.220196589827538, -0.222846232354641, -0.224765554070473, -0.225737005472183, -0.225566588342190, -0.224105767905712, -0.221196033060551, -0.216723933815956, -0.210587829351425, -0.202719673514366, -0.193095676600933, -0.181724950671196, -0.168616674840450, -0.153834372758865, -0.137528076767921, -0.119781766086817, -0.100797940045595, -0.0807561390101910, -0.0598562695086002, -0.0383614506572485, -0.0164900580421090, 0.00548744946718216, 0.0273345727473497, 0.0487737450748682, 0.0696039982140064, 0.0895406305789948, 0.108428515493870, 0.126028776168823, 0.142210192978382, 0.156821362674236, 0.169796459376812, 0.181007005274296, 0.190472677350044, 0.198192156851292, 0.204164139926434, 0.208492062985897, 0.211247310042381, 0.212563380599022, 0.212562456727028, 0.211428195238113, 0.209311880171299, 0.206425830721855, 0.202949844300747, 0.199062444269657, 0.194940879940987, 0.190750837326050, 0.186687529087067, 0.182862900197506, 0.179428875446320, 0.176454715430737, 0.174049831926823, 0.172251686453819, 0.171107657253742, 0.170624166727066, 0.170777313411236, 0.171543352305889, 0.172868475317955, 0.174699291586876, 0.176932655274868, 0.179476186633110, 0.182258144021034, 0.185177482664585, 0.188113957643509, 0.190978080034256, 0.193710714578629, 0.196193888783455, 0.198369771242142, 0.200210541486740, 0.201659083366394, 0.202678419649601, 0.203280769288540, 0.203458823263645, 0.203234523534775, 0.202639438211918, 0.201724357903004, 0.200529940426350, 0.199144966900349, 0.197589896619320, 0.195971816778183, 0.194339208304882, 0.192778587341309, 0.191356606781483, 0.190091587603092, 0.189078040421009, 0.188304916024208, 0.187856331467628, 0.187701813876629, 0.187877483665943, 0.188371807336807, 0.189145155251026, 0.190214581787586, 0.191503107547760, 0.192981250584126, 0.194610401988029, 0.196324236690998, 0.198075681924820, 0.199817903339863, 0.201486051082611, 0.203034289181232, 0.204426333308220, 0.205607883632183, 0.206561826169491, 0.207280337810516, 0.207728289067745, 0.207898274064064, 0.207828447222710, 0.207529440522194, 0.206993632018566, 0.206276908516884, 0.205416545271873, 0.204449586570263, 0.203421704471111, 0.202387183904648, 0.201372966170311, 0.200441524386406, 0.199619062244892, 0.198958300054073, 0.198475889861584, 0.198197312653065, 0.198138855397701, 0.198299080133438, 0.198702871799469, 0.199313499033451, 0.200138278305531, 0.201140776276588, 0.202284850180149, 0.203552097082138, 0.204880826175213, 0.206270575523376, 0.207643046975136, 0.208955198526382, 0.210207343101501, 0.211322568356991, 0.212301783263683, 0.213094577193260, 0.213710702955723, 0.214100316166878, 0.214290432631969, 0.214290834963322, 0.214069060981274, 0.213685661554337, 0.213150128722191, 0.212480336427689, 0.211719065904617, 0.210908733308315, 0.210082963109016, 0.209266848862171, 0.208510041236877, 0.207861736416817, 0.207321159541607, 0.206945158541203, 0.206740714609623, 0.206731200218201, 0.206898778676987, 0.207282945513725, 0.207865782082081, 0.208621487021446, 0.209532544016838, 0.210589699447155, 0.211759604513645, 0.213001213967800, 0.214281894266605, 0.215561293065548, 0.216815471649170, 0.217996828258038, 0.219089977443218, 0.220024339854717, 0.220824696123600, 0.221436902880669, 0.221870221197605, 0.222102478146553, 0.222150772809982, 0.221993103623390, 0.221677683293819, 0.221228957176209, 0.220632456243038, 0.219943329691887, 0.219208419322968, 0.218451097607613, 0.217702142894268, 0.217014893889427, 0.216426938772202, 0.215952612459660, 0.215621344745159, 0.215469695627689, 0.215511269867420, 0.215752027928829, 0.216205276548862, 0.216861814260483, 0.217697590589523, 0.218725919723511, 0.219900757074356, 0.221191249787807, 0.222589008510113, 0.224019572138786, 0.225482583045959, 0.226919226348400, 0.228264041244984, 0.229539498686790, 0.230673588812351, 0.231638550758362, 0.232406862080097, 0.233001664280891, 0.233359895646572, 0.233519203960896, 0.233452729880810, 0.233212083578110, 0.232798747718334, 0.232235364615917, 0.231565430760384, 0.230832040309906, 0.230063743889332, 0.229316651821136, 0.228632353246212, 0.228045016527176, 0.227609120309353, 0.227364711463451, 0.227330736815929, 0.227525822818279, 0.227982111275196, 0.228717617690563, 0.229722999036312, 0.230975374579430, 0.232479184865952, 0.234205052256584, 0.236103847622871, 0.238147057592869, 0.240293137729168, 0.242474451661110, 0.244663968682289, 0.246782101690769, 0.248789727687836, 0.250628635287285, 0.252280518412590, 0.253681734204292, 0.254814937710762, 0.255650058388710, 0.256183370947838, 0.256430551409721, 0.256381407380104, 0.256083518266678, 0.255558416247368, 0.254859179258347, 0.254050910472870, 0.253178954124451, 0.252351030707359, 0.251604422926903, 0.251057267189026, 0.250757545232773, 0.250802218914032, 0.251256048679352, 0.252207532525063, 0.253682330250740, 0.255754843354225, 0.258443266153336, 0.261777684092522, 0.265757337212563, 0.270363166928291, 0.275582343339920, 0.281353935599327, 0.287629887461662, 0.294326752424240, 0.301350325345993, 0.308607682585716, 0.315989360213280, 0.323346167802811, 0.330589741468430, 0.337562784552574, 0.344168439507484, 0.350259125232697, 0.355729922652245, 0.360477432608604, 0.364399835467339, 0.367408424615860, 0.369450137019157, 0.370472684502602, 0.370424836874008, 0.369318351149559, 0.367153570055962, 0.363959223031998, 0.359769120812416, 0.354644671082497, 0.348685279488564, 0.341955825686455, 0.334564328193665, 0.326639264822006, 0.318279922008514, 0.309616729617119, 0.300762042403221, 0.291858747601509, 0.282999351620674, 0.274301633238792, 0.265876114368439, 0.257815763354301, 0.250180236995220, 0.243054598569870, 0.236480444669724, 0.230483070015907, 0.225107938051224, 0.220322139561176, 0.216149792075157, 0.212553009390831, 0.209499426186085, 0.206936821341515, 0.204823791980743, 0.203089296817780, 0.201683446764946, 0.200512148439884, 0.199527576565743, 0.198653019964695, 0.197827734053135, 0.196992062032223, 0.196087390184402, 0.195035941898823, 0.193673484027386, 0.192151829600334, 0.190425686538219, 0.188498444855213, 0.186378315091133, 0.184059150516987, 0.181558541953564, 0.178898364305496, 0.176114059984684, 0.173240281641483, 0.170301809906960, 0.167331993579865, 0.164386183023453, 0.161486901342869, 0.158669590950012, 0.155968911945820, 0.153405375778675, 0.151007816195488, 0.148782424628735, 0.146752648055553, 0.144902318716049, 0.143245734274387, 0.141775406897068, 0.140466928482056, 0.139304824173450, 0.138273954391480, 0.137351147830486, 0.136501275002956, 0.135706521570683, 0.134937167167664, 0.134156040847301, 0.133351214230061, 0.132502973079681, 0.131580106914043, 0.130568139255047, 0.129464812576771, 0.128260143101215, 0.126948297023773, 0.125527583062649, 0.124004039913416, 0.122406650334597, 0.120721776038408, 0.118974030017853, 0.117194894701242, 0.115392737090588, 0.113575637340546, 0.111788373440504, 0.110037934035063, 0.108338363468647, 0.106714203953743, 0.105171322822571, 0.103726118803024, 0.102387435734272, 0.101146243512630, 0.100018147379160, 0.0989940278232098, 0.0980649627745152, 0.0972256474196911, 0.0964640900492668, 0.0957652293145657, 0.0951076969504356, 0.0944906510412693, 0.0938868671655655, 0.0932797007262707, 0.0926594808697701, 0.0920071676373482, 0.0913106910884380, 0.0905519612133503, 0.0897387452423573, 0.0888566821813583, 0.0879073813557625, 0.0868801549077034, 0.0857921838760376, 0.0846419893205166, 0.0834462009370327, 0.0822001434862614, 0.0809259079396725, 0.0796332173049450, 0.0783373452723026, 0.0770559459924698, 0.0757918059825897, 0.0745618455111980, 0.0733824074268341, 0.0722552984952927, 0.0711988992989063, 0.0702033936977387, 0.0692810937762260, 0.0684384480118752, 0.0676655434072018, 0.0669580325484276, 0.0663143396377564, 0.0657250247895718, 0.0651835389435291, 0.0646706409752369, 0.0641881562769413, 0.0637100227177143, 0.0632336027920246, 0.0627464354038239, 0.0622340738773346, 0.0616923384368420, 0.0611099768429995, 0.0604809802025557, 0.0598019920289516, 0.0590744502842426, 0.0582882519811392, 0.0574590116739273, 0.0565789900720120, 0.0556633844971657, 0.0547134391963482, 0.0537392552942038, 0.0527505408972502, 0.0517610106617212, 0.0507731065154076, 0.0498019047081471, 0.0488597918301821, 0.0479482114315033, 0.0470808781683445, 0.0462627280503511, 0.0454964488744736, 0.0447865631431341, 0.0441333688795567, 0.0435351692140102, 0.0429902598261833, 0.0424912292510271, 0.0420384593307972, 0.0416155252605677, 0.0412250757217407, 0.0408477969467640, 0.0404813922941685, 0.0401130057871342, 0.0397356525063515, 0.0393392276018858, 0.0389209501445293, 0.0384681075811386, 0.0379770100116730, 0.0374458190053701, 0.0368745028972626, 0.0362615231424570, 0.0356054864823818, 0.0349145028740168, 0.0341902188956738, 0.0334403272718191, 0.0326706636697054, 0.0318868439644575, 0.0311014829203486, 0.0303236283361912, 0.0295548113062978, 0.0288103744387627, 0.0280924029648304, 0.0274122739210725, 0.0267686620354652, 0.0261707007884979, 0.0256178909912705, 0.0251134140416980, 0.0246526813134551, 0.0242386274039745, 0.0238617844879627, 0.0235227150842547, 0.0232101175934076, 0.0229202732443810, 0.0226439572870731, 0.0223747640848160, 0.0221055997535586, 0.0218245321884751, 0.0215278463438153, 0.0212090248242021, 0.0208601616322994, 0.0204799352213740, 0.0200653327628970, 0.0196137353777885, 0.0191247677430511, 0.0186027884483337, 0.0180467059835792, 0.0174643490463495, 0.0168588543310761, 0.0162390479817987, 0.0156082739122212, 0.0149759887717664, 0.0143493604846299, 0.0137363844551146, 0.0131428251042962, 0.0125773670151830, 0.0120428809896111, 0.0115451011806726, 0.0110863246954978, 0.0106702120974660, 0.0102947787381709, 0.00996085768565536, 0.00966473948210478, 0.00940220477059484, 0.00917018018662930, 0.00896140187978745, 0.00876820180565119, 0.00858547491952777, 0.00840396853163838, 0.00821730634197593, 0.00801829528063536, 0.00779965077526867, 0.00755659490823746, 0.00728330551646650, 0.00697827874682844, 0.00663868756964803, 0.00626378785818815, 0.00585532514378429, 0.00541576859541237, 0.00494969403371215, 0.00446267658844590, 0.00396166252903640, 0.00345481885597110, 0.00295105250552297, 0.00245923781767488, 0.00198888126760721, 0.00155009911395609, 0.00115136988461018, 0.000801595626398921, 0.000508167082443833, 0.000277441227808595, 0.000114584341645241, 0});
-    return w;
+    return { Colin::WavetableData::fourtyFour.begin(), Colin::WavetableData::fourtyFour.end() };
 }
 
 static std::vector<float> echo() {
-    std::vector<float> w({0.000488284975290299, 0.00244142115116119, 0.00439452379941940, 0.00634764507412911, 0.00830078497529030, 0.0102539211511612, 0.0122070237994194, 0.0141601450741291, 0.0161132849752903, 0.0180664211511612, 0.0200195237994194, 0.0219726450741291, 0.0239257849752903, 0.0258789211511612, 0.0278320237994194, 0.0297851450741291, 0.0317382849752903, 0.0336914211511612, 0.0356445237994194, 0.0375976450741291, 0.0395507849752903, 0.0415039211511612, 0.0434570237994194, 0.0454101450741291, 0.0473632849752903, 0.0493164211511612, 0.0512695237994194, 0.0532226450741291, 0.0551757849752903, 0.0571289211511612, 0.0590820237994194, 0.0610351450741291, 0.0629882849752903, 0.0649414211511612, 0.0668945237994194, 0.0688476450741291, 0.0708007849752903, 0.0727539211511612, 0.0747070237994194, 0.0766601450741291, 0.0786132849752903, 0.0805664211511612, 0.0825195237994194, 0.0844726450741291, 0.0864257849752903, 0.0883789211511612, 0.0903320237994194, 0.0922851450741291, 0.0942382849752903, 0.0961914211511612, 0.0981445237994194, 0.100097645074129, 0.102050784975290, 0.104003921151161, 0.105957023799419, 0.107910145074129, 0.109863284975290, 0.111816421151161, 0.113769523799419, 0.115722645074129, 0.117675784975290, 0.119628921151161, 0.121582023799419, 0.123535145074129, 0.125488281250000, 0.127441428601742, 0.129394561052322, 0.131347678601742, 0.133300781250000, 0.135253928601742, 0.137207061052322, 0.139160178601742, 0.141113281250000, 0.143066421151161, 0.145019561052322, 0.146972678601742, 0.148925781250000, 0.150878921151161, 0.152832061052322, 0.154785178601742, 0.156738281250000, 0.158691421151161, 0.160644561052322, 0.162597678601742, 0.164550781250000, 0.166503921151161, 0.168457061052322, 0.170410178601742, 0.172363281250000, 0.174316421151161, 0.176269561052322, 0.178222678601742, 0.180175781250000, 0.182128921151161, 0.184082061052322, 0.186035178601742, 0.187988281250000, 0.189941421151161, 0.191894561052322, 0.193847678601742, 0.195800781250000, 0.197753921151161, 0.199707061052322, 0.201660178601742, 0.203613281250000, 0.205566421151161, 0.207519561052322, 0.209472678601742, 0.211425781250000, 0.213378921151161, 0.215332061052322, 0.217285178601742, 0.219238281250000, 0.221191421151161, 0.223144561052322, 0.225097678601742, 0.227050781250000, 0.229003921151161, 0.230957061052322, 0.232910178601742, 0.234863281250000, 0.236816421151161, 0.238769561052322, 0.240722678601742, 0.242675781250000, 0.244628921151161, 0.246582061052322, 0.193913921713829, 0.125163964927197, 0.125222526490688, 0.125356324017048, 0.125565275549889, 0.125840954482555, 0.126199856400490, 0.126633428037167, 0.127141356468201, 0.127715148031712, 0.128370948135853, 0.129100047051907, 0.129902042448521, 0.130768477916718, 0.131714805960655, 0.132732510566711, 0.133820839226246, 0.134971484541893, 0.136199310421944, 0.137495718896389, 0.138859897851944, 0.140283748507500, 0.141781233251095, 0.143343918025494, 0.144970826804638, 0.146654114127159, 0.148406788706779, 0.150220654904842, 0.152094595134258, 0.154021121561527, 0.156012147665024, 0.158059775829315, 0.160162724554539, 0.162313982844353, 0.164524205029011, 0.166785836219788, 0.169097557663918, 0.171452775597572, 0.173860825598240, 0.176314719021320, 0.178812921047211, 0.181349448859692, 0.183932214975357, 0.186554744839668, 0.189215376973152, 0.191908746957779, 0.194641321897507, 0.197407171130180, 0.200204603374004, 0.203028887510300, 0.205884933471680, 0.208767548203468, 0.211674861609936, 0.214602902531624, 0.217554993927479, 0.220526531338692, 0.223515674471855, 0.226519234478474, 0.229538887739182, 0.232570759952068, 0.235613003373146, 0.238663166761398, 0.241721279919148, 0.244784340262413, 0.247850388288498, 0.250917792320251, 0.253984898328781, 0.257049590349197, 0.260109886527061, 0.263164982199669, 0.266211658716202, 0.269248500466347, 0.272273570299149, 0.275286898016930, 0.278283685445786, 0.281263381242752, 0.284224122762680, 0.287166774272919, 0.290084838867188, 0.292978733778000, 0.295846596360207, 0.298690095543861, 0.301501348614693, 0.304281532764435, 0.307028904557228, 0.309745952486992, 0.312423363327980, 0.315063059329987, 0.317663490772247, 0.320227906107903, 0.322745621204376, 0.325219452381134, 0.327647924423218, 0.330034986138344, 0.332368761301041, 0.334652900695801, 0.336885988712311, 0.339072719216347, 0.341200157999992, 0.343272566795349, 0.345288768410683, 0.347254097461700, 0.349154606461525, 0.350995406508446, 0.352775320410728, 0.354500353336334, 0.356155693531036, 0.357747077941895, 0.359273508191109, 0.360741585493088, 0.362135857343674, 0.363462507724762, 0.364720821380615, 0.365917861461639, 0.367037490010262, 0.368086650967598, 0.369064718484879, 0.369979158043861, 0.370813459157944, 0.371575057506561, 0.372263461351395, 0.372886508703232, 0.373427420854569, 0.373894110321999, 0.374286204576492, 0.374611824750900, 0.374854177236557, 0.375021383166313, 0.363044396042824, 0.347577348351479, 0.347635909914970, 0.347769692540169, 0.347978651523590, 0.348254337906837, 0.348613277077675, 0.349046826362610, 0.349554747343063, 0.350128531455994, 0.350784346461296, 0.351513430476189, 0.352315410971642, 0.353181824088097, 0.354128256440163, 0.355145916342735, 0.356234252452850, 0.357384890317917, 0.358612746000290, 0.359909132122993, 0.361273333430290, 0.362697169184685, 0.364194616675377, 0.365757331252098, 0.367384269833565, 0.369067564606667, 0.370820268988609, 0.372634202241898, 0.374508187174797, 0.376434713602066, 0.378425702452660, 0.380473360419273, 0.382576346397400, 0.384727582335472, 0.386937782168388, 0.389199480414391, 0.391511231660843, 0.393866419792175, 0.396274507045746, 0.398728415369988, 0.401226609945297, 0.403763145208359, 0.406345888972282, 0.408968433737755, 0.411629080772400, 0.414322435855866, 0.417054995894432, 0.419820874929428, 0.422618314623833, 0.425442636013031, 0.428298741579056, 0.431181311607361, 0.434088617563248, 0.437016665935516, 0.439968749880791, 0.442940309643745, 0.445929497480392, 0.448933094739914, 0.451952710747719, 0.454984575510025, 0.458026826381683, 0.461077004671097, 0.464135140180588, 0.467198193073273, 0.470264256000519, 0.473331660032272, 0.476398766040802, 0.479463458061218, 0.482523769140244, 0.485578849911690, 0.488625481724739, 0.491662308573723, 0.494687393307686, 0.497700765728951, 0.500697523355484, 0.503677219152451, 0.506637901067734, 0.509580522775650, 0.512498587369919, 0.515392512083054, 0.518260419368744, 0.521103918552399, 0.523915201425552, 0.526695370674133, 0.529442697763443, 0.532159775495529, 0.534837186336517, 0.537476867437363, 0.540077298879623, 0.542641729116440, 0.545159429311752, 0.547633260488510, 0.550061672925949, 0.552448749542236, 0.554782569408417, 0.557066679000855, 0.559299737215042, 0.561486512422562, 0.563613891601563, 0.565686345100403, 0.567702531814575, 0.569667875766754, 0.571568369865418, 0.573409169912338, 0.575189083814621, 0.576914131641388, 0.578569442033768, 0.580160796642304, 0.581687301397324, 0.583155333995819, 0.584549576044083, 0.585876256227493, 0.587134599685669, 0.588331639766693, 0.589451283216476, 0.590500414371491, 0.591478496789932, 0.592392951250076, 0.593227237462997, 0.593988835811615, 0.594677239656448, 0.595300257205963, 0.595841228961945, 0.596307843923569, 0.596699923276901, 0.597025603055954, 0.597267955541611, 0.597435176372528, 0.554842531681061, 0.501533657312393, 0.507667899131775, 0.513797283172607, 0.519917875528336, 0.526028037071228, 0.532121330499649, 0.538194924592972, 0.544245064258575, 0.550271809101105, 0.556265413761139, 0.562224775552750, 0.568146228790283, 0.574031472206116, 0.579867631196976, 0.585655361413956, 0.591391086578369, 0.597078174352646, 0.602700710296631, 0.608261048793793, 0.613755792379379, 0.619189888238907, 0.624544620513916, 0.629824072122574, 0.635024964809418, 0.640153825283051, 0.645189225673676, 0.650136917829514, 0.654993832111359, 0.659767955541611, 0.664435505867004, 0.669003754854202, 0.673469930887222, 0.677843391895294, 0.682098150253296, 0.686243087053299, 0.690275460481644, 0.694206118583679, 0.698007136583328, 0.701688647270203, 0.705248504877091, 0.708698600530624, 0.712009280920029, 0.715192049741745, 0.718244969844818, 0.721181154251099, 0.723969489336014, 0.726622879505158, 0.729139566421509, 0.731533616781235, 0.733772933483124, 0.735871225595474, 0.737827330827713, 0.739656239748001, 0.741324871778488, 0.742848038673401, 0.744224846363068, 0.745470941066742, 0.746552824974060, 0.747486084699631, 0.748270273208618, 0.748921543359757, 0.749406248331070, 0.749740689992905, 0.749924719333649, 0.749974906444550, 0.749857783317566, 0.749590158462524, 0.749172270298004, 0.748620927333832, 0.747903078794479, 0.747035980224609, 0.746020138263702, 0.744872510433197, 0.743560880422592, 0.742102682590485, 0.740498691797257, 0.738765865564346, 0.736873120069504, 0.734837770462036, 0.732661128044128, 0.730359792709351, 0.727904111146927, 0.725311279296875, 0.722582906484604, 0.719735205173492, 0.716740250587463, 0.713614881038666, 0.710361033678055, 0.706994414329529, 0.703489035367966, 0.699861258268356, 0.696113348007202, 0.692260295152664, 0.688278168439865, 0.684182882308960, 0.679976999759674, 0.675674527883530, 0.671254098415375, 0.666730761528015, 0.662107318639755, 0.657396823167801, 0.652580708265305, 0.647672861814499, 0.642676502466202, 0.637603461742401, 0.632437884807587, 0.627192825078964, 0.621871590614319, 0.616484850645065, 0.611019581556320, 0.605487853288651, 0.599892944097519, 0.594244331121445, 0.588532179594040, 0.582767009735107, 0.576952397823334, 0.571096330881119, 0.565192192792893, 0.559249043464661, 0.553270667791367, 0.547263562679291, 0.541224271059036, 0.535160481929779, 0.529075980186462, 0.522975564002991, 0.516859263181686, 0.510733306407929, 0.0671011954545975, -0.501533716917038, -0.507668018341065, -0.513797312974930, -0.519917905330658, -0.526028156280518, -0.532121390104294, -0.538195043802261, -0.544245183467865, -0.550271898508072, -0.556265443563461, -0.562224835157394, -0.568146318197250, -0.574031531810761, -0.579867660999298, -0.585655450820923, -0.591391146183014, -0.597078174352646, -0.602700710296631, -0.608261108398438, -0.613755911588669, -0.619190007448196, -0.624544739723206, -0.629824191331863, -0.635025054216385, -0.640153825283051, -0.645189225673676, -0.650136917829514, -0.654993832111359, -0.659767985343933, -0.664435595273972, -0.669003844261169, -0.673469990491867, -0.677843391895294, -0.682098239660263, -0.686243087053299, -0.690275460481644, -0.694206148386002, -0.698007225990295, -0.701688766479492, -0.705248504877091, -0.708698600530624, -0.712009280920029, -0.715192049741745, -0.718244969844818, -0.721181184053421, -0.723969608545303, -0.726622939109802, -0.729139566421509, -0.731533646583557, -0.733772933483124, -0.735871225595474, -0.737827330827713, -0.739656239748001, -0.741324871778488, -0.742848038673401, -0.744224846363068, -0.745470941066742, -0.746552824974060, -0.747486114501953, -0.748270303010941, -0.748921573162079, -0.749406248331070, -0.749740689992905, -0.749924719333649, -0.749974906444550, -0.749857783317566, -0.749590158462524, -0.749172270298004, -0.748620927333832, -0.747903078794479, -0.747035980224609, -0.746020138263702, -0.744872510433197, -0.743560880422592, -0.742102622985840, -0.740498632192612, -0.738765805959702, -0.736873030662537, -0.734837740659714, -0.732661128044128, -0.730359792709351, -0.727904081344605, -0.725311189889908, -0.722582817077637, -0.719735205173492, -0.716740250587463, -0.713614881038666, -0.710361033678055, -0.706994414329529, -0.703489035367966, -0.699861198663712, -0.696113258600235, -0.692260205745697, -0.688278138637543, -0.684182882308960, -0.679976910352707, -0.675674438476563, -0.671254068613052, -0.666730672121048, -0.662107259035111, -0.657396823167801, -0.652580648660660, -0.647672802209854, -0.642676413059235, -0.637603372335434, -0.632437884807587, -0.627192825078964, -0.621871501207352, -0.616484671831131, -0.611019521951675, -0.605487793684006, -0.599892884492874, -0.594244241714478, -0.588532179594040, -0.582766920328140, -0.576952278614044, -0.571096211671829, -0.565192073583603, -0.559248954057694, -0.553270548582077, -0.547263443470001, -0.541224122047424, -0.535160362720490, -0.529075860977173, -0.522975504398346, -0.516859233379364, -0.510733217000961, -0.512934178113937, -0.519034415483475, -0.518975913524628, -0.518842071294785, -0.518633097410202, -0.518357425928116, -0.517998486757278, -0.517564982175827, -0.517057061195374, -0.516483217477799, -0.515827417373657, -0.515098303556442, -0.514296352863312, -0.513429909944534, -0.512483477592468, -0.511465877294540, -0.510377585887909, -0.509226858615875, -0.507999002933502, -0.506702572107315, -0.505338370800018, -0.503914564847946, -0.502417087554932, -0.500854343175888, -0.499227419495583, -0.497544139623642, -0.495791479945183, -0.493977516889572, -0.492103531956673, -0.490176990628243, -0.488185957074165, -0.486138328909874, -0.484035357832909, -0.481884077191353, -0.479673936963081, -0.477412238717079, -0.475100487470627, -0.472745299339294, -0.470337197184563, -0.467883273959160, -0.465385064482689, -0.462848588824272, -0.460265845060349, -0.457643255591393, -0.454982548952103, -0.452289149165154, -0.449556559324265, -0.446790695190430, -0.443993270397186, -0.441168963909149, -0.438312873244286, -0.435430288314819, -0.432522967457771, -0.429594919085503, -0.426642894744873, -0.423671305179596, -0.420682102441788, -0.417678549885750, -0.414658978581429, -0.411627069115639, -0.408584803342819, -0.405534610152245, -0.402476459741592, -0.399413451552391, -0.396347403526306, -0.393279969692230, -0.390212863683701, -0.387148171663284, -0.384087875485420, -0.381032779812813, -0.377986147999764, -0.374949321150780, -0.371924206614494, -0.368910819292069, -0.365914031863213, -0.362934395670891, -0.359973683953285, -0.357031077146530, -0.354113012552261, -0.351219087839127, -0.348351225256920, -0.345507696270943, -0.342696368694305, -0.339916214346886, -0.337168857455254, -0.334451809525490, -0.331774398684502, -0.329134702682495, -0.326534226536751, -0.323969766497612, -0.321452081203461, -0.318978205323219, -0.316549777984619, -0.314162760972977, -0.311828926205635, -0.309544801712036, -0.307311728596687, -0.305124998092651, -0.302997618913651, -0.300925195217133, -0.298909008502960, -0.296943664550781, -0.295043155550957, -0.293202385306358, -0.291422456502914, -0.289697393774986, -0.288042068481445, -0.286450624465942, -0.284924209117889, -0.283456161618233, -0.282061949372292, -0.280735254287720, -0.279476910829544, -0.278279885649681, -0.277160286903381, -0.276111096143723, -0.275132983922958, -0.274218514561653, -0.273384213447571, -0.272622659802437, -0.271934255957603, -0.271311208605766, -0.270770311355591, -0.270303666591644, -0.269911542534828, -0.269585877656937, -0.269343525171280, -0.269176274538040, -0.307304620742798, -0.356394916772842, -0.356336385011673, -0.356202572584152, -0.355993598699570, -0.355717912316322, -0.355358973145485, -0.354925468564034, -0.354417532682419, -0.353843718767166, -0.353187918663025, -0.352458804845810, -0.351656839251518, -0.350790426135063, -0.349844023585320, -0.348826363682747, -0.347738027572632, -0.346587330102921, -0.345359489321709, -0.344063028693199, -0.342698872089386, -0.341275081038475, -0.339777588844299, -0.338214844465256, -0.336587920784950, -0.334904640913010, -0.333151966333389, -0.331338018178940, -0.329464018344879, -0.327537462115288, -0.325546443462372, -0.323498800396919, -0.321395844221115, -0.319244608283043, -0.317034482955933, -0.314772754907608, -0.312461018562317, -0.310105845332146, -0.307697758078575, -0.305243790149689, -0.302745580673218, -0.300209090113640, -0.297626331448555, -0.295003771781921, -0.292343080043793, -0.289649650454521, -0.286917045712471, -0.284151211380959, -0.281353786587715, -0.278529465198517, -0.275673404335976, -0.272790819406509, -0.269883513450623, -0.266955479979515, -0.264003425836563, -0.261031851172447, -0.258042633533478, -0.255039051175118, -0.252019479870796, -0.248987577855587, -0.245945326983929, -0.242895163595676, -0.239836998283863, -0.236774004995823, -0.233707971870899, -0.230640552937984, -0.227573469281197, -0.224508777260780, -0.221448488533497, -0.218393407762051, -0.215346783399582, -0.212309956550598, -0.209284849464893, -0.206271439790726, -0.203274652361870, -0.200295016169548, -0.197334319353104, -0.194391712546349, -0.191473647952080, -0.188579723238945, -0.185711868107319, -0.182868368923664, -0.180057048797607, -0.177276894450188, -0.174529537558556, -0.171812482178211, -0.169135086238384, -0.166495382785797, -0.163894928991795, -0.161330491304398, -0.158812828361988, -0.156338952481747, -0.153910540044308, -0.151523537933826, -0.149189725518227, -0.146905601024628, -0.144672520458698, -0.142485752701759, -0.140358336269856, -0.138285912573338, -0.136269725859165, -0.134304381906986, -0.132403895258904, -0.130563139915466, -0.128783226013184, -0.127058163285255, -0.125402830541134, -0.123811390250921, -0.122284956276417, -0.120816916227341, -0.119422696530819, -0.118096001446247, -0.116837665438652, -0.115640643984079, -0.114521048963070, -0.113471850752831, -0.112493745982647, -0.111579269170761, -0.110744960606098, -0.109983410686255, -0.109295036643744, -0.108672019094229, -0.108131125569344, -0.107664458453655, -0.107272341847420, -0.106946676969528, -0.106704324483871, -0.106537073850632, -0.169266812503338, -0.249511726200581, -0.247558623552322, -0.245605453848839, -0.243652321398258, -0.241699226200581, -0.239746123552322, -0.237792953848839, -0.235839821398258, -0.233886726200581, -0.231933623552322, -0.229980453848839, -0.228027321398258, -0.226074226200581, -0.224121123552322, -0.222167953848839, -0.220214821398258, -0.218261726200581, -0.216308623552322, -0.214355453848839, -0.212402321398258, -0.210449226200581, -0.208496123552322, -0.206542953848839, -0.204589821398258, -0.202636726200581, -0.200683623552322, -0.198730453848839, -0.196777321398258, -0.194824226200581, -0.192871123552322, -0.190917953848839, -0.188964821398258, -0.187011726200581, -0.185058623552322, -0.183105453848839, -0.181152321398258, -0.179199226200581, -0.177246123552322, -0.175292953848839, -0.173339821398258, -0.171386726200581, -0.169433623552322, -0.167480453848839, -0.165527321398258, -0.163574226200581, -0.161621123552322, -0.159667953848839, -0.157714821398258, -0.155761726200581, -0.153808623552322, -0.151855453848839, -0.149902321398258, -0.147949226200581, -0.145996123552322, -0.144042953848839, -0.142089821398258, -0.140136726200581, -0.138183623552322, -0.136230453848839, -0.134277321398258, -0.132324226200581, -0.130371123552322, -0.128417953848839, -0.126464821398258, -0.124511726200581, -0.122558623552322, -0.120605453848839, -0.118652321398258, -0.116699226200581, -0.114746123552322, -0.112792953848839, -0.110839821398258, -0.108886726200581, -0.106933623552322, -0.104980453848839, -0.103027321398258, -0.101074226200581, -0.0991211235523224, -0.0971679538488388, -0.0952148213982582, -0.0932617262005806, -0.0913086235523224, -0.0893554538488388, -0.0874023213982582, -0.0854492262005806, -0.0834961235523224, -0.0815429538488388, -0.0795898213982582, -0.0776367262005806, -0.0756836235523224, -0.0737304538488388, -0.0717773213982582, -0.0698242262005806, -0.0678711235523224, -0.0659179538488388, -0.0639648213982582, -0.0620117262005806, -0.0600586235523224, -0.0581054538488388, -0.0561523213982582, -0.0541992262005806, -0.0522461235523224, -0.0502929538488388, -0.0483398213982582, -0.0463867262005806, -0.0444336235523224, -0.0424804538488388, -0.0405273213982582, -0.0385742262005806, -0.0366211235523224, -0.0346679538488388, -0.0327148213982582, -0.0307617262005806, -0.0288086235523224, -0.0268554538488388, -0.0249023213982582, -0.0229492262005806, -0.0209961235523224, -0.0190429538488388, -0.0170898213982582, -0.0151367262005806, -0.0131836235523224, -0.0112304538488388, -0.00927732139825821, -0.00732422620058060, -0.00537112355232239, -0.00341795384883881, -0.00260412693023682});
-    return w;
+    return { Colin::WavetableData::echo.begin(), Colin::WavetableData::echo.end() };
 }
 
 static std::vector<float> juliett() {
-    std::vector<float> w({-0.00153288245201111, -0.00766222923994064, -0.0137719288468361, -0.0198466479778290, -0.0258799195289612, -0.0318458005785942, -0.0377338305115700, -0.0435292497277260, -0.0492324531078339, -0.0548055991530418, -0.0602456405758858, -0.0655390173196793, -0.0706929937005043, -0.0756592974066734, -0.0804422721266747, -0.0850301310420036, -0.0894367545843124, -0.0936053246259689, -0.0975475162267685, -0.101253628730774, -0.104743607342243, -0.107954286038876, -0.110904119908810, -0.113586015999317, -0.116025194525719, -0.118154488503933, -0.119998730719090, -0.121553383767605, -0.122847996652126, -0.123814135789871, -0.124481812119484, -0.124849461019039, -0.124949820339680, -0.124715715646744, -0.124181136488914, -0.123347647488117, -0.122249908745289, -0.120824538171291, -0.119108282029629, -0.117105677723885, -0.114851973950863, -0.112290054559708, -0.109458103775978, -0.106363371014595, -0.103040337562561, -0.0994403809309006, -0.0956015735864639, -0.0915336161851883, -0.0872689262032509, -0.0827692747116089, -0.0780710726976395, -0.0731862634420395, -0.0681438893079758, -0.0629174187779427, -0.0575404092669487, -0.0520263686776161, -0.0463999435305595, -0.0406475663185120, -0.0347984284162521, -0.0288671851158142, -0.0228730738162994, -0.0168158486485481, -0.0107192620635033, -0.00459864735603333, 0.00153289362788200, 0.00766227766871452, 0.0137719474732876, 0.0198466479778290, 0.0258799307048321, 0.0318458490073681, 0.0377338491380215, 0.0435292236506939, 0.0492324158549309, 0.0548056438565254, 0.0602457001805306, 0.0655390247702599, 0.0706929452717304, 0.0756592936813831, 0.0804423131048679, 0.0850301906466484, 0.0894368141889572, 0.0936053842306137, 0.0975475758314133, 0.101253662258387, 0.104743596166372, 0.107954241335392, 0.110904142260551, 0.113586049526930, 0.116025194525719, 0.118154488503933, 0.119998730719090, 0.121553383767605, 0.122848007827997, 0.123814184218645, 0.124481830745935, 0.124849461019039, 0.124949820339680, 0.124715719372034, 0.124181177467108, 0.123347681015730, 0.122249897569418, 0.120824489742517, 0.119108263403177, 0.117105677723885, 0.114851973950863, 0.112290058284998, 0.109458144754171, 0.106363404542208, 0.103040337562561, 0.0994403809309006, 0.0956015735864639, 0.0915336161851883, 0.0872689262032509, 0.0827692747116089, 0.0780710726976395, 0.0731862373650074, 0.0681438408792019, 0.0629174076020718, 0.0575403682887554, 0.0520263612270355, 0.0464000031352043, 0.0406476221978664, 0.0347984470427036, 0.0288671851158142, 0.0228730514645576, 0.0168157517910004, 0.0107192248106003, 0.113973647356033, 0.248467117547989, 0.242337778210640, 0.236228108406067, 0.230153389275074, 0.224120065569878, 0.218154154717922, 0.212266191840172, 0.206470817327499, 0.200767591595650, 0.195194363594055, 0.189754337072372, 0.184461005032063, 0.179307065904140, 0.174340754747391, 0.169557705521584, 0.164969839155674, 0.160563245415688, 0.156394675374031, 0.152452446520329, 0.148746334016323, 0.145256400108337, 0.142045758664608, 0.139095857739449, 0.136413954198360, 0.133974805474281, 0.131845518946648, 0.130001306533813, 0.128446646034718, 0.127151995897293, 0.126185812056065, 0.125518172979355, 0.125150538980961, 0.125050179660320, 0.125284284353256, 0.125818818807602, 0.126652322709560, 0.127750098705292, 0.129175506532192, 0.130891740322113, 0.132894322276115, 0.135148026049137, 0.137709945440292, 0.140541851520538, 0.143636591732502, 0.146959662437439, 0.150559619069099, 0.154398426413536, 0.158466383814812, 0.162731073796749, 0.167230725288391, 0.171928882598877, 0.176813729107380, 0.181856155395508, 0.187082588672638, 0.192459590733051, 0.197973608970642, 0.203600004315376, 0.209352374076843, 0.215201511979103, 0.221132777631283, 0.227126941084862, 0.233184196054935, 0.239280760288239, 0.245401352643967, 0.251532897353172, 0.257662296295166, 0.263771951198578, 0.269846647977829, 0.275879934430122, 0.281845852732658, 0.287733852863312, 0.293529212474823, 0.299232408404350, 0.304805636405945, 0.310245707631111, 0.315539032220840, 0.320692956447601, 0.325659289956093, 0.330442324280739, 0.335030198097229, 0.339436814188957, 0.343605384230614, 0.347547575831413, 0.351253643631935, 0.354743599891663, 0.357954233884811, 0.360904142260551, 0.363586038351059, 0.366025194525719, 0.368154495954514, 0.369998723268509, 0.371553376317024, 0.372848004102707, 0.373814165592194, 0.374481827020645, 0.374849453568459, 0.374949812889099, 0.374715715646744, 0.374181166291237, 0.373347669839859, 0.372249901294708, 0.370824500918388, 0.369108259677887, 0.367105677723885, 0.364851981401444, 0.362290054559708, 0.359458133578301, 0.356363400816917, 0.353040337562561, 0.349440366029739, 0.345601588487625, 0.341533616185188, 0.337268918752670, 0.332769274711609, 0.328071072697639, 0.323186248540878, 0.318143844604492, 0.312917411327362, 0.307540372014046, 0.302026361227036, 0.296399995684624, 0.290647611021996, 0.284798443317413, 0.278867185115814, 0.272873044013977, 0.266815751791000, 0.260719224810600, 0.363973647356033, 0.498467117547989, 0.492337778210640, 0.486228108406067, 0.480153366923332, 0.474120065569878, 0.468154162168503, 0.462266191840172, 0.456470832228661, 0.450767591595650, 0.445194378495216, 0.439754337072372, 0.434460997581482, 0.429307058453560, 0.424340739846230, 0.419557705521584, 0.414969816803932, 0.410563230514526, 0.406394660472870, 0.402452453970909, 0.398746356368065, 0.395256400108337, 0.392045766115189, 0.389095857739449, 0.386413961648941, 0.383974805474281, 0.381845518946648, 0.380001306533814, 0.378446638584137, 0.377151995897293, 0.376185834407806, 0.375518172979355, 0.375150546431541, 0.375050187110901, 0.375284284353256, 0.375818833708763, 0.376652330160141, 0.377750098705292, 0.379175499081612, 0.380891740322113, 0.382894322276115, 0.385148018598557, 0.387709945440292, 0.390541866421700, 0.393636599183083, 0.396959662437439, 0.400559633970261, 0.404398411512375, 0.408466368913651, 0.412731066346169, 0.417230725288391, 0.421928882598877, 0.426813706755638, 0.431856155395508, 0.437082588672638, 0.442459583282471, 0.447973608970642, 0.453600004315376, 0.459352388978004, 0.465201511979103, 0.471132785081863, 0.477126926183701, 0.483184188604355, 0.489280760288239, 0.495401352643967, 0.501532882452011, 0.507662236690521, 0.513771921396256, 0.519846647977829, 0.525879949331284, 0.531845927238464, 0.537733852863312, 0.543529272079468, 0.549232453107834, 0.554805636405945, 0.560245692729950, 0.565539062023163, 0.570692986249924, 0.575659304857254, 0.580442309379578, 0.585030198097229, 0.589436769485474, 0.593605339527130, 0.597547531127930, 0.601253628730774, 0.604743599891663, 0.607954263687134, 0.610904127359390, 0.613586038351059, 0.616025209426880, 0.618154495954514, 0.619998723268509, 0.621553361415863, 0.622848004102707, 0.623814165592194, 0.624481797218323, 0.624849438667297, 0.624949812889099, 0.624715685844421, 0.624181151390076, 0.623347669839859, 0.622249901294708, 0.620824486017227, 0.619108259677887, 0.617105692625046, 0.614851981401444, 0.612290054559708, 0.609458118677139, 0.606363385915756, 0.603040337562561, 0.599440366029739, 0.595601588487625, 0.591533631086350, 0.587268948554993, 0.582769244909287, 0.578071057796478, 0.573186248540878, 0.568143904209137, 0.562917411327362, 0.557540416717529, 0.552026420831680, 0.546400040388107, 0.540647596120834, 0.534798413515091, 0.528867185115814, 0.522873044013977, 0.516815721988678, 0.510719239711762, 0.613973647356033, 0.747437953948975, 0.736762762069702, 0.722244501113892, 0.706872224807739, 0.692780971527100, 0.682105779647827, 0.667587518692017, 0.652215242385864, 0.638123989105225, 0.627448797225952, 0.612930536270142, 0.597558259963989, 0.583467006683350, 0.572791814804077, 0.558273553848267, 0.542901277542114, 0.528810024261475, 0.518134832382202, 0.503616541624069, 0.488244250416756, 0.474153041839600, 0.463477849960327, 0.448959544301033, 0.433587267994881, 0.419496059417725, 0.408820867538452, 0.394302561879158, 0.378930285573006, 0.364839076995850, 0.354163885116577, 0.339645579457283, 0.324273303151131, 0.310182079672813, 0.299506843090057, 0.284988582134247, 0.269616320729256, 0.255525112152100, 0.244849875569344, 0.230331599712372, 0.214959345757961, 0.200868122279644, 0.190192893147469, 0.175674617290497, 0.160302363336086, 0.146211139857769, 0.135535918176174, 0.121017638593912, 0.105645384639502, 0.0915541574358940, 0.0808789357542992, 0.0663606561720371, 0.0509884022176266, 0.0368971750140190, 0.0262219505384564, 0.0117036746814847, -0.00366858020424843, -0.0177597999572754, -0.0284349918365479, -0.0429532527923584, -0.0583255290985107, -0.0724167823791504, -0.0830919742584229, -0.0976102352142334, -0.112982511520386, -0.127073764801025, -0.137748964130878, -0.152267292141914, -0.167639546096325, -0.181730747222900, -0.192405946552753, -0.206924274563789, -0.222296528518200, -0.236387729644775, -0.247062921524048, -0.261581271886826, -0.276953533291817, -0.291044712066650, -0.301719903945923, -0.316238254308701, -0.331610515713692, -0.345701694488525, -0.356376886367798, -0.370895236730576, -0.386267498135567, -0.400358676910400, -0.411033868789673, -0.425552219152451, -0.440924480557442, -0.455015659332275, -0.465690851211548, -0.480209201574326, -0.495581462979317, -0.509672641754150, -0.520347833633423, -0.534866183996201, -0.550238460302353, -0.564329624176025, -0.575004816055298, -0.589523166418076, -0.604895442724228, -0.618986606597900, -0.629661798477173, -0.644180148839951, -0.659552425146103, -0.673643589019775, -0.684318780899048, -0.698837131261826, -0.714209407567978, -0.728300571441650, -0.738975763320923, -0.753494113683701, -0.768866389989853, -0.782957553863525, -0.793632745742798, -0.808151096105576, -0.823523372411728, -0.837614536285400, -0.848289728164673, -0.862808078527451, -0.878180354833603, -0.892271518707275, -0.902946710586548, -0.917465060949326, -0.932837337255478, -0.946928501129150, -0.957603693008423, -0.972122043371201, -0.122315928339958, 0.974684089422226, 0.959738731384277, 0.948636531829834, 0.935399323701859, 0.920027107000351, 0.905081748962402, 0.893979549407959, 0.880742341279984, 0.865370124578476, 0.850424766540527, 0.839322566986084, 0.826085358858109, 0.810713142156601, 0.795767784118652, 0.784665584564209, 0.771428376436234, 0.756056159734726, 0.741110801696777, 0.730008602142334, 0.716771394014359, 0.701399177312851, 0.686453819274902, 0.675351619720459, 0.662114411592484, 0.646742194890976, 0.631796836853027, 0.620694637298584, 0.607457429170609, 0.592085212469101, 0.577139854431152, 0.566037654876709, 0.552800446748734, 0.537428230047226, 0.522482872009277, 0.511380672454834, 0.498143464326859, 0.482771247625351, 0.467825904488564, 0.456723690032959, 0.443486496806145, 0.428114265203476, 0.413168922066689, 0.402066707611084, 0.388829514384270, 0.373457282781601, 0.358511939644814, 0.347409725189209, 0.334172531962395, 0.318800300359726, 0.303854957222939, 0.292752742767334, 0.279515549540520, 0.264143317937851, 0.249197974801064, 0.238095760345459, 0.224858567118645, 0.209486328065395, 0.194540992379189, 0.183438777923584, 0.170201584696770, 0.154829345643520, 0.139884009957314, 0.128781795501709, 0.115544557571411, 0.100172281265259, 0.0852270126342773, 0.0741248130798340, 0.0608875751495361, 0.0455152988433838, 0.0305700302124023, 0.0194678306579590, 0.00623061880469322, -0.00914162676781416, -0.0240869084373117, -0.0351891368627548, -0.0484263636171818, -0.0637986101210117, -0.0787438936531544, -0.0898461192846298, -0.103083346039057, -0.118455592542887, -0.133400879800320, -0.144503101706505, -0.157740332186222, -0.173112571239471, -0.188057854771614, -0.199160084128380, -0.212397314608097, -0.227769561111927, -0.242714837193489, -0.253817066550255, -0.267054304480553, -0.282426536083221, -0.297371804714203, -0.308474048972130, -0.321711286902428, -0.337083533406258, -0.352028846740723, -0.363131046295166, -0.376368269324303, -0.391740515828133, -0.406685829162598, -0.417788028717041, -0.431025251746178, -0.446397498250008, -0.461342811584473, -0.472445011138916, -0.485682234168053, -0.501054495573044, -0.515999794006348, -0.527101993560791, -0.540339231491089, -0.555711507797241, -0.570656776428223, -0.581758975982666, -0.594996213912964, -0.610368490219116, -0.625313758850098, -0.636415958404541, -0.649653196334839, -0.665025472640991, -0.679970741271973, -0.691072940826416, -0.704310178756714, -0.719682455062866, -0.734627723693848, -0.745729923248291, -0.644201725721359, -0.509701669216156, -0.515802562236786, -0.521864205598831, -0.527871429920197, -0.533820003271103, -0.539679884910584, -0.545443087816238, -0.551095098257065, -0.556638658046722, -0.562032401561737, -0.567275583744049, -0.572355180978775, -0.577280700206757, -0.582000941038132, -0.586522668600082, -0.590834647417069, -0.594952911138535, -0.598818272352219, -0.602444767951965, -0.605823427438736, -0.608976095914841, -0.611838072538376, -0.614429980516434, -0.616745501756668, -0.618811458349228, -0.620559990406036, -0.622017711400986, -0.623181074857712, -0.624080896377564, -0.624648869037628, -0.624916374683380, -0.624882936477661, -0.624582052230835, -0.623947530984879, -0.623014539480209, -0.621785581111908, -0.620295554399490, -0.618483006954193, -0.616385340690613, -0.614008039236069, -0.611386150121689, -0.608465224504471, -0.605283498764038, -0.601849228143692, -0.598196208477020, -0.594279140233994, -0.590135693550110, -0.585776418447495, -0.581232696771622, -0.576470047235489, -0.571524113416672, -0.566407322883606, -0.561147421598434, -0.555722177028656, -0.550163775682449, -0.544486165046692, -0.538712322711945, -0.532833009958267, -0.526875704526901, -0.520855456590653, -0.514789491891861, -0.508681982755661, -0.502554804086685, -0.496423274278641, -0.490298300981522, -0.484197378158569, -0.478135764598846, -0.472128540277481, -0.466179952025414, -0.460320070385933, -0.454556927084923, -0.448904931545258, -0.443361341953278, -0.437967598438263, -0.432724446058273, -0.427644863724709, -0.422719269990921, -0.417999058961868, -0.413477346301079, -0.409165352582932, -0.405047088861465, -0.401181727647781, -0.397555232048035, -0.394176542758942, -0.391023844480515, -0.388161942362785, -0.385570019483566, -0.383254483342171, -0.381188541650772, -0.379439994692802, -0.377982288599014, -0.376818865537643, -0.375919044017792, -0.375351130962372, -0.375083625316620, -0.375117078423500, -0.375417947769165, -0.376052439212799, -0.376985430717468, -0.378214478492737, -0.379704505205154, -0.381517037749290, -0.383614644408226, -0.385991960763931, -0.388613864779472, -0.391534805297852, -0.394716471433640, -0.398150771856308, -0.401803791522980, -0.405720859766006, -0.409864306449890, -0.414223581552506, -0.418767318129540, -0.423529997467995, -0.428475961089134, -0.433592736721039, -0.438852608203888, -0.444277837872505, -0.449836239218712, -0.455513849854469, -0.461287751793861, -0.467167049646378, -0.473124310374260, -0.479144573211670, -0.485210567712784, -0.491318047046661, -0.497445195913315, -0.394201725721359, -0.259701684117317, -0.265802562236786, -0.271864235401154, -0.277871429920197, -0.283820003271103, -0.289679929614067, -0.295443072915077, -0.301095038652420, -0.306638613343239, -0.312032386660576, -0.317275553941727, -0.322355121374130, -0.327280685305595, -0.332000941038132, -0.336522653698921, -0.340834662318230, -0.344952926039696, -0.348818272352219, -0.352444767951965, -0.355823457241058, -0.358976155519486, -0.361838057637215, -0.364429980516434, -0.366745516657829, -0.368811458349228, -0.370560005307198, -0.372017711400986, -0.373181134462357, -0.374080955982208, -0.374648869037628, -0.374916374683380, -0.374882921576500, -0.374582052230835, -0.373947560787201, -0.373014569282532, -0.371785566210747, -0.370295554399490, -0.368482977151871, -0.366385355591774, -0.364008039236069, -0.361386135220528, -0.358465194702148, -0.355283528566361, -0.351849228143692, -0.348196223378181, -0.344279184937477, -0.340135768055916, -0.335776433348656, -0.331232696771622, -0.326470062136650, -0.321524068713188, -0.316407293081284, -0.311147436499596, -0.305722177028656, -0.300163760781288, -0.294486165046692, -0.288712292909622, -0.282832950353622, -0.276875689625740, -0.270855456590652, -0.264789491891861, -0.258682012557983, -0.252554818987846, -0.246423274278641, -0.240298300981522, -0.234197378158569, -0.228135749697685, -0.222128540277481, -0.216179952025414, -0.210320070385933, -0.204556927084923, -0.198904938995838, -0.193361334502697, -0.187967598438263, -0.182724446058273, -0.177644841372967, -0.172719269990921, -0.167999044060707, -0.163477338850498, -0.159165337681770, -0.155047073960304, -0.151181727647781, -0.147555232048035, -0.144176535308361, -0.141023844480515, -0.138161927461624, -0.135570012032986, -0.133254483342171, -0.131188541650772, -0.129440002143383, -0.127982288599014, -0.126818872988224, -0.125919044017792, -0.125351116061211, -0.125083632767200, -0.125117085874081, -0.125417947769165, -0.126052431762218, -0.126985430717468, -0.128214471042156, -0.129704505205154, -0.131517030298710, -0.133614644408226, -0.135991968214512, -0.138613864779472, -0.141534790396690, -0.144716471433640, -0.148150779306889, -0.151803791522980, -0.155720867216587, -0.159864291548729, -0.164223574101925, -0.168767318129540, -0.173529997467995, -0.178475961089134, -0.183592729270458, -0.188852608203888, -0.194277830421925, -0.199836239218712, -0.205513864755631, -0.211287751793861, -0.217167057096958, -0.223124310374260, -0.229144573211670, -0.235210567712784, -0.241318039596081, -0.247445195913315, -0.144201725721359, -0.00970168411731720, -0.0158025696873665, -0.0218642279505730, -0.0278714299201965, -0.0338199995458126, -0.0396799296140671, -0.0454430654644966, -0.0510950386524200, -0.0566386170685291, -0.0620323903858662, -0.0672755576670170, -0.0723551325500011, -0.0772806853055954, -0.0820009484887123, -0.0865226611495018, -0.0908346623182297, -0.0949529260396957, -0.0988182723522186, -0.102444767951965, -0.105823468416929, -0.108976159244776, -0.111838072538376, -0.114429987967014, -0.116745516657829, -0.118811454623938, -0.120559994131327, -0.122017715126276, -0.123181123286486, -0.124080959707499, -0.124648883938789, -0.124916367232800, -0.124882914125919, -0.124582048505545, -0.123947571963072, -0.123014565557241, -0.121785558760166, -0.120295546948910, -0.118482977151871, -0.116385355591774, -0.114008028060198, -0.111386135220528, -0.108465205878019, -0.105283532291651, -0.101849224418402, -0.0981962233781815, -0.0942791849374771, -0.0901357680559158, -0.0857764557003975, -0.0812326930463314, -0.0764700435101986, -0.0715240649878979, -0.0664073005318642, -0.0611474439501762, -0.0557221844792366, -0.0501637533307076, -0.0444861538708210, -0.0387122966349125, -0.0328329540789127, -0.0268756933510304, -0.0208554565906525, -0.0147894956171513, -0.00868201628327370, -0.00255482271313667, 0.00357672572135925, 0.00970170646905899, 0.0158026665449142, 0.0218642652034760, 0.0278714299201965, 0.0338199883699417, 0.0396798774600029, 0.0454430058598518, 0.0510950312018395, 0.0566386654973030, 0.0620324015617371, 0.0672755986452103, 0.0723551660776138, 0.0772806853055954, 0.0820009484887123, 0.0865226611495018, 0.0908346623182297, 0.0949529260396957, 0.0988182723522186, 0.102444767951965, 0.105823442339897, 0.108976110816002, 0.111838065087795, 0.114429987967014, 0.116745516657829, 0.118811465799809, 0.120560042560101, 0.122017733752728, 0.123181097209454, 0.124080911278725, 0.124648876488209, 0.124916367232800, 0.124882914125919, 0.124582037329674, 0.123947523534298, 0.123014546930790, 0.121785558760166, 0.120295546948910, 0.118482977151871, 0.116385355591774, 0.114008001983166, 0.111386097967625, 0.108465246856213, 0.105283550918102, 0.101849198341370, 0.0981961637735367, 0.0942791253328323, 0.0901357084512711, 0.0857763960957527, 0.0812326446175575, 0.0764700397849083, 0.0715241059660912, 0.0664073079824448, 0.0611473843455315, 0.0557221323251724, 0.0501637756824493, 0.0444861873984337, 0.0387122854590416, 0.0328329056501389, 0.0268756747245789, 0.0208554565906525, 0.0147894844412804, 0.00868196785449982, 0.00255480408668518, 0});
-    return w;
+    return { Colin::WavetableData::juliett.begin(), Colin::WavetableData::juliett.end() };
 }
 
 static std::vector<float> crayon() {
-    std::vector<float> w({0.00312136812135584, 0.0156039819121361, 0.0280751641839743, 0.0405257772654295, 0.0529466923326254, 0.0653288085013628, 0.0776630565524101, 0.0899403765797615, 0.102151773869991, 0.114288274198771, 0.126340981572866, 0.138301029801369, 0.150159642100334, 0.161908075213432, 0.173537686467171, 0.185039930045605, 0.196406297385693, 0.207628406584263, 0.218697980046272, 0.229606807231903, 0.240346826612949, 0.250910073518753, 0.261288687586784, 0.271474972367287, 0.281461298465729, 0.291240260004997, 0.300804540514946, 0.310146898031235, 0.319260403513908, 0.328138172626495, 0.336773455142975, 0.345159813761711, 0.353290766477585, 0.361160174012184, 0.368761986494064, 0.376090422272682, 0.383139759302139, 0.389904588460922, 0.396379604935646, 0.402559772133827, 0.408440172672272, 0.414016157388687, 0.419283255934715, 0.424237221479416, 0.428874000906944, 0.433189764618874, 0.437180921435356, 0.440844044089317, 0.444175973534584, 0.447173789143562, 0.449834764003754, 0.452156394720078, 0.454136431217194, 0.455772861838341, 0.457063853740692, 0.458007872104645, 0.458603590726852, 0.458849892020226, 0.458745971322060, 0.458291187882423, 0.457485154271126, 0.456327721476555, 0.454819023609161, 0.452959373593330, 0.450749337673187, 0.448189735412598, 0.445281639695168, 0.442026287317276, 0.438425242900848, 0.434480249881744, 0.430193275213242, 0.425566539168358, 0.420602530241013, 0.415303871035576, 0.409673497080803, 0.403714537620544, 0.397430345416069, 0.390824466943741, 0.383900746703148, 0.376663148403168, 0.369115889072418, 0.361263394355774, 0.353110328316689, 0.344661518931389, 0.335921987891197, 0.326896995306015, 0.317591950297356, 0.308012485504150, 0.298164427280426, 0.288053721189499, 0.277686536312103, 0.267069265246391, 0.256208330392838, 0.245110474526882, 0.233782522380352, 0.222231447696686, 0.210464380681515, 0.198488652706146, 0.186311654746532, 0.173940971493721, 0.161384277045727, 0.148649431765080, 0.135744340717793, 0.122677102684975, 0.109455857425928, 0.0960888825356960, 0.0825845561921597, 0.0689513459801674, 0.0551978014409542, 0.0413325540721417, 0.0273643182590604, 0.0133018717169762, -0.000845940900035203, -0.0150702190585434, -0.0293620098382235, -0.0437123123556376, -0.0581120867282152, -0.0725522674620152, -0.0870237499475479, -0.101517409086227, -0.116024114191532, -0.130534715950489, -0.145040087401867, -0.159531056880951, -0.173998504877090, -0.188433304429054, -0.202826373279095, -0.217168629169464, -0.231451041996479, -0.245664626359940, -0.259800449013710, -0.273849561810493, -0.287803202867508, -0.301652565598488, -0.315388932824135, -0.329003706574440, -0.342488363385201, -0.355834409594536, -0.369033500552177, -0.382077381014824, -0.394957929849625, -0.407667055726051, -0.420196831226349, -0.432539522647858, -0.444687351584435, -0.456632867455483, -0.468368574976921, -0.479887261986733, -0.491181805729866, -0.502245217561722, -0.513070672750473, -0.523651599884033, -0.533981412649155, -0.544053822755814, -0.553862810134888, -0.563402175903320, -0.572666347026825, -0.581649690866470, -0.590346753597260, -0.598752349615097, -0.606861472129822, -0.614669352769852, -0.622171282768250, -0.629362970590591, -0.636240154504776, -0.642798930406570, -0.649035483598709, -0.654946327209473, -0.660528033971787, -0.665777623653412, -0.670692175626755, -0.675269067287445, -0.679505854845047, -0.683400332927704, -0.686950564384460, -0.690154939889908, -0.693011790513992, -0.695520013570786, -0.697678565979004, -0.699486553668976, -0.700943619012833, -0.702049285173416, -0.702803641557694, -0.703206777572632, -0.703259080648422, -0.702961325645447, -0.702314287424088, -0.701319128274918, -0.699977189302445, -0.698290079832077, -0.696259617805481, -0.693887889385223, -0.691177189350128, -0.688130021095276, -0.684749156236649, -0.681037604808807, -0.676998436450958, -0.672635167837143, -0.667951494455338, -0.662951201200485, -0.657638341188431, -0.652017295360565, -0.646092474460602, -0.639868617057800, -0.633350610733032, -0.626543581485748, -0.619452804327011, -0.612083792686462, -0.604442209005356, -0.596533924341202, -0.588365018367767, -0.579941630363464, -0.571270257234573, -0.562357366085053, -0.553209751844406, -0.543834239244461, -0.534237951040268, -0.524428039789200, -0.514411747455597, -0.504196703433991, -0.493790447711945, -0.483200684189796, -0.472435295581818, -0.461502328515053, -0.450409784913063, -0.439165920019150, -0.427779033780098, -0.416257530450821, -0.404609858989716, -0.392844676971436, -0.380970597267151, -0.368996366858482, -0.356930747628212, -0.344782680273056, -0.332561016082764, -0.320274755358696, -0.307932883501053, -0.295544505119324, -0.283118635416031, -0.270664423704147, -0.258190974593163, -0.245707459747791, -0.233222991228104, -0.220746740698814, -0.208287827670574, -0.195855386555195, -0.183458544313908, -0.171106368303299, -0.158807940781116, -0.146572254598141, -0.134408302605152, -0.122325021773577, -0.110331270843744, -0.0984358713030815, -0.0866475664079189, -0.0749750435352325, -0.0634268932044506, -0.0520116258412600, -0.0407376624643803, -0.0296133300289512, -0.0186468567699194, -0.00784635869786143, 0.00278015859657899, 0.0132248057052493, 0.0234798202291131, 0.0335375647991896, 0.0433905385434628, 0.0530313719063997, 0.0624528545886278, 0.0716479122638702, 0.0806096233427525, 0.0893312245607376, 0.0978061333298683, 0.106027908623219, 0.113990295678377, 0.121687214821577, 0.129112757742405, 0.136261209845543, 0.143127039074898, 0.149704910814762, 0.155989661812782, 0.161976374685764, 0.167660295963287, 0.173036880791187, 0.178101792931557, 0.182850934565067, 0.187280394136906, 0.191386468708515, 0.195165708661079, 0.198614850640297, 0.201730877161026, 0.204511001706123, 0.206952631473541, 0.209053441882133, 0.210811316967011, 0.212224379181862, 0.213290996849537, 0.214009739458561, 0.214379444718361, 0.214399173855782, 0.214068233966827, 0.213386155664921, 0.212352715432644, 0.210967928171158, 0.209232054650784, 0.207145564258099, 0.204709194600582, 0.201923929154873, 0.198790945112705, 0.195311687886715, 0.191487833857536, 0.187321268022060, 0.182814151048660, 0.177968852221966, 0.172787941992283, 0.167274266481400, 0.161430880427361, 0.155261039733887, 0.148768253624439, 0.141956225037575, 0.134828887879848, 0.127390392124653, 0.119645088911057, 0.111597541719675, 0.103252511471510, 0.0946149714291096, 0.0856900922954083, 0.0764832347631455, 0.0669999457895756, 0.0572459679096937, 0.0472272299230099, 0.0369498319923878, 0.0264200558885932, 0.0156443458981812, 0.00462932139635086, -0.00661824003327638, -0.0180914020165801, -0.0297830766066909, -0.0416860245168209, -0.0537928678095341, -0.0660960860550404, -0.0785880275070667, -0.0912609212100506, -0.104106850922108, -0.117117807269096, -0.130285657942295, -0.143602162599564, -0.157058984041214, -0.170647695660591, -0.184359766542912, -0.198186591267586, -0.212119482457638, -0.226149693131447, -0.240268401801586, -0.254466712474823, -0.268735721707344, -0.283066406846046, -0.297449767589569, -0.311876714229584, -0.326338201761246, -0.340825065970421, -0.355328232049942, -0.369838491082191, -0.384346768260002, -0.398843854665756, -0.413320630788803, -0.427767992019653, -0.442176833748817, -0.456538036465645, -0.470842599868774, -0.485081508755684, -0.499245762825012, -0.513326495885849, -0.527314811944962, -0.541201978921890, -0.554979205131531, -0.568637847900391, -0.582169383764267, -0.595565319061279, -0.608817189931870, -0.621916800737381, -0.634855896234512, -0.647626399993897, -0.660220354795456, -0.672629952430725, -0.684847354888916, -0.696865111589432, -0.708675742149353, -0.720271795988083, -0.731646239757538, -0.742791980504990, -0.753702163696289, -0.764370083808899, -0.774789214134216, -0.784953206777573, -0.794855803251267, -0.804490983486176, -0.813852936029434, -0.822935968637466, -0.831734657287598, -0.840243637561798, -0.848457962274551, -0.856372624635696, -0.863983064889908, -0.871284663677216, -0.878273338079453, -0.884944856166840, -0.891295522451401, -0.897321611642838, -0.903019875288010, -0.908386975526810, -0.913420051336289, -0.918116331100464, -0.922473371028900, -0.926488906145096, -0.930160850286484, -0.933487445116043, -0.936467051506043, -0.939098447561264, -0.941380411386490, -0.943312227725983, -0.944893091917038, -0.946122795343399, -0.947001099586487, -0.947528123855591, -0.947704195976257, -0.947529822587967, -0.947005897760391, -0.946133434772492, -0.944913655519486, -0.943348139524460, -0.941438615322113, -0.939187049865723, -0.936595708131790, -0.933666914701462, -0.930403500795364, -0.926808208227158, -0.922884255647659, -0.918634951114655, -0.914063900709152, -0.909174859523773, -0.903971850872040, -0.898458987474442, -0.892640799283981, -0.886521965265274, -0.880107164382935, -0.873401522636414, -0.866410225629807, -0.859138756990433, -0.851592689752579, -0.843777805566788, -0.835700154304504, -0.827365845441818, -0.818781226873398, -0.809952765703201, -0.800887227058411, -0.791591316461563, -0.782072156667709, -0.772336721420288, -0.762392431497574, -0.752246677875519, -0.741906970739365, -0.731381058692932, -0.720676779747009, -0.709801971912384, -0.698764801025391, -0.687573432922363, -0.676236003637314, -0.664761036634445, -0.653156906366348, -0.641432225704193, -0.629595577716827, -0.617655664682388, -0.605621308088303, -0.593501329421997, -0.581304579973221, -0.569040089845657, -0.556716859340668, -0.544343829154968, -0.531930118799210, -0.519484877586365, -0.507017165422440, -0.494536176323891, -0.482050999999046, -0.469570800662041, -0.457104712724686, -0.444661900401115, -0.432251468300819, -0.419882476329803, -0.407564043998718, -0.395305201411247, -0.383114919066429, -0.371002167463303, -0.358975812792778, -0.347044706344605, -0.335217639803886, -0.323503270745277, -0.311910271644592, -0.300447136163712, -0.289122357964516, -0.277944296598434, -0.266921192407608, -0.256061196327210, -0.245372392237186, -0.234862685203552, -0.224539883434773, -0.214411675930023, -0.204485602676868, -0.194769077003002, -0.185269385576248, -0.175993651151657, -0.166948817670345, 0.162515141069889, 0.171441935002804, 0.180603086948395, 0.189991682767868, 0.199600681662560, 0.209422908723354, 0.219450980424881, 0.229677438735962, 0.240094661712646, 0.250694893300533, 0.261470302939415, 0.272412866353989, 0.283514469861984, 0.294766917824745, 0.306161940097809, 0.317691072821617, 0.329345822334290, 0.341117620468140, 0.352997809648514, 0.364977627992630, 0.377048298716545, 0.389200925827026, 0.401426613330841, 0.413716375827789, 0.426061227917671, 0.438452064990997, 0.450879827141762, 0.463335424661636, 0.475809708237648, 0.488293528556824, 0.500777766108513, 0.513253271579742, 0.525710850954056, 0.538141489028931, 0.550536006689072, 0.562885254621506, 0.575180262327194, 0.587411969900131, 0.599571466445923, 0.611649751663208, 0.623637974262238, 0.635527342557907, 0.647309124469757, 0.658974558115006, 0.670515209436417, 0.681922435760498, 0.693187892436981, 0.704303175210953, 0.715260177850723, 0.726050734519959, 0.736666798591614, 0.747100591659546, 0.757344275712967, 0.767390221357346, 0.777231007814407, 0.786859214305878, 0.796267628669739, 0.805449217557907, 0.814397066831589, 0.823104381561279, 0.831564724445343, 0.839771449565888, 0.847718477249146, 0.855399668216705, 0.862809181213379, 0.869941234588623, 0.876790374517441, 0.883351236581802, 0.889618694782257, 0.895587772130966, 0.901253879070282, 0.906612336635590, 0.911658883094788, 0.916389405727387, 0.920800060033798, 0.924887120723724, 0.928647130727768, 0.932076871395111, 0.935173332691193, 0.937933713197708, 0.940355449914932, 0.942436248064041, 0.944174021482468, 0.945566862821579, 0.946613162755966, 0.947311490774155, 0.947660773992539, 0.947659999132156, 0.947308510541916, 0.946605861186981, 0.945551872253418, 0.944146543741226, 0.942390143871307, 0.940283149480820, 0.937826365232468, 0.935020714998245, 0.931867420673370, 0.928367942571640, 0.924523949623108, 0.920337408781052, 0.915810465812683, 0.910945445299149, 0.905744999647141, 0.900211930274963, 0.894349336624146, 0.888160526752472, 0.881648987531662, 0.874818384647369, 0.867672741413117, 0.860216170549393, 0.852453023195267, 0.844387948513031, 0.836025685071945, 0.827371180057526, 0.818429678678513, 0.809206455945969, 0.799707204103470, 0.789937555789948, 0.779903501272202, 0.769611150026321, 0.759066820144653, 0.748276948928833, 0.737248122692108, 0.725987166166306, 0.714501023292542, 0.702796787023544, 0.690881669521332, 0.678763151168823, 0.666448682546616, 0.653945922851563, 0.641262739896774, 0.628406912088394, 0.615386545658112, 0.602209776639938, 0.588884830474854, 0.575420051813126, 0.561823874711990, 0.548104882240295, 0.534271597862244, 0.520332753658295, 0.506297111511231, 0.492173522710800, 0.477970823645592, 0.463697969913483, 0.449363946914673, 0.434977799654007, 0.420548558235168, 0.406085357069969, 0.391597270965576, 0.377093449234962, 0.362583041191101, 0.348075196146965, 0.333579018712044, 0.319103717803955, 0.304658368229866, 0.290252059698105, 0.275893911719322, 0.261592954397202, 0.247358158230782, 0.233198538422585, 0.219122976064682, 0.205140322446823, 0.191259376704693, 0.177488848567009, 0.163837380707264, 0.150313563644886, 0.136925838887692, 0.123682636767626, 0.110592208802700, 0.0976627506315708, 0.0849023498594761, 0.0723189488053322, 0.0599204041063786, 0.0477144252508879, 0.0357086006551981, 0.0239103743806481, 0.0123270601034164, 0.000965822138823569, -0.0101663284003735, -0.0210625324398279, -0.0317160924896598, -0.0421204753220081, -0.0522693172097206, -0.0621564257889986, -0.0717757903039455, -0.0811215676367283, -0.0901881195604801, -0.0989699847996235, -0.107461906969547, -0.115658804774284, -0.123555812984705, -0.131148263812065, -0.138431720435619, -0.145401902496815, -0.152054786682129, -0.158386550843716, -0.164393588900566, -0.170072510838509, -0.175420179963112, -0.180433616042137, -0.185110136866570, -0.189447261393070, -0.193442724645138, -0.197094500064850, -0.200400814414024, -0.203360110521317, -0.205971054732800, -0.208232596516609, -0.210143856704235, -0.211704224348068, -0.212913364171982, -0.213771104812622, -0.214277572929859, -0.214433111250401, -0.214238278567791, -0.213693931698799, -0.212801091372967, -0.211561053991318, -0.209975369274616, -0.208045780658722, -0.205774277448654, -0.203163094818592, -0.200214684009552, -0.196931734681129, -0.193317152559757, -0.189374074339867, -0.185105860233307, -0.180516086518765, -0.175608552992344, -0.170387282967567, -0.164856478571892, -0.159020572900772, -0.152884237468243, -0.146452292799950, -0.139729790389538, -0.132721975445747, -0.125434268265963, -0.117872312664986, -0.110041908919811, -0.101949058473110, -0.0935999229550362, -0.0850008502602577, -0.0761583633720875, -0.0670791231095791, -0.0577699784189463, -0.0482379253953695, -0.0384901128709316, -0.0285338228568435, -0.0183764975517988, -0.00802570418454707, 0.00251085654599592, 0.0132253575138748, 0.0241098515689373, 0.0351562760770321, 0.0463564582169056, 0.0577021203935146, 0.0691848881542683, 0.0807962939143181, 0.0925277881324291, 0.104370728135109, 0.116316400468349, 0.128356024622917, 0.140480749309063, 0.152681693434715, 0.164949871599674, 0.177276305854321, 0.189651951193810, 0.202067725360394, 0.214514546096325, 0.226983264088631, 0.239464774727821, 0.251949906349182, 0.264429524540901, 0.276894509792328, 0.289335682988167, 0.301743954420090, 0.314110189676285, 0.326425403356552, 0.338680490851402, 0.350866466760635, 0.362974420189858, 0.374995455145836, 0.386920705437660, 0.398741424083710, 0.410448923707008, 0.422034591436386, 0.433489829301834, 0.444806247949600, 0.455975487828255, 0.466989263892174, 0.477839440107346, 0.488518014550209, 0.499017000198364, 0.509328603744507, 0.519445210695267, 0.529359251260757, 0.539063245058060, 0.548550039529800, 0.557812482118607, 0.566843599081039, 0.575636535882950, 0.584184706211090, 0.592481672763825, 0.600521028041840, 0.608296722173691, 0.615802735090256, 0.623033314943314, 0.629982918500900, 0.636646062135696, 0.643017619848251, 0.649092555046082, 0.654866069555283, 0.660333573818207, 0.665490686893463, 0.670333147048950, 0.674857079982758, 0.679058760404587, 0.682934522628784, 0.686481118202210, 0.689695507287979, 0.692574739456177, 0.695116281509399, 0.697317659854889, 0.699176669120789, 0.700691401958466, 0.701860159635544, 0.702681392431259, 0.703153908252716, 0.703276753425598, 0.703049093484879, 0.702470362186432, 0.701540380716324, 0.700259000062943, 0.698626399040222, 0.696643054485321, 0.694309562444687, 0.691626876592636, 0.688596099615097, 0.685218572616577, 0.681496024131775, 0.677430093288422, 0.673023015260696, 0.668276935815811, 0.663194537162781, 0.657778501510620, 0.652031838893890, 0.645957708358765, 0.639559596776962, 0.632841110229492, 0.625806182622910, 0.618458837270737, 0.610803365707398, 0.602844268083572, 0.594586312770844, 0.586034327745438, 0.577193468809128, 0.568069010972977, 0.558666557073593, 0.548991620540619, 0.539050191640854, 0.528848290443420, 0.518392115831375, 0.507688105106354, 0.496742829680443, 0.485562995076180, 0.474155500531197, 0.462527394294739, 0.450685873627663, 0.438638269901276, 0.426392048597336, 0.413954839110374, 0.401334419846535, 0.388538584113121, 0.375575348734856, 0.362452849745750, 0.349179238080978, 0.335762828588486, 0.322212055325508, 0.308535411953926, 0.294741466641426, 0.280838862061501, 0.266836404800415, 0.252742812037468, 0.238567002117634, 0.224317871034145, 0.210004419088364, 0.195635624229908, 0.181220553815365, 0.166768297553062, 0.152287937700748, 0.137788631021976, 0.123279497027397, 0.108769703656435, 0.0942683778703213, 0.0797846652567387, 0.0653276946395636, 0.0509065818041563, 0.0365304108709097, 0.0222082370892167, 0.00794908031821251, -0.00623808091040701, -0.0203443197533488, -0.0343607626855373, -0.0482785981148481, -0.0620890799909830, -0.0757835283875465, -0.0893533602356911, -0.102790065109730, -0.116085212677717, -0.129230484366417, -0.142217665910721, -0.155038632452488, -0.167685389518738, -0.180150046944618, -0.192424841225147, -0.204502135515213, -0.216374464333057, -0.228034429252148, -0.239474825561047, -0.250688605010510, -0.261668831110001, -0.272408768534660, -0.282901793718338, -0.293141514062881, -0.303121671080589, -0.312836155295372, -0.322279140353203, -0.331444844603539, -0.340327754616737, -0.348922580480576, -0.357224151492119, -0.365227505564690, -0.372927948832512, -0.380320921540260, -0.387402102351189, -0.394167378544807, -0.400612875819206, -0.406734883785248, -0.412529960274696, -0.417994856834412, -0.423126533627510, -0.427922219038010, -0.432379379868507, -0.436495631933212, -0.440268874168396, -0.443697273731232, -0.446779176592827, -0.449513167142868, -0.451898112893105, -0.453933030366898, -0.455617278814316, -0.456950351595879, -0.457932099699974, -0.458562463521957, -0.458841755986214, -0.458770468831062, -0.458349347114563, -0.457579329609871, -0.456461638212204, -0.454997703433037, -0.453189253807068, -0.451038137078285, -0.448546543717384, -0.445716828107834, -0.442551597952843, -0.439053684473038, -0.435226142406464, -0.431072235107422, -0.426595509052277, -0.421799629926682, -0.416688591241837, -0.411266505718231, -0.405537724494934, -0.399506866931915, -0.393178641796112, -0.386558070778847, -0.379650324583054, -0.372460737824440, -0.364994898438454, -0.357258543372154, -0.349257603287697, -0.340998157858849, -0.332486525177956, -0.323729187250137, -0.314732700586319, -0.305503889918327, -0.296049684286118, -0.286377161741257, -0.276493594050407, -0.266406357288361, -0.256122946739197, -0.245651036500931, -0.234998419880867, -0.224172994494438, -0.213182777166367, -0.202035903930664, -0.190740622580051, -0.179305262863636, -0.167738266289234, -0.156048171222210, -0.144243568181992, -0.132333137094975, -0.120325658470392, -0.108229942619801, -0.0960548780858517, -0.0838093943893910, -0.0715024843811989, -0.0591431688517332, -0.0467405151575804, -0.0343036130070686, -0.0218415735289454, -0.00936353253200650});
-    return w;
+    return { Colin::WavetableData::crayon.begin(), Colin::WavetableData::crayon.end() };
 }
 
 static std::vector<float> gritty() {
-    std::vector<float> w({-0.187106296420097, -0.136435627937317, -0.106760907918215, -0.0900229737162590, -0.0701222792267799, -0.0294586047530174, 0.0393173992633820, 0.101060617715120, 0.142093516886234, 0.192703284323215, 0.250810980796814, 0.278204530477524, 0.255928389728069, 0.224539868533611, 0.229118481278420, 0.254403427243233, 0.244327835738659, 0.183860130608082, 0.101664755493402, 0.00836350210011005, -0.113023202866316, -0.256702639162540, -0.387273207306862, -0.479181915521622, -0.526521682739258, -0.531906813383102, -0.505020707845688, -0.471790045499802, -0.452539399266243, -0.436507523059845, -0.402527570724487, -0.354609787464142, -0.311507686972618, -0.300131201744080, -0.307837769389153, -0.280098274350166, -0.188672892749310, -0.0583316832780838, 0.0649390928447247, 0.139097817242146, 0.154984340071678, 0.126230526715517, 0.0708103366196156, 0.00174969434738159, -0.0737070739269257, -0.138662934303284, -0.162173792719841, -0.126627352088690, -0.0570078045129776, -0.00659065693616867, 0.00534857064485550, 0.0238838419318199, 0.101514570415020, 0.231693238019943, 0.365434169769287, 0.493891283869743, 0.524677842855454, 0.300998769700527, 0.111236482858658, 0.408810839056969, 0.808531910181046, 0.857055753469467, 0.807936131954193, 0.691898703575134, 0.365796193480492, 0.0165764018893242, -0.186240054666996, -0.230850420892239, -0.138217121362686, 0.0640142410993576, 0.237519577145576, 0.274302423000336, 0.273283973336220, 0.303723052144051, 0.358869940042496, 0.413650780916214, 0.375431954860687, 0.219476580619812, 0.0400024503469467, -0.0517331734299660, -0.0190412104129791, 0.0453831627964973, 0.0620261952280998, 0.0502459555864334, 0.0400415733456612, 0.0419505387544632, 0.0539136454463005, 0.0549791008234024, 0.0574631579220295, 0.115791283547878, 0.223572149872780, 0.324355661869049, 0.374147042632103, 0.345467209815979, 0.266958676278591, 0.190974712371826, 0.134879350662231, 0.0934474803507328, 0.0651788711547852, 0.0532483607530594, 0.0552127957344055, 0.0673745423555374, 0.0893680155277252, 0.122567266225815, 0.151815742254257, 0.154437795281410, 0.153703331947327, 0.175266161561012, 0.202777676284313, 0.218452796339989, 0.201608188450336, 0.142512694001198, 0.0536207854747772, -0.0512437894940376, -0.160351395606995, -0.269486144185066, -0.373454272747040, -0.458272516727448, -0.506464898586273, -0.521863490343094, -0.535010546445847, -0.541700273752213, -0.520648658275604, -0.486402556300163, -0.456108257174492, -0.433680847287178, -0.417981311678886, -0.406921505928040, -0.403004720807076, -0.409661889076233, -0.430883690714836, -0.453043743968010, -0.468378677964211, -0.506074398756027, -0.568470865488052, -0.619838833808899, -0.661472618579865, -0.703903317451477, -0.737788617610931, -0.765114188194275, -0.788603514432907, -0.799373269081116, -0.805925548076630, -0.819745153188705, -0.840592265129089, -0.867240399122238, -0.903342932462692, -0.948357701301575, -0.976457536220551, -0.984544545412064, -0.987796843051910, -0.994883537292481, -0.999796241521835, -0.994548916816711, -0.989215493202210, -0.986911386251450, -0.981329917907715, -0.961542248725891, -0.928089439868927, -0.912882328033447, -0.910695672035217, -0.885441541671753, -0.842605590820313, -0.797831267118454, -0.752373158931732, -0.703416764736176, -0.659182518720627, -0.620553612709045, -0.586434602737427, -0.563377916812897, -0.550635486841202, -0.550572961568832, -0.555803596973419, -0.557727336883545, -0.560141563415527, -0.565552473068237, -0.574732601642609, -0.584880173206329, -0.595820367336273, -0.609891414642334, -0.622228145599365, -0.635464817285538, -0.655744343996048, -0.666197448968887, -0.657498955726624, -0.648294359445572, -0.642972439527512, -0.624921947717667, -0.589458763599396, -0.538237243890762, -0.478778526186943, -0.412594214081764, -0.339962318539619, -0.271638795733452, -0.207953624427319, -0.147526703774929, -0.0901754684746265, -0.0395218692719936, -0.00896026566624641, 0.000862702727317810, 0.00101332366466522, -0.00692246109247208, -0.0287081040441990, -0.0657318197190762, -0.113411191850901, -0.169873997569084, -0.231877937912941, -0.298528745770454, -0.366414159536362, -0.428059145808220, -0.481347113847733, -0.532534450292587, -0.584356129169464, -0.619124889373779, -0.622584283351898, -0.606433272361755, -0.581553012132645, -0.546690225601196, -0.504097312688828, -0.459651619195938, -0.416384309530258, -0.373967692255974, -0.330509126186371, -0.291758969426155, -0.262258917093277, -0.239429891109467, -0.223359942436218, -0.214966401457787, -0.213355779647827, -0.218807563185692, -0.233628928661346, -0.255208194255829, -0.279916733503342, -0.306873664259911, -0.335921570658684, -0.365428537130356, -0.395908102393150, -0.428267896175385, -0.460582941770554, -0.491362765431404, -0.521611094474793, -0.549380242824554, -0.568458974361420, -0.578472495079041, -0.582128286361694, -0.580038696527481, -0.576422214508057, -0.569283366203308, -0.560104072093964, -0.549086213111877, -0.526604533195496, -0.497145652770996, -0.464957922697067, -0.424383148550987, -0.380979984998703, -0.337825953960419, -0.292367666959763, -0.244512096047401, -0.195184662938118, -0.146871626377106, -0.102618366479874, -0.0837576836347580, -0.0749874860048294, -0.0212816298007965, 0.0405687540769577, 0.0617287755012512, 0.0627920851111412, 0.0521485358476639, 0.0347638651728630, 0.00847027450799942, -0.0209758579730988, -0.0486086830496788, -0.0752336978912354, -0.0963947847485542, -0.105465739965439, -0.101980060338974, -0.100391313433647, -0.0907074958086014, -0.0617198646068573, -0.0213382467627525, 0.0297801718115807, 0.0900533571839333, 0.156278289854527, 0.228771932423115, 0.303877592086792, 0.375215202569962, 0.440263465046883, 0.505626782774925, 0.566278338432312, 0.611031711101532, 0.647192150354385, 0.677751421928406, 0.698102891445160, 0.710685640573502, 0.711441278457642, 0.704502642154694, 0.691828668117523, 0.677798390388489, 0.666805505752564, 0.654235690832138, 0.642881095409393, 0.632921040058136, 0.617695361375809, 0.602825105190277, 0.597284346818924, 0.599650621414185, 0.606959313154221, 0.613957971334457, 0.622028380632401, 0.636633455753326, 0.657771915197372, 0.684562236070633, 0.704157173633575, 0.711835622787476, 0.715454727411270, 0.712176620960236, 0.712835133075714, 0.720614463090897, 0.731202781200409, 0.747502446174622, 0.760449707508087, 0.762514561414719, 0.758259683847427, 0.748292744159699, 0.733342945575714, 0.717409908771515, 0.706287592649460, 0.691041231155396, 0.668520838022232, 0.658442556858063, 0.659321427345276, 0.660728335380554, 0.663699805736542, 0.667983561754227, 0.673241853713989, 0.679332941770554, 0.683469712734222, 0.680949360132217, 0.674091577529907, 0.674709826707840, 0.668325334787369, 0.637259304523468, 0.602025061845779, 0.576016873121262, 0.557062536478043, 0.544590234756470, 0.533454447984695, 0.523240804672241, 0.518948078155518, 0.520888745784760, 0.523949593305588, 0.532095581293106, 0.554106324911118, 0.575121700763702, 0.570818930864334, 0.560422271490097, 0.562568187713623, 0.564872562885284, 0.560905218124390, 0.551605075597763, 0.540343850851059, 0.524934798479080, 0.508985579013825, 0.495965108275414, 0.477810502052307, 0.456135302782059, 0.435115426778793, 0.413614392280579, 0.391239389777184, 0.372169226408005, 0.358695998787880, 0.349546656012535, 0.344071045517921, 0.342700526118279, 0.346104681491852, 0.352951273322105, 0.360490441322327, 0.364870339632034, 0.371101036667824, 0.381371125578880, 0.377369791269302, 0.359358713030815, 0.348999410867691, 0.343424931168556, 0.335739091038704, 0.323348388075829, 0.306395441293716, 0.288012221455574, 0.268852338194847, 0.246334783732891, 0.225622862577438, 0.221948534250259, 0.214899450540543, 0.179482579231262, 0.149007320404053, 0.141029208898544, 0.143266692757607, 0.151249468326569, 0.156733244657516, 0.163137316703796, 0.171590641140938, 0.178516522049904, 0.180027425289154, 0.177731439471245, 0.184470281004906, 0.186956316232681, 0.156265303492546, 0.118246465921402, 0.0992034822702408, 0.0870826244354248, 0.0790585875511169, 0.0755996704101563, 0.0754681676626205, 0.0807799845933914, 0.0896217375993729, 0.0961373001337051, 0.108172714710236, 0.140665039420128, 0.165536537766457, 0.163032010197639, 0.166328623890877, 0.183284133672714, 0.203214481472969, 0.222620561718941, 0.238749697804451, 0.250153020024300, 0.255547910928726, 0.258387655019760, 0.257029637694359, 0.223324775695801, 0.155698642134666, 0.167320474982262, 0.250507831573486, 0.274891540408134, 0.252258919179440, 0.233764156699181, 0.225172832608223, 0.217253729701042, 0.217590838670731, 0.194522038102150, 0.152979031205177, 0.124074071645737, 0.113911613821983, 0.139201045036316, 0.137553647160530, 0.101936832070351, 0.0807883739471436, 0.0701660066843033, 0.0560174286365509, 0.0363150537014008, 0.0196663886308670, 0.00274574756622314, -0.00600492209196091, -0.00882078707218170, -0.0272114053368568, -0.0442978069186211, -0.0527653843164444, -0.0849803015589714, -0.137292068451643, -0.178907275199890, -0.212210051715374, -0.233630880713463, -0.245961666107178, -0.256389901041985, -0.261244446039200, -0.264315545558929, -0.271402180194855, -0.283344358205795, -0.283392146229744, -0.265573471784592, -0.268513262271881, -0.302021816372871, -0.324724420905113, -0.330482274293900, -0.332649797201157, -0.331126034259796, -0.329551666975021, -0.339772328734398, -0.361660078167915, -0.375324577093124, -0.382982671260834, -0.396427109837532, -0.410189718008041, -0.421679615974426, -0.431413397192955, -0.440055668354034, -0.446770176291466, -0.451466768980026, -0.454158022999764, -0.455124080181122, -0.454772919416428, -0.451451912522316, -0.446257606148720, -0.439825594425201, -0.431248381733894, -0.422892019152641, -0.414864495396614, -0.404125824570656, -0.391386717557907, -0.380787983536720, -0.370298027992249, -0.361875176429749, -0.355059117078781, -0.344773769378662, -0.332849904894829, -0.323335677385330, -0.315410301089287, -0.307260081171989, -0.298507422208786, -0.288953378796577, -0.278846234083176, -0.266184329986572, -0.251288503408432, -0.234621435403824, -0.216071344912052, -0.195923753082752, -0.172483049333096, -0.146132186055183, -0.118006989359856, -0.0962751246988773, -0.0790749788284302, -0.0538429766893387, -0.0245185121893883, 0.000383943319320679, 0.0171903148293495, 0.0363830067217350, 0.0586765669286251, 0.0776023864746094, 0.0930664539337158, 0.108180843293667, 0.123305939137936, 0.132769733667374, 0.137432284653187, 0.139137148857117, 0.141007177531719, 0.154410868883133, 0.168730728328228, 0.173212200403214, 0.181373141705990, 0.191936500370502, 0.203350797295570, 0.216500006616116, 0.226956374943256, 0.231575608253479, 0.231278166174889, 0.234968103468418, 0.239479117095470, 0.237954422831535, 0.247277379035950, 0.265163332223892, 0.276314765214920, 0.285129457712173, 0.290271610021591, 0.293048322200775, 0.295444577932358, 0.298214390873909, 0.302826926112175, 0.304994121193886, 0.307664737105370, 0.305592983961105, 0.297545656561852, 0.304219350218773, 0.320299655199051, 0.325792431831360, 0.325689226388931, 0.322269082069397, 0.318875879049301, 0.317020490765572, 0.313477173447609, 0.309317097067833, 0.306331247091293, 0.310339555144310, 0.319906324148178, 0.329470887780190, 0.339105963706970, 0.348977148532867, 0.359415456652641, 0.370632916688919, 0.382316216826439, 0.395381927490234, 0.409718126058579, 0.423723831772804, 0.435181424021721, 0.447406917810440, 0.458860740065575, 0.469047173857689, 0.477531552314758, 0.482181042432785, 0.484621375799179, 0.483570605516434, 0.477955192327499, 0.469084918498993, 0.457279801368713, 0.442211285233498, 0.423954322934151, 0.403323084115982, 0.382908329367638, 0.360940292477608, 0.337024852633476, 0.315673619508743, 0.296718180179596, 0.280830085277557, 0.268921539187431, 0.260744124650955, 0.257380530238152, 0.257992655038834, 0.263334870338440, 0.272424057126045, 0.285412445664406, 0.301214203238487, 0.319338411092758, 0.338934689760208, 0.358969628810883, 0.378888472914696, 0.397967755794525, 0.416383951902390, 0.430787116289139, 0.441028833389282, 0.450330764055252, 0.455082342028618, 0.452800661325455, 0.447298526763916, 0.439925178885460, 0.428939566016197, 0.414054676890373, 0.395961105823517, 0.375859797000885, 0.354124143719673, 0.330858737230301, 0.307210475206375, 0.283213496208191, 0.260123074054718, 0.237768746912479, 0.217931076884270, 0.205103278160095, 0.196555756032467, 0.190953053534031, 0.195400081574917, 0.200604744255543, 0.197318047285080, 0.202448688447475, 0.221015892922878, 0.238082803785801, 0.254698827862740, 0.272956237196922, 0.290941774845123, 0.305751323699951, 0.318612694740295, 0.329089105129242, 0.332765087485313, 0.338078439235687, 0.342422783374786, 0.327993601560593, 0.297389835119247, 0.270063579082489, 0.247036904096603, 0.221927702426910, 0.192431017756462, 0.163029342889786, 0.134319782257080, 0.105808079242706, 0.0786016136407852, 0.0535239726305008, 0.0406557768583298, 0.0366258472204208, 0.0194044709205627, -0.00427632033824921, -0.0131563991308212, -0.00863480567932129, 0.00329773128032684, 0.0193441212177277, 0.0381760895252228, 0.0574333220720291, 0.0773928165435791, 0.0963224917650223, 0.113735660910606, 0.140639096498489, 0.160810530185699, 0.151264056563377, 0.134685821831226, 0.126624949276447, 0.120959267020226, 0.112964607775211, 0.101472765207291, 0.0917406156659126, 0.0846248492598534, 0.0767478197813034, 0.0612250119447708, 0.0407858788967133, 0.0289107859134674, 0.0175493955612183, -0.0181583911180496, -0.0662734359502792, -0.102510184049606, -0.131418198347092, -0.156486123800278, -0.178275749087334, -0.199220851063728, -0.217216700315475, -0.231004498898983, -0.245447002351284, -0.255527541041374, -0.246144548058510, -0.235366001725197, -0.253951504826546, -0.275449767708778, -0.273127898573875, -0.261183410882950, -0.245935544371605, -0.232410535216331, -0.229362636804581, -0.232466325163841, -0.235563963651657, -0.241591759026051, -0.252631545066834, -0.269617870450020, -0.292242661118507, -0.320767596364021, -0.355563566088676, -0.395553454756737, -0.439818173646927, -0.487323895096779, -0.538004696369171, -0.589664369821549, -0.640225470066071, -0.688310384750366, -0.733158528804779, -0.775131702423096, -0.809516578912735, -0.838081479072571, -0.861686795949936, -0.876727670431137, -0.887042552232742, -0.895881146192551, -0.898284852504730, -0.894643723964691, -0.890465259552002, -0.885738909244537, -0.881821453571320, -0.878536671400070, -0.875327408313751, -0.873206466436386, -0.872990608215332, -0.875306606292725, -0.879543513059616, -0.883168190717697, -0.885978221893311, -0.889529794454575, -0.892740011215210, -0.894763469696045, -0.895050317049027, -0.893253564834595, -0.891023993492127, -0.887897372245789, -0.883415520191193, -0.875998675823212, -0.869012236595154, -0.863654881715775, -0.854417204856873, -0.844773888587952, -0.840312600135803, -0.836282074451447, -0.828921675682068, -0.822297334671021, -0.816725164651871, -0.808260202407837, -0.799132645130158, -0.788640797138214, -0.772441416978836, -0.753957927227020, -0.732685118913651, -0.708128809928894, -0.683026582002640, -0.657767683267593, -0.630290210247040, -0.599078655242920, -0.562924385070801, -0.525663852691650, -0.492852896451950, -0.459434539079666, -0.420496001839638, -0.381977811455727, -0.358381271362305, -0.353802397847176, -0.351133614778519, -0.342848137021065, -0.333910375833511, -0.328236609697342, -0.328808724880219, -0.333708345890045, -0.338318347930908, -0.345487803220749, -0.358000054955483, -0.371270716190338, -0.379992187023163, -0.383322522044182, -0.387119472026825, -0.388610035181046, -0.388861998915672, -0.387327060103416, -0.379596158862114, -0.368704736232758, -0.355755209922791, -0.337873741984367, -0.318177565932274, -0.301611393690109, -0.288087442517281, -0.270831152796745, -0.244418717920780, -0.220066882669926, -0.201816342771053, -0.186960734426975, -0.177886530756950, -0.170061640441418, -0.162284895777702, -0.157678008079529, -0.157788142561913, -0.160906217992306, -0.165977850556374, -0.176889628171921, -0.185339011251926, -0.184338480234146, -0.183688536286354, -0.186894096434116, -0.189272269606590, -0.190311789512634, -0.188902691006660, -0.186090618371964, -0.186007291078568, -0.183925732970238, -0.175950810313225, -0.169804811477661, -0.169774204492569, -0.160686329007149, -0.137562140822411, -0.119869530200958, -0.107796922326088, -0.0942874699831009, -0.0802056491374970, -0.0643179863691330, -0.0477974116802216, -0.0333064347505569, -0.0157173424959183, 0.00683875381946564, 0.0260469764471054, 0.0391741842031479, 0.0582805871963501, 0.0884380787611008, 0.116753727197647, 0.139468908309937, 0.158518776297569, 0.174291491508484, 0.187886320054531, 0.197974137961864, 0.202880315482616, 0.202705100178719, 0.203687533736229, 0.192494899034500, 0.151120230555534, 0.138404294848442, 0.185817375779152, 0.224262401461601, 0.231082066893578, 0.234708741307259, 0.240265205502510, 0.249176442623138, 0.262709498405457, 0.278254568576813, 0.297085702419281, 0.321003451943398, 0.348525837063789, 0.385359913110733, 0.418428331613541, 0.431219413876534, 0.442181497812271, 0.460907652974129, 0.478417068719864, 0.491815328598022, 0.499877423048019, 0.503314256668091, 0.502192825078964, 0.497846603393555, 0.491897210478783, 0.484206333756447, 0.480358496308327, 0.472134128212929, 0.452015161514282, 0.436480298638344, 0.431397199630737, 0.436733543872833, 0.457415744662285, 0.481354996562004, 0.504091203212738, 0.530730068683624, 0.561085343360901, 0.591806590557098, 0.621879756450653, 0.649695456027985, 0.675143182277679, 0.698586553335190, 0.718912869691849, 0.735697418451309, 0.749293565750122, 0.760715544223785, 0.768694728612900, 0.776375651359558, 0.783012747764587, 0.784091264009476, 0.784996867179871, 0.788589298725128, 0.793096929788590, 0.797836303710938, 0.803392678499222, 0.809669792652130, 0.816737771034241, 0.824317693710327, 0.830320388078690, 0.837132632732391, 0.843656301498413, 0.848919391632080, 0.852407187223434, 0.854881703853607, 0.855879604816437, 0.856017351150513, 0.854749113321304, 0.851178914308548, 0.846781283617020, 0.841420054435730, 0.836948245763779, 0.831259787082672, 0.821950256824493, 0.814562261104584, 0.807490110397339, 0.798908650875092, 0.790815651416779, 0.782101809978485, 0.772765398025513, 0.763945400714874, 0.755460411310196, 0.748125284910202, 0.742438524961472, 0.737773269414902, 0.734915941953659, 0.733564257621765, 0.734374344348908, 0.736493885517120, 0.740063697099686, 0.744476258754730, 0.750214993953705, 0.756112694740295, 0.759523123502731, 0.763036638498306, 0.764868050813675, 0.761376351118088, 0.754019737243652, 0.743146240711212, 0.727942734956741, 0.707118242979050, 0.681369721889496, 0.650096952915192, 0.614381194114685, 0.574382930994034, 0.529019832611084, 0.479603737592697, 0.427138298749924, 0.371612370014191, 0.312355458736420, 0.250165186822414, 0.185111075639725, 0.117512598633766, 0.0474115386605263, -0.0245570093393326, -0.100190334022045, -0.178189247846603, -0.256580650806427, -0.335989072918892, -0.413753777742386, -0.488595843315125, -0.561388254165649, -0.629072815179825, -0.688450604677200, -0.739066123962402, -0.781413495540619, -0.812665015459061, -0.832534492015839, -0.841532915830612, -0.836286276578903, -0.814762890338898, -0.781800299882889, -0.752468138933182, -0.730622559785843, -0.701870709657669, -0.668836951255798, -0.641679346561432, -0.618193596601486, -0.599521815776825, -0.589657962322235, -0.588468670845032, -0.594295918941498, -0.606508821249008, -0.616932123899460, -0.622559070587158, -0.635777413845062, -0.655123263597488, -0.659394711256027, -0.645685315132141, -0.621153742074966, -0.585279107093811, -0.536662012338638, -0.476198360323906, -0.408378511667252, -0.337708517909050, -0.270554870367050, -0.203031487762928, -0.134959474205971, -0.0873394906520844, -0.0654837861657143, -0.0545442104339600, -0.0524056628346443, -0.0661518834531307, -0.0956213213503361, -0.135329693555832, -0.179427064955235, -0.231640271842480});
-    return w;
-}
-
-// noise
-
-static std::vector<float> gauss() {
-    int length = 1024;
-    std::vector<float> gauss = std::vector<float>(length);
-    for (auto i = 0; i<length; i++) {
-        float sample = ( (float)rand() / (float)RAND_MAX ) - 0.5; // white noise
-        gauss[i] = sample;
-    }
-    return gauss;
-}
-
-static std::vector<float> binary() {
-    int length = 1024;
-    //std::random_device rd;     // Only used once to initialise (seed) engine
-    //std::mt19937 rng(rd());    // Random-number engine used (Mersenne-Twister in this case)
-    std::vector<float> bin = std::vector<float>(length);
-    for (auto i = 0; i<length; i++) {
-        float ran = (((float)rand() / (float)RAND_MAX ) - 0.5);
-        float sample;
-        if(ran >= 0) sample = 0.5;
-        else sample = -0.5;
-        bin[i] = sample;
-    }
-    return bin;
-}
-
-static std::vector<float> hpNoise() {
-    int length = 1024;
-    float prevHPNoiseSample = 0;
-    std::vector<float> hp = std::vector<float>(length);
-    for (auto i = 0; i<length; i++) {
-        float ran = (((float)rand() / (float)RAND_MAX ) - 0.5);
-        float y = -0.5 * ran + 0.5 * prevHPNoiseSample;
-        prevHPNoiseSample = ran;
-        hp[i] = y;
-    }
-    return hp;
-}
-
-
-static std::vector<float> lpNoise() {
-    int length = 1024;
-    float prevLPNoiseSample = 0;
-    std::vector<float> lp = std::vector<float>(length);
-    for (auto i = 0; i<length; i++) {
-        float ran = (((float)rand() / (float)RAND_MAX ) - 0.5);
-        float y = -0.06 * ran - 0.9 * prevLPNoiseSample;
-        prevLPNoiseSample = y;
-        lp[i] = y;
-    }
-    return lp;
+    return { Colin::WavetableData::gritty.begin(), Colin::WavetableData::gritty.end() };
 }
 
 static std::vector<float> AirCon() {
-    std::vector<float> w({0.00334167480468750, 0.0193786621093750, 0.0167083740234375, -0.00968933105468750, 0.0449371337890625, 0.0574951171875000, 0.0106353759765625, 0.0421295166015625, 0.0382232666015625, 0.0696716308593750, 0.0363311767578125, 0.0924530029296875, 0.142105102539063, 0.0540924072265625, 0.113235473632813, 0.102416992187500, 0.103195190429688, 0.0893859863281250, 0.130340576171875, 0.0852661132812500, 0.106658935546875, 0.0653533935546875, 0.0621795654296875, 0.0847015380859375, 0.0298614501953125, 0.0795745849609375, 0.0890808105468750, 0.0630950927734375, 0.0358428955078125, 0.0954589843750000, 0.0761260986328125, 0.0906524658203125, 0.0595855712890625, 0.101959228515625, 0.0691223144531250, 0.0525512695312500, 0.0688934326171875, 0.0944976806640625, 0.0922851562500000, 0.145416259765625, 0.0295562744140625, 0.0934295654296875, 0.0169372558593750, 0.0735473632812500, 0.150756835937500, 0.121459960937500, 0.147537231445313, 0.147933959960938, 0.197845458984375, 0.134414672851563, 0.152816772460938, 0.149948120117188, 0.107788085937500, 0.149002075195313, 0.185577392578125, 0.177154541015625, 0.232727050781250, 0.261016845703125, 0.261077880859375, 0.236755371093750, 0.349502563476563, 0.307128906250000, 0.333038330078125, 0.330581665039063, 0.308471679687500, 0.363220214843750, 0.344512939453125, 0.359741210937500, 0.354553222656250, 0.350265502929688, 0.361038208007813, 0.396118164062500, 0.378524780273438, 0.400314331054688, 0.428878784179688, 0.411804199218750, 0.439926147460938, 0.396591186523438, 0.442459106445313, 0.428573608398438, 0.433685302734375, 0.423217773437500, 0.417190551757813, 0.425888061523438, 0.436965942382813, 0.438552856445313, 0.451232910156250, 0.418334960937500, 0.424652099609375, 0.427886962890625, 0.451934814453125, 0.470672607421875, 0.441101074218750, 0.473068237304688, 0.425537109375000, 0.467437744140625, 0.457107543945313, 0.441833496093750, 0.437927246093750, 0.454345703125000, 0.459075927734375, 0.396636962890625, 0.419036865234375, 0.440093994140625, 0.417205810546875, 0.404098510742188, 0.417663574218750, 0.372589111328125, 0.417297363281250, 0.368667602539063, 0.379837036132813, 0.379867553710938, 0.349029541015625, 0.355636596679688, 0.325439453125000, 0.355026245117188, 0.323852539062500, 0.294494628906250, 0.302658081054688, 0.329025268554688, 0.343704223632813, 0.292434692382813, 0.334091186523438, 0.345611572265625, 0.339569091796875, 0.322860717773438, 0.322494506835938, 0.289871215820313, 0.351119995117188, 0.301620483398438, 0.341613769531250, 0.326614379882813, 0.300170898437500, 0.326416015625000, 0.307739257812500, 0.300216674804688, 0.294845581054688, 0.307723999023438, 0.297164916992188, 0.317214965820313, 0.305664062500000, 0.304214477539063, 0.322265625000000, 0.273315429687500, 0.272750854492188, 0.326736450195313, 0.270111083984375, 0.300033569335938, 0.263763427734375, 0.260101318359375, 0.266113281250000, 0.242370605468750, 0.251174926757813, 0.280792236328125, 0.212539672851563, 0.254562377929688, 0.218460083007813, 0.191497802734375, 0.210510253906250, 0.206451416015625, 0.186981201171875, 0.182418823242188, 0.172241210937500, 0.180633544921875, 0.195770263671875, 0.133132934570313, 0.129943847656250, 0.131317138671875, 0.134246826171875, 0.148834228515625, 0.102523803710938, 0.117782592773438, 0.114776611328125, 0.103179931640625, 0.110260009765625, 0.0526123046875000, 0.0620727539062500, 0.0475616455078125, 0.0521545410156250, 0.0311889648437500, -0.0105438232421875, 0.0278015136718750, -0.0309906005859375, 0.0166778564453125, -0.0206298828125000, -0.0145568847656250, -0.0254058837890625, -0.0686035156250000, -0.0398864746093750, -0.0598754882812500, -0.0933380126953125, -0.0581054687500000, -0.0720825195312500, -0.109573364257813, -0.0597991943359375, -0.122802734375000, -0.103393554687500, -0.0947418212890625, -0.0852203369140625, -0.101791381835938, -0.106491088867188, -0.107971191406250, -0.0902252197265625, -0.0989532470703125, -0.0910797119140625, -0.0923919677734375, -0.129180908203125, -0.111053466796875, -0.0860443115234375, -0.0714416503906250, -0.0684509277343750, -0.0707702636718750, -0.0971221923828125, -0.0765686035156250, -0.0714263916015625, -0.0736694335937500, -0.0846710205078125, -0.0677032470703125, -0.0854644775390625, -0.0771636962890625, -0.0530395507812500, -0.0881805419921875, -0.144119262695313, -0.0850067138671875, -0.0801086425781250, -0.0426483154296875, -0.0672760009765625, -0.0886230468750000, -0.126464843750000, -0.129547119140625, -0.142486572265625, -0.171798706054688, -0.126678466796875, -0.136291503906250, -0.119369506835938, -0.143753051757813, -0.136901855468750, -0.136993408203125, -0.135620117187500, -0.244537353515625, -0.215301513671875, -0.230621337890625, -0.268768310546875, -0.277816772460938, -0.292236328125000, -0.307907104492188, -0.295578002929688, -0.319869995117188, -0.333450317382813, -0.327285766601563, -0.353378295898438, -0.352416992187500, -0.349349975585938, -0.361633300781250, -0.363647460937500, -0.404113769531250, -0.384429931640625, -0.387969970703125, -0.433303833007813, -0.417785644531250, -0.443603515625000, -0.425201416015625, -0.425811767578125, -0.450958251953125, -0.430526733398438, -0.425079345703125, -0.415374755859375, -0.459411621093750, -0.452178955078125, -0.423568725585938, -0.467849731445313, -0.451400756835938, -0.464065551757813, -0.477157592773438, -0.449279785156250, -0.466583251953125, -0.425064086914063, -0.451354980468750, -0.417083740234375, -0.446487426757813, -0.434539794921875, -0.424118041992188, -0.418411254882813, -0.389648437500000, -0.408782958984375, -0.421325683593750, -0.457321166992188, -0.410964965820313, -0.417037963867188, -0.415054321289063, -0.324295043945313, -0.398773193359375, -0.364440917968750, -0.387863159179688, -0.410202026367188, -0.386688232421875, -0.386062622070313, -0.372024536132813, -0.340316772460938, -0.342086791992188, -0.360641479492188, -0.342514038085938, -0.370285034179688, -0.343322753906250, -0.321975708007813, -0.312759399414063, -0.343963623046875, -0.321197509765625, -0.320281982421875, -0.335449218750000, -0.338546752929688, -0.350631713867188, -0.329406738281250, -0.334533691406250, -0.347106933593750, -0.294418334960938, -0.323760986328125, -0.322006225585938, -0.292587280273438, -0.337265014648438, -0.328384399414063, -0.315979003906250, -0.316116333007813, -0.299591064453125, -0.327651977539063, -0.309890747070313, -0.295761108398438, -0.288375854492188, -0.307601928710938, -0.300125122070313, -0.267517089843750, -0.290756225585938, -0.251251220703125, -0.280273437500000, -0.229934692382813, -0.269744873046875, -0.221603393554688, -0.291961669921875, -0.279067993164063, -0.204437255859375, -0.203063964843750, -0.244735717773438, -0.189270019531250, -0.238876342773438, -0.221618652343750, -0.182754516601563, -0.160354614257813, -0.208084106445313, -0.116683959960938, -0.154907226562500, -0.118988037109375, -0.143463134765625, -0.133682250976563, -0.106521606445313, -0.0829010009765625, -0.118392944335938, -0.0603942871093750, -0.0534057617187500, -0.0569915771484375, -0.0259552001953125, -0.0478820800781250, -0.0770568847656250, -0.0364990234375000, -0.0224761962890625, -0.00697326660156250, 0.0407104492187500, 0.0411224365234375, -0.0113067626953125, 0.0631561279296875, 0.0355834960937500, 0.0612640380859375, 0.0393829345703125, 0.0526885986328125, 0.0650024414062500, 0.0908355712890625, 0.0980834960937500, 0.120834350585938, 0.0988464355468750, 0.119995117187500, 0.103240966796875, 0.124862670898438, 0.128845214843750, 0.130371093750000, 0.137542724609375, 0.156997680664063, 0.163253784179688, 0.161987304687500, 0.122436523437500, 0.0901641845703125, 0.139434814453125, 0.124542236328125, 0.117050170898438, 0.108688354492188, 0.0865020751953125, 0.0876464843750000, 0.0973968505859375, 0.0623474121093750, 0.109848022460938, 0.0772705078125000, 0.0991210937500000, 0.0996246337890625, 0.100219726562500, 0.0812530517578125, 0.0749969482421875, 0.0985717773437500, 0.0884552001953125, 0.0944061279296875, 0.0766754150390625, 0.0365905761718750, 0.0629730224609375, 0.0675811767578125, 0.0897674560546875, 0.130752563476563, 0.141525268554688, 0.115005493164063, 0.184844970703125, 0.144851684570313, 0.140701293945313, 0.113159179687500, 0.126983642578125, 0.170883178710938, 0.117385864257813, 0.184158325195313, 0.216674804687500, 0.254440307617188, 0.208663940429688, 0.242996215820313, 0.308044433593750, 0.307449340820313, 0.281555175781250, 0.314056396484375, 0.364761352539063, 0.326217651367188, 0.355865478515625, 0.388259887695313, 0.385559082031250, 0.365783691406250, 0.370254516601563, 0.372680664062500, 0.369827270507813, 0.438629150390625, 0.397064208984375, 0.427413940429688, 0.445648193359375, 0.393722534179688, 0.429275512695313, 0.445556640625000, 0.466323852539063, 0.405685424804688, 0.416061401367188, 0.449554443359375, 0.430938720703125, 0.474914550781250, 0.416870117187500, 0.452514648437500, 0.438629150390625, 0.418563842773438, 0.391296386718750, 0.454010009765625, 0.445480346679688, 0.453018188476563, 0.431518554687500, 0.436370849609375, 0.398117065429688, 0.435501098632813, 0.409973144531250, 0.424392700195313, 0.403839111328125, 0.433227539062500, 0.367889404296875, 0.427093505859375, 0.384674072265625, 0.390975952148438, 0.383209228515625, 0.384109497070313, 0.375350952148438, 0.310089111328125, 0.366317749023438, 0.329528808593750, 0.373489379882813, 0.290847778320313, 0.334609985351563, 0.351837158203125, 0.311538696289063, 0.301254272460938, 0.324508666992188, 0.302490234375000, 0.310668945312500, 0.308319091796875, 0.340423583984375, 0.313980102539063, 0.315048217773438, 0.294281005859375, 0.298034667968750, 0.322998046875000, 0.314331054687500, 0.290969848632813, 0.295104980468750, 0.261276245117188, 0.299819946289063, 0.303985595703125, 0.280868530273438, 0.344680786132813, 0.290481567382813, 0.306518554687500, 0.327941894531250, 0.322540283203125, 0.259338378906250, 0.335647583007813, 0.251266479492188, 0.286788940429688, 0.270675659179688, 0.306762695312500, 0.254440307617188, 0.265914916992188, 0.264038085937500, 0.260726928710938, 0.227722167968750, 0.254470825195313, 0.273513793945313, 0.210845947265625, 0.277923583984375, 0.245315551757813, 0.248489379882813, 0.198730468750000, 0.201065063476563, 0.222656250000000, 0.181381225585938, 0.191986083984375, 0.191085815429688, 0.174987792968750, 0.193527221679688, 0.156372070312500, 0.115112304687500, 0.179031372070313, 0.0982666015625000, 0.123168945312500, 0.109390258789063, 0.104858398437500, 0.105422973632813, 0.0702972412109375, 0.0911865234375000, 0.0609283447265625, 0.0563812255859375, 0.0606689453125000, 0.0437469482421875, 0.0405273437500000, 0.00135803222656250, 0.0204467773437500, -0.00862121582031250, -0.0138092041015625, -0.0506439208984375, -0.0217285156250000, -0.0429687500000000, -0.00550842285156250, -0.0426483154296875, -0.0226745605468750, -0.0697784423828125, -0.0652008056640625, -0.0650329589843750, -0.0412445068359375, -0.0753936767578125, -0.128616333007813, -0.0787811279296875, -0.0465393066406250, -0.101333618164063, -0.140823364257813, -0.0865173339843750, -0.143692016601563, -0.131637573242188, -0.0778198242187500, -0.110366821289063, -0.0767974853515625, -0.0729522705078125, -0.0791320800781250, -0.0577697753906250, -0.0735626220703125, -0.0669860839843750, -0.0557403564453125, -0.0852203369140625, -0.0568389892578125, -0.0697784423828125, -0.0611877441406250, -0.0798034667968750, -0.0501556396484375, -0.0667572021484375, -0.0775146484375000, -0.0572509765625000, -0.0872497558593750, -0.143096923828125, -0.117492675781250, -0.0660858154296875, -0.0935363769531250, -0.0543212890625000, -0.0686950683593750, -0.110107421875000, -0.121246337890625, -0.135787963867188, -0.137390136718750, -0.149551391601563, -0.126510620117188, -0.134506225585938, -0.135467529296875, -0.103118896484375, -0.153717041015625, -0.127029418945313, -0.185806274414063, -0.210571289062500, -0.202117919921875, -0.281082153320313, -0.287490844726563, -0.268692016601563, -0.323913574218750, -0.333175659179688, -0.313964843750000, -0.309555053710938, -0.382675170898438, -0.397933959960938, -0.328933715820313, -0.397857666015625, -0.365707397460938, -0.366851806640625, -0.371109008789063, -0.431945800781250, -0.409515380859375, -0.450271606445313, -0.448654174804688, -0.448059082031250, -0.440734863281250, -0.452468872070313, -0.471588134765625, -0.425811767578125, -0.457397460937500, -0.454330444335938, -0.421524047851563, -0.440841674804688, -0.447235107421875, -0.423263549804688, -0.419311523437500, -0.439468383789063, -0.444885253906250, -0.448272705078125, -0.438232421875000, -0.415069580078125, -0.432174682617188, -0.441268920898438, -0.434829711914063, -0.443496704101563, -0.411026000976563, -0.415878295898438, -0.428161621093750, -0.412033081054688, -0.413177490234375, -0.412551879882813, -0.384658813476563, -0.381561279296875, -0.396194458007813, -0.385314941406250, -0.386657714843750, -0.342483520507813, -0.366424560546875, -0.365692138671875, -0.342514038085938, -0.329025268554688, -0.383117675781250, -0.354980468750000, -0.326721191406250, -0.345199584960938, -0.364547729492188, -0.296096801757813, -0.316390991210938, -0.341400146484375, -0.309158325195313, -0.303604125976563, -0.308914184570313, -0.305221557617188, -0.321533203125000, -0.321624755859375, -0.330871582031250, -0.296493530273438, -0.294555664062500, -0.307495117187500, -0.316757202148438, -0.293594360351563, -0.275512695312500, -0.329315185546875, -0.300384521484375, -0.317703247070313, -0.315475463867188, -0.297424316406250, -0.333999633789063, -0.296890258789063, -0.299377441406250, -0.277496337890625, -0.328353881835938, -0.336029052734375, -0.289825439453125, -0.285034179687500, -0.293319702148438, -0.330917358398438, -0.254959106445313, -0.293121337890625, -0.228408813476563, -0.263214111328125, -0.240234375000000, -0.248428344726563, -0.199127197265625, -0.219009399414063, -0.227050781250000, -0.216629028320313, -0.196197509765625, -0.209274291992188, -0.154647827148438, -0.177215576171875, -0.144424438476563, -0.149566650390625, -0.143569946289063, -0.153640747070313, -0.150115966796875, -0.106903076171875, -0.119384765625000, -0.120498657226563, -0.144622802734375, -0.0970458984375000, -0.0743408203125000, -0.0446777343750000, -0.0717468261718750, -0.0422668457031250, -0.0277557373046875, -0.0430755615234375, -0.0375213623046875, -0.0281982421875000, 0.00212097167968750, 0.0401153564453125, 0.00190734863281250, 0.0349426269531250, 0.0111236572265625, 0.0429077148437500, 0.0314178466796875, 0.0782623291015625, 0.0467529296875000, 0.0676422119140625, 0.0805969238281250, 0.0740814208984375, 0.0651550292968750, 0.0892639160156250, 0.0748443603515625, 0.0953674316406250, 0.0860137939453125, 0.103530883789063, 0.108581542968750, 0.0777740478515625, 0.128265380859375, 0.135055541992188, 0.0662994384765625, 0.0766754150390625, 0.104644775390625, 0.0666809082031250, 0.0866394042968750, 0.0901641845703125, 0.0520477294921875, 0.0716247558593750, 0.0411376953125000, 0.0474090576171875, 0.0400390625000000, 0.0709228515625000, 0.0410156250000000, 0.0824737548828125, 0.0915985107421875, 0.0247344970703125, 0.0813140869140625, 0.0527038574218750, 0.112884521484375, 0.0630645751953125, 0.0667572021484375, 0.0380554199218750, 0.0782775878906250, 0.0788269042968750, 0.0662078857421875, 0.100723266601563, 0.159591674804688, 0.157150268554688, 0.141067504882813, 0.145736694335938, 0.140243530273438, 0.106216430664063, 0.132659912109375, 0.150588989257813, 0.146530151367188, 0.185424804687500, 0.205062866210938, 0.267990112304688, 0.227325439453125, 0.266876220703125, 0.265274047851563, 0.335968017578125, 0.280593872070313, 0.327056884765625, 0.339553833007813, 0.346511840820313, 0.305221557617188, 0.364471435546875, 0.410079956054688, 0.341812133789063, 0.371490478515625, 0.418365478515625, 0.432144165039063, 0.394058227539063, 0.437927246093750, 0.415328979492188, 0.441497802734375, 0.447235107421875, 0.425033569335938, 0.430572509765625, 0.458435058593750, 0.453231811523438, 0.440567016601563, 0.479522705078125, 0.468246459960938, 0.448837280273438, 0.485641479492188, 0.504684448242188, 0.421813964843750, 0.484909057617188, 0.463317871093750, 0.496780395507813, 0.427932739257813, 0.442901611328125, 0.425003051757813, 0.430236816406250, 0.448135375976563, 0.455749511718750, 0.432174682617188, 0.409957885742188, 0.417022705078125, 0.405334472656250, 0.394805908203125, 0.413436889648438, 0.424530029296875, 0.373458862304688, 0.387298583984375, 0.392669677734375, 0.388977050781250, 0.387298583984375, 0.381057739257813, 0.346862792968750, 0.350860595703125, 0.318176269531250, 0.356140136718750, 0.327926635742188, 0.331390380859375, 0.349700927734375, 0.304656982421875, 0.328430175781250, 0.334854125976563, 0.346069335937500, 0.301071166992188, 0.323928833007813, 0.328201293945313, 0.342453002929688, 0.311370849609375, 0.333496093750000, 0.297821044921875, 0.296813964843750, 0.280868530273438, 0.316986083984375, 0.300750732421875, 0.288940429687500, 0.326843261718750, 0.309173583984375, 0.305618286132813, 0.293960571289063, 0.335800170898438, 0.277282714843750, 0.313171386718750, 0.279785156250000, 0.304412841796875, 0.309326171875000, 0.282867431640625, 0.298812866210938, 0.312469482421875, 0.267578125000000, 0.309860229492188, 0.295867919921875, 0.268646240234375, 0.279968261718750, 0.272552490234375, 0.273818969726563, 0.293151855468750, 0.185989379882813, 0.186172485351563, 0.223312377929688, 0.150024414062500, 0.243087768554688, 0.179672241210938, 0.185073852539063, 0.188110351562500, 0.181137084960938, 0.168197631835938, 0.121154785156250, 0.149749755859375, 0.126434326171875, 0.154006958007813, 0.115447998046875, 0.108428955078125, 0.140792846679688, 0.109329223632813, 0.0904083251953125, 0.0785827636718750, 0.0681457519531250, 0.0241699218750000, 0.0153808593750000, 0.0590515136718750, 0.0148010253906250, 0.0505523681640625, -0.0411224365234375, 0.0242309570312500, 0.00332641601562500, 0.00106811523437500, -0.00556945800781250, 0.00402832031250000, -0.0292205810546875, -0.0416259765625000, -0.0495452880859375, -0.0814971923828125, -0.0557098388671875, -0.0695495605468750, -0.0418853759765625, -0.0885162353515625, -0.0747222900390625, -0.117843627929688, -0.0756835937500000, -0.107467651367188, -0.0990447998046875, -0.119064331054688, -0.107330322265625, -0.150985717773438, -0.0858154296875000, -0.102478027343750, -0.0929718017578125, -0.121673583984375, -0.100982666015625, -0.0968322753906250, -0.0612640380859375, -0.0869445800781250, -0.0905456542968750, -0.0217742919921875, -0.0854187011718750, -0.127670288085938, -0.0541381835937500, -0.142227172851563, -0.103332519531250, -0.0942230224609375, -0.0697631835937500, -0.0682678222656250, -0.0924987792968750, -0.116165161132813, -0.112518310546875, -0.0886993408203125, -0.0606231689453125, -0.0614624023437500, -0.0671081542968750, -0.0593719482421875, -0.150604248046875, -0.104598999023438, -0.190963745117188, -0.128234863281250, -0.153182983398438, -0.151763916015625, -0.159072875976563, -0.139160156250000, -0.127395629882813, -0.145248413085938, -0.172622680664063, -0.201217651367188, -0.206909179687500, -0.247116088867188, -0.254333496093750, -0.293960571289063, -0.274963378906250, -0.241790771484375, -0.327041625976563, -0.310379028320313, -0.350845336914063, -0.354278564453125, -0.352630615234375, -0.408218383789063, -0.374328613281250, -0.347869873046875, -0.368408203125000, -0.405670166015625, -0.404357910156250, -0.401824951171875, -0.422042846679688, -0.422409057617188, -0.440521240234375, -0.410385131835938, -0.436859130859375, -0.413711547851563, -0.448364257812500, -0.450988769531250, -0.435455322265625, -0.451492309570313, -0.448150634765625, -0.487579345703125, -0.432052612304688, -0.458648681640625, -0.459152221679688, -0.454193115234375, -0.476364135742188, -0.418563842773438, -0.451629638671875, -0.457443237304688, -0.436828613281250, -0.436187744140625, -0.413909912109375, -0.452407836914063, -0.449554443359375, -0.427276611328125, -0.408248901367188, -0.447677612304688, -0.458007812500000, -0.423965454101563, -0.350021362304688});
-    return w;
+    return { Colin::WavetableData::airCon.begin(), Colin::WavetableData::airCon.end() };
 }
 
 static std::vector<float> AirCan() {
-    std::vector<float> w({-0.0862731933593750, 0.0957794189453125, 0.0684051513671875, 0.0175018310546875, -0.284545898437500, 0.0272521972656250, 0.118942260742188, -0.0127868652343750, 0.0475616455078125, -0.0710449218750000, -0.202713012695313, -0.0535736083984375, 0.0938415527343750, 0.172195434570313, -0.124862670898438, 0.0192260742187500, -0.307006835937500, 0.159423828125000, 0.0611724853515625, 0.0177612304687500, 0.00959777832031250, -0.145309448242188, -0.105422973632813, 0.0932617187500000, 0.0346221923828125, 0.254592895507813, -0.162353515625000, -0.169097900390625, -0.124786376953125, 0.166046142578125, -0.000122070312500000, 0.220870971679688, -0.129913330078125, -0.100189208984375, 0.00466918945312500, -0.0257263183593750, 0.00332641601562500, -0.0330200195312500, -0.000900268554687500, 0.186477661132813, 0.0331878662109375, 0.101440429687500, -0.0146636962890625, -0.260482788085938, -0.140502929687500, 0.122222900390625, 0.201141357421875, 0.104721069335938, 0.307586669921875, -0.511383056640625, 0.0208892822265625, -0.0820312500000000, 0.188827514648438, 0.203506469726563, -0.0345458984375000, 0.0133209228515625, 0.0972137451171875, -0.185348510742188, -0.0520935058593750, 0.0422210693359375, -0.147460937500000, 0.0613250732421875, 0.109252929687500, 0.241180419921875, -0.287124633789063, -0.193176269531250, -0.167343139648438, 0.128051757812500, 0.202178955078125, 0.347015380859375, -0.123275756835938, -0.475967407226563, -0.135101318359375, 0.285980224609375, -0.0202941894531250, 0.182235717773438, -0.177200317382813, 0.0941772460937500, -0.0350952148437500, -0.150222778320313, 0.0718536376953125, -0.0408172607421875, 0.0113677978515625, 0.138427734375000, 0.198852539062500, 0.134826660156250, -0.145095825195313, -0.306030273437500, 0.0678863525390625, 0.233413696289063, 0.154953002929688, -0.172119140625000, 0.0174560546875000, -0.176834106445313, 0.00424194335937500, 0.152145385742188, 0.0255126953125000, -0.125183105468750, -0.0372161865234375, 0.0875701904296875, 0.0769805908203125, -0.0270996093750000, -0.146209716796875, 0.0638427734375000, -0.0925750732421875, 0.251525878906250, 0.137512207031250, -0.0869140625000000, -0.236068725585938, -0.147125244140625, 0.276657104492188, 0.165298461914063, -0.0951080322265625, 0.0852813720703125, -0.182250976562500, 0.106521606445313, -0.00415039062500000, 0.249313354492188, -0.294876098632813, -0.0305175781250000, 0.0109558105468750, 0.171112060546875, 0.230346679687500, -0.240951538085938, -0.273910522460938, 0.112823486328125, -0.0298919677734375, 0.186431884765625, -0.0480499267578125, 0.0430908203125000, -0.199478149414063, 0.0679779052734375, 0.0451354980468750, -0.134689331054688, 0.0408172607421875, -0.140930175781250, 0.223785400390625, 0.112518310546875, -0.154388427734375, 0.0949707031250000, -0.288986206054688, 0.0337982177734375, 0.104705810546875, 0.315048217773438, -0.0645294189453125, -0.0247344970703125, -0.294158935546875, -0.0570831298828125, 0.224227905273438, 0.0279998779296875, -0.0521087646484375, 0.200286865234375, -0.406127929687500, 0.357772827148438, -0.261123657226563, 0.0133819580078125, -0.0906372070312500, 0.156784057617188, 0.0721893310546875, 0.365905761718750, -0.448760986328125, -0.216934204101563, -0.0244445800781250, 0.0341491699218750, 0.308135986328125, 0.179992675781250, -0.288970947265625, 0.0890350341796875, -0.224349975585938, -0.0771789550781250, 0.142959594726563, -0.142639160156250, 0.181442260742188, 0.318084716796875, -0.139038085937500, -0.127944946289063, -0.229492187500000, -0.105545043945313, 0.243270874023438, 0.212936401367188, 0.146606445312500, -0.177322387695313, -0.149276733398438, -0.121093750000000, 0.165664672851563, -0.0727539062500000, 0.0900115966796875, 0.0452575683593750, 0.0158691406250000, 0.169967651367188, -0.0369567871093750, -0.221008300781250, 0.0749053955078125, -0.0360260009765625, 0.274520874023438, 0.0205535888671875, -0.0254821777343750, -0.194503784179688, -0.0115814208984375, 0.0838928222656250, 0.0464324951171875, 0.0854339599609375, -0.104843139648438, -0.0345458984375000, 0.0169830322265625, 0.0186614990234375, 0.0198669433593750, -0.115982055664063, -0.0991821289062500, 0.113540649414063, 0.0216217041015625, 0.129516601562500, -0.311965942382813, 0.0997467041015625, -0.138977050781250, 0.185821533203125, -0.0216369628906250, 0.143859863281250, -0.0632781982421875, 0.0203704833984375, -0.114303588867188, 0.101623535156250, -0.119384765625000, 0.0625457763671875, 0.0414276123046875, 0.163574218750000, -0.126174926757813, -0.0112915039062500, -0.190582275390625, 0.0177612304687500, -0.0857238769531250, 0.161468505859375, 0.129165649414063, -0.171264648437500, 0.0548095703125000, -0.0955963134765625, -0.0155792236328125, -0.118743896484375, -0.00700378417968750, 0.0784759521484375, 0.0592193603515625, 0.0585174560546875, -0.154281616210938, 0.114349365234375, -0.129409790039063, -0.112716674804688, 0.287048339843750, -0.136825561523438, 0.0434570312500000, 0.0353851318359375, 0.00532531738281250, -0.0299224853515625, 0.0500335693359375, -0.0759887695312500, -0.127624511718750, 0.156066894531250, 0.0185241699218750, 0.132278442382813, 0.00730895996093750, -0.189697265625000, -0.148864746093750, 0.109039306640625, 0.132812500000000, -0.0537109375000000, 0.0976715087890625, 0.0129699707031250, -0.127868652343750, -0.0792083740234375, 0.00895690917968750, 0.0701141357421875, -0.0779876708984375, 0.221527099609375, -0.241058349609375, 0.114776611328125, -0.0666656494140625, -0.0776367187500000, 0.193634033203125, 0.00405883789062500, -0.0433502197265625, 0.144577026367188, -0.226715087890625, -0.0207519531250000, -0.0751647949218750, 0.0968017578125000, -0.0172576904296875, 0.0918731689453125, -0.101058959960938, 0.210922241210938, -0.139602661132813, -0.169158935546875, -0.0282897949218750, 0.155044555664063, 0.0808868408203125, 0.255065917968750, -0.287200927734375, 0.0190734863281250, -0.228836059570313, 0.0246582031250000, 0.126358032226563, 0.215087890625000, -0.171463012695313, 0.182556152343750, -0.264953613281250, 0.221481323242188, -0.343978881835938, 0.135696411132813, 0.0952758789062500, 0.114654541015625, -0.194183349609375, 0.0549011230468750, -0.173217773437500, 0.134811401367188, -0.0158386230468750, 0.240524291992188, -0.152023315429688, 0.0343322753906250, -0.0878753662109375, 0.225799560546875, -0.191665649414063, 0.0179443359375000, 0.00738525390625000, 0.0686798095703125, -0.0487213134765625, 0.0526580810546875, -0.177627563476563, 0.251052856445313, -0.0565338134765625, 0.176361083984375, -0.106521606445313, -0.107742309570313, -0.181564331054688, 0.180511474609375, 0.146438598632813, 0.00895690917968750, -0.0911254882812500, -0.187484741210938, 0.180709838867188, -0.0224304199218750, 0.0400543212890625, -0.0270690917968750, -0.130569458007813, -0.00895690917968750, 0.0989227294921875, 0.0607147216796875, -0.0556793212890625, -0.0791931152343750, -0.332443237304688, 0.276000976562500, 0.267852783203125, -0.152969360351563, 0.147583007812500, -0.309249877929688, 0.00328063964843750, 0.0883941650390625, 0.134735107421875, 0.00271606445312500, -0.0795745849609375, -0.146591186523438, 0.224655151367188, 0.00836181640625000, -0.194747924804688, -0.0166168212890625, -0.00315856933593750, -0.138900756835938, 0.290176391601563, -0.0706634521484375, -0.00718688964843750, -0.188720703125000, -0.171722412109375, 0.250762939453125, -0.0166320800781250, -0.259643554687500, 0.193435668945313, 0.0425872802734375, -0.0434112548828125, 0.0891876220703125, -0.131729125976563, -0.0824432373046875, -0.154098510742188, 0.180603027343750, 0.346649169921875, -0.187927246093750, -0.0279235839843750, -0.287582397460938, 0.141372680664063, 0.00689697265625000, 0.101043701171875, 0.137481689453125, -0.143539428710938, -0.0284729003906250, -0.179855346679688, 0.0843048095703125, 0.0781250000000000, -0.131072998046875, 0.107635498046875, 0.0137329101562500, 0.0927276611328125, -0.200622558593750, 0.108352661132813, -0.168670654296875, -0.166137695312500, 0.284240722656250, 0.130310058593750, 0.228210449218750, -0.433959960937500, -0.232955932617188, 0.228958129882813, 0.209426879882813, 0.114532470703125, -0.0638732910156250, -0.113067626953125, 0.0151977539062500, -0.0798797607421875, 0.378860473632813, -0.174880981445313, 0.0182647705078125, -0.173309326171875, 0.268508911132813, 0.142333984375000, -0.246932983398438, -0.248748779296875, -0.0635986328125000, 0.158630371093750, 0.251220703125000, -0.250503540039063, 0.133682250976563, -0.276977539062500, 0.0129699707031250, 0.214111328125000, 0.0644836425781250, -0.117538452148438, -0.120544433593750, 0.0220184326171875, 0.231689453125000, 0.0948028564453125, -0.193542480468750, -0.0823059082031250, 0.0536499023437500, 0.0533905029296875, 0.236968994140625, -0.0231475830078125, -0.0741577148437500, -0.0959777832031250, -0.00395202636718750, 0.0462493896484375, 0.305755615234375, -0.241622924804688, -0.0514678955078125, 0.220413208007813, -0.101074218750000, -0.136093139648438, -0.00390625000000000, -0.162292480468750, 0.307922363281250, -0.139648437500000, 0.337860107421875, -0.247177124023438, -0.200653076171875, -0.126693725585938, 0.158447265625000, 0.0401153564453125, 0.167465209960938, -0.100402832031250, 0.0428466796875000, -0.196029663085938, -0.0207519531250000, -0.0466003417968750, 0.180618286132813, -0.0652008056640625, 0.0941772460937500, 0.0534667968750000, 0.143478393554688, -0.253128051757813, -0.0246429443359375, 0.0926055908203125, 0.0245971679687500, 0.0709228515625000, 0.0951538085937500, -0.0440826416015625, -0.126083374023438, -0.111755371093750, 0.169815063476563, 0.0182495117187500, -0.156463623046875, 0.0478973388671875, 0.0764312744140625, 0.0429840087890625, -0.0399780273437500, 0.0635375976562500, -0.296478271484375, 0.00761413574218750, 0.0617523193359375, 0.282592773437500, -0.0817413330078125, 0.00531005859375000, -0.281387329101563, 0.0734100341796875, -0.120147705078125, 0.151901245117188, 0.0841369628906250, 0.0190429687500000, -0.135101318359375, 0.0701141357421875, -0.0525360107421875, 0.115432739257813, -0.216949462890625, 0.0163421630859375, 0.113265991210938, -0.0786590576171875, -0.0764312744140625, 0.143386840820313, -0.0801849365234375, -0.0243377685546875, -0.159362792968750, -0.0504150390625000, -0.0783691406250000, 0.262557983398438, -0.0718688964843750, 0.0816802978515625, -0.104019165039063, -0.163482666015625, 0.115554809570313, -0.00651550292968750, -0.137069702148438, 0.189239501953125, -0.139602661132813, 0.118774414062500, -0.121856689453125, -0.0171661376953125, -0.106964111328125, 0.230255126953125, -0.214859008789063, 0.234817504882813, -0.0447540283203125, 0.000823974609375000, -0.111160278320313, 0.167541503906250, -0.164703369140625, 0.222152709960938, -0.295135498046875, 0.167617797851563, 0.0690917968750000, -0.139877319335938, -0.225616455078125, 0.164962768554688, -0.121856689453125, 0.161453247070313, -0.0367431640625000, 0.113769531250000, -0.237701416015625, -0.0628204345703125, -0.0838470458984375, 0.264938354492188, 0.0224609375000000, -0.180664062500000, -0.0184478759765625, -0.175704956054688, 0.185760498046875, -0.0234069824218750, 0.0316314697265625, 0.0970611572265625, -0.305313110351563, 0.278671264648438, 0.0218658447265625, 0.208465576171875, -0.227447509765625, -0.174163818359375, 0.184600830078125, -0.0221862792968750, 0.0172119140625000, 0.0605010986328125, -0.0765380859375000, -0.0828399658203125, -0.114883422851563, 0.153137207031250, 0.00659179687500000, 0.162109375000000, -0.204650878906250, 0.0495910644531250, -0.0489807128906250, -0.224960327148438, 0.330551147460938, -0.0593109130859375, 0.146057128906250, -0.220474243164063, 0.142410278320313, -0.155685424804688, 0.0589447021484375, -0.168212890625000, 0.198471069335938, -0.0162811279296875, 0.114761352539063, -0.207885742187500, 0.225692749023438, -0.361999511718750, 0.295837402343750, -0.147567749023438, 0.283325195312500, -0.107345581054688, 0.00752258300781250, -0.0340728759765625, 0.00379943847656250, -0.0942993164062500, -0.0440216064453125, 0.158432006835938, 0.282135009765625, -0.281951904296875, 0.0678558349609375, -0.173339843750000, 0.147964477539063, -0.202713012695313, 0.234252929687500, -0.112548828125000, 0.0742645263671875, -0.133773803710938, 0.0490112304687500, 0.00350952148437500, -0.0446929931640625, -0.229888916015625, 0.328094482421875, -0.0305023193359375, 0.0427856445312500, -0.0649414062500000, -0.0224761962890625, -0.151916503906250, 0.126953125000000, 0.144470214843750, 0.104049682617188, -0.175094604492188, -0.0107421875000000, -0.0108337402343750, 0.211181640625000, -0.193588256835938, 0.0614776611328125, -0.0238342285156250, 0.0365295410156250, 0.139755249023438, 0.0992889404296875, -0.214248657226563, -0.135223388671875, -0.0288238525390625, 0.0792694091796875, 0.156143188476563, -0.0232238769531250, 0.0854339599609375, -0.302719116210938, -0.109252929687500, 0.151702880859375, 0.161651611328125, 0.0757904052734375, -0.134384155273438, -0.0970153808593750, 0.152877807617188, -0.150802612304688, 0.289871215820313, -0.0753784179687500, -0.0285949707031250, -0.0314941406250000, 0.144058227539063, 0.242446899414063, -0.125106811523438, -0.106002807617188, 0.0266723632812500, 0.150375366210938, 0.104736328125000, -0.111816406250000, -0.0118408203125000, -0.0769348144531250, 0.119796752929688, 0.114562988281250, -0.115524291992188, 0.117095947265625, -0.429550170898438, 0.160018920898438, 0.271530151367188, 0.0354766845703125, -0.00904846191406250, -0.201354980468750, -0.0452728271484375, 0.0535583496093750, 0.219070434570313, -0.0417938232421875, 0.0711975097656250, 0.0355072021484375, 0.00727844238281250, -0.0908203125000000, -0.0875549316406250, 0.0887756347656250, 0.0312500000000000, 0.160095214843750, 0.148239135742188, 0.00582885742187500, -0.350997924804688, -0.0223236083984375, 0.109786987304688, 0.194259643554688, 0.0195007324218750, -0.0260467529296875, -0.0679779052734375, -0.111694335937500, -0.100967407226563, 0.00680541992187500, 0.0734863281250000, 0.141601562500000, -0.0514221191406250, 0.110427856445313, 0.0170593261718750, -0.115142822265625, -0.120483398437500, 0.0798950195312500, 0.146606445312500, 0.250274658203125, -0.224609375000000, -0.00279235839843750, -0.161346435546875, 0.0781402587890625, 0.201202392578125, -0.177886962890625, 0.0324707031250000, -0.199935913085938, 0.114440917968750, 0.163940429687500, -0.168716430664063, -0.0786285400390625, -0.183059692382813, 0.181915283203125, -0.00419616699218750, 0.0306854248046875, 0.184020996093750, -0.405136108398438, 0.119262695312500, -0.0792236328125000, 0.201690673828125, -0.0410003662109375, -0.237869262695313, 0.115325927734375, -0.0691680908203125, 0.121276855468750, 0.141510009765625, -0.312347412109375, 0.145446777343750, -0.0448150634765625, 0.249145507812500, 0.0931549072265625, -0.219146728515625, -0.141876220703125, 0.0817871093750000, 0.173339843750000, 0.116088867187500, -0.201263427734375, -0.322799682617188, 0.230682373046875, 0.0767974853515625, 0.0135650634765625, 0.157257080078125, -0.291824340820313, -0.231460571289063, 0.138290405273438, 0.219833374023438, -0.0734252929687500, -0.0967102050781250, -0.236526489257813, 0.0939331054687500, 0.313964843750000, -0.232040405273438, -0.0473175048828125, -0.192947387695313, 0.149749755859375, 0.133758544921875, 0.0708618164062500, -0.0306396484375000, -0.343276977539063, 0.0321197509765625, 0.159072875976563, 0.179580688476563, -0.146255493164063, -0.0606079101562500, -0.0175628662109375, -0.0344543457031250, 0.233703613281250, -0.140686035156250, -0.237121582031250, -0.0576934814453125, 0.0740509033203125, 0.351333618164063, 0.157745361328125, -0.351242065429688, -0.189331054687500, 0.00131225585937500, 0.172653198242188, 0.160354614257813, 0.156921386718750, -0.274673461914063, 0.0397186279296875, 0.132247924804688, -0.108184814453125, 0.0389251708984375, -0.155303955078125, 0.116851806640625, -0.0362396240234375, 0.258132934570313, -0.0644226074218750, -0.258056640625000, -0.238113403320313, 0.151138305664063, 0.0923309326171875, 0.275253295898438, -0.0402679443359375, -0.268859863281250, -0.240249633789063, 0.265472412109375, 0.161514282226563, -0.0814819335937500, -0.197540283203125, 0.112869262695313, 0.0493469238281250, 0.0626525878906250, -0.0666198730468750, -0.0789794921875000, -0.311553955078125, 0.107513427734375, 0.297180175781250, 0.0319366455078125, -0.0188140869140625, -0.290710449218750, 0.0274963378906250, 0.0355377197265625, 0.0733642578125000, 0.0587310791015625, -0.273605346679688, 0.116973876953125, 0.207717895507813, 0.0566711425781250, -0.158309936523438, -0.312072753906250, 0.0940551757812500, -0.111419677734375, 0.466323852539063, 0.110565185546875, -0.0308990478515625, -0.347793579101563, 0.0283355712890625, 0.0498657226562500, -0.135147094726563, 0.114349365234375, 0.129165649414063, -0.0541687011718750, 0.0867156982421875, -0.164077758789063, 0.0721435546875000, -0.284530639648438, 0.0837554931640625, 0.0497283935546875, 0.263427734375000, -0.0723419189453125, -0.00878906250000000, -0.167098999023438, -0.0886688232421875, 0.0360870361328125, 0.180130004882813, -0.0833587646484375, 0.139633178710938, -0.192901611328125, 0.0729370117187500, -0.0308990478515625, -0.0704650878906250, -0.0682678222656250, 0.0452423095703125, 0.173065185546875, -0.117141723632813, 0.166900634765625, -0.153320312500000, -0.0633392333984375, 0.102767944335938, -0.0684814453125000, -0.0108795166015625, 0.124099731445313, -0.267623901367188, 0.349609375000000, -0.282791137695313, 0.133773803710938, -0.317337036132813, 0.168609619140625, -0.0498046875000000, 0.0867309570312500, 0.128677368164063, -0.0108795166015625, -0.102737426757813, -0.0306091308593750, -0.0197296142578125, 0.426361083984375, -0.327926635742188, 0.182022094726563, 0.00891113281250000, 0.174942016601563, -0.183029174804688, -0.151275634765625, 0.147232055664063, -0.0215301513671875, 0.141937255859375, 0.00480651855468750, 0.0753631591796875, -0.181549072265625, -0.100799560546875, 0.0522155761718750, 0.0765075683593750, -0.0125732421875000, -0.00422668457031250, 0.0659942626953125, 0.0369567871093750, -0.178192138671875, -0.0554809570312500, 0.135299682617188, 0.0621032714843750, -0.179351806640625, 0.190429687500000, -0.0704193115234375, 0.0758666992187500, -0.153076171875000, 0.0302276611328125, -0.0181121826171875, 0.0525512695312500, -0.0911254882812500, 0.362228393554688, -0.142547607421875, -0.0415954589843750, 0.00613403320312500, -0.0379028320312500, -0.209732055664063, 0.235122680664063, -0.0680847167968750, 0.309463500976563, -0.268890380859375, -0.0796966552734375, -0.0741119384765625, 0.0561065673828125, -0.156097412109375, 0.176971435546875, -0.0127563476562500, 0.0483703613281250, 0.0584411621093750, -0.210388183593750, -0.0131072998046875, 0.0395507812500000, -0.127395629882813, 0.344024658203125, 0.102752685546875, 0.0249633789062500, -0.306732177734375, -0.0469970703125000, 0.134765625000000, 0.238739013671875, -0.0682220458984375, -0.0708312988281250, 0.0780029296875000, 0.0222167968750000, 0.150711059570313, -0.0795440673828125, -0.237014770507813, -0.0834808349609375, 0.0183868408203125, 0.323471069335938, 0.169616699218750, -0.0678863525390625, -0.328063964843750, -0.276031494140625, 0.222900390625000, 0.0411987304687500, 0.231765747070313, -0.101440429687500, -0.138275146484375, -0.000534057617187500, 0.0499267578125000, -0.114547729492188, -0.0970611572265625, -0.0551910400390625, 0.116180419921875, 0.372161865234375, 0.0381927490234375, -0.286788940429688, -0.109191894531250, -0.327133178710938, 0.224151611328125, 0.425506591796875, -0.0828857421875000, 0.0470886230468750, -0.0943603515625000, -0.119247436523438, 0.126068115234375, -0.000625610351562500, -0.0723571777343750, 0.0304107666015625, 0.339309692382813, -0.167114257812500, 0.0637207031250000, -0.189636230468750, 0.0189666748046875, -0.0485076904296875, 0.00184631347656250, 0.0505676269531250, 0.285919189453125, -0.305450439453125, 0.0444335937500000, -0.212234497070313, -0.00736999511718750, -0.154693603515625, 0.296096801757813, -0.0822601318359375, 0.304946899414063, -0.0713195800781250, -0.189926147460938, 0.0125579833984375, -0.136795043945313, 0.0120697021484375, 0.233505249023438, 0.0248413085937500, 0.157928466796875, -0.182220458984375, 0.0788574218750000, -0.203979492187500, -0.164672851562500, 0.250106811523438, 0.0813598632812500, 0.280609130859375});
-    return w;
+    return { Colin::WavetableData::airCan.begin(), Colin::WavetableData::airCan.end() };
 }
 
 
@@ -0,0 +1,91 @@
+/*
+  ==============================================================================
+
+    DistortionCheck.cpp
+    Author:  Colin Raab
+
+    Runs random signals through every Distortion_Type's block kernel
+    (Distortion::processBuffer) and through Distortion::processSample one
+    sample at a time, with random drive, coefficient, mix and output gain,
+    and compares the two. Prints the largest difference and the time each
+    took per type, and exits with 1 if a sample is off by more than the
+    type's Distortion::getTolerance(). exponential and fuzz read tables, so
+    their bound is the curves' interpolation error.
+
+      DistortionCheck [--blocks=2000] [--block=512] [--seed=1]
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <cstdio>
+#include <vector>
+#include "../Distortion.h"
+#include "ToolArguments.h"
+
+namespace
+{
+
+const char* distortionName(Colin::Distortion_Type type) {
+    const char* names[] = { "none", "arbitrary", "exponential", "softClip", "fuzz", "bitcrush" };
+    return names[static_cast<int>(type) - 1];
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const Colin::ToolArguments args("DistortionCheck", argc, argv);
+    if(args.showHelp("DistortionCheck [--blocks=2000] [--block=512] [--seed=1]")) return 0;
+    const int blocks = args.optionOr("--blocks", "2000").getIntValue();
+    const int blockSize = args.optionOr("--block", "512").getIntValue();
+    juce::Random random(args.optionOr("--seed", "1").getLargeIntValue());
+    if(blocks <= 0 || blockSize <= 0) return args.fail("--blocks and --block must be positive");
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    std::vector<float> expected(static_cast<size_t>(2 * blockSize));
+    bool passed = true;
+    for(int type = static_cast<int>(Colin::Distortion_Type::none); type < static_cast<int>(Colin::Distortion_Type::end); type++) {
+        float maxError = 0.f;
+        double kernelSeconds = 0.0, sampleSeconds = 0.0;
+        for(int b=0; b<blocks; b++) {
+            /// The ranges the parameters reach from the processor, and a signal that goes past full scale
+            Colin::Distortion dist;
+            dist.setType(type);
+            dist.setInputGain(random.nextFloat() * 30.f - 6.f);
+            dist.setOutputGain(random.nextFloat() * -6.f);
+            dist.setCoeff(random.nextFloat());
+            /// Now and then a mix too faint for fuzz's curve to reach clipping, which takes the exp path instead
+            dist.setMix(random.nextInt(16) == 0 ? random.nextFloat() * 1.0e-4f : random.nextFloat());
+            for(int channel = 0; channel < 2; channel++) {
+                auto* samples = buffer.getWritePointer(channel);
+                for(int i=0; i<blockSize; i++) samples[i] = random.nextInt(64) == 0 ? 0.f : (random.nextFloat() * 2.f - 1.f) * 1.5f;
+            }
+
+            auto t0 = juce::Time::getHighResolutionTicks();
+            for(int channel = 0; channel < 2; channel++) {
+                const auto* samples = buffer.getReadPointer(channel);
+                for(int i=0; i<blockSize; i++) expected[static_cast<size_t>(channel * blockSize + i)] = dist.processSample(samples[i]);
+            }
+            auto t1 = juce::Time::getHighResolutionTicks();
+            dist.processBuffer(buffer);
+            auto t2 = juce::Time::getHighResolutionTicks();
+            sampleSeconds += juce::Time::highResolutionTicksToSeconds(t1 - t0);
+            kernelSeconds += juce::Time::highResolutionTicksToSeconds(t2 - t1);
+
+            for(int channel = 0; channel < 2; channel++) {
+                const auto* samples = buffer.getReadPointer(channel);
+                for(int i=0; i<blockSize; i++)
+                    maxError = juce::jmax(maxError, std::abs(samples[i] - expected[static_cast<size_t>(channel * blockSize + i)]));
+            }
+        }
+        const float tolerance = Colin::Distortion::getTolerance(static_cast<Colin::Distortion_Type>(type));
+        const bool typePassed = maxError <= tolerance;
+        passed = passed && typePassed;
+        std::printf("%-12s max error %.3g of %.3g, kernel %.3f ms, per sample %.3f ms, %.2fx %s\n",
+                    distortionName(static_cast<Colin::Distortion_Type>(type)), static_cast<double>(maxError), static_cast<double>(tolerance),
+                    kernelSeconds * 1000.0,
+                    sampleSeconds * 1000.0, kernelSeconds > 0.0 ? sampleSeconds / kernelSeconds : 0.0, typePassed ? "" : "FAIL");
+    }
+    std::printf("%d blocks of %d\n", blocks, blockSize);
+    return Colin::ToolArguments::finish(passed);
+}
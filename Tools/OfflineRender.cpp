@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    OfflineRender.cpp
+    Author:  Colin Raab
+
+    capstone_render: renders a preset and a MIDI file to a WAV without a host
+    or an editor, as fast as the machine allows.
+
+      capstone_render <preset.xml> <performance.mid> <out.wav>
+                      [--rate=48000] [--block=512] [--threads=1]
+                      [--tail=2] [--bits=24] [--sample=<file>]
+                      [--voices=16] [--interpolation=sinc] [--seed=1]
+                      [--shared-noise]
+
+    Presets are the XML files the preset panel saves. --sample loads a file
+    into the sampler source. --interpolation is draft, linear, hermite or
+    sinc; a bounce defaults to the best. --seed fixes the noise, so the same
+    command writes the same file every time; 0 leaves it free running.
+    --shared-noise has the noise source's voices share a few noise streams.
+    Prints the render time and realtime factor.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <cstdio>
+#include "../Source/PluginProcessor.h"
+#include "../Source/OfflineRenderer.h"
+#include "ToolArguments.h"
+
+int main(int argc, char* argv[]) {
+    const Colin::ToolArguments args("capstone_render", argc, argv);
+    juce::Array<juce::File> files; /// preset, MIDI, output, wherever they sit among the options
+    for(const auto& arg : args.arguments) if(!arg.isOption()) files.add(arg.resolveAsFile());
+    
+    if(args.containsOption("--help|-h") || files.size() != 3) {
+        std::printf("usage: capstone_render <preset.xml> <performance.mid> <out.wav>\n"
+                    "                       [--rate=48000] [--block=512] [--threads=1]\n"
+                    "                       [--tail=2] [--bits=24] [--sample=<file>]\n"
+                    "                       [--voices=16] [--interpolation=sinc] [--seed=1]\n"
+                    "                       [--shared-noise]\n");
+        return args.containsOption("--help|-h") ? 0 : 1;
+    }
+
+    const double sampleRate = args.optionOr("--rate", "48000").getDoubleValue();
+    const int blockSize = args.optionOr("--block", "512").getIntValue();
+    const int threads = args.optionOr("--threads", "1").getIntValue();
+    const double tail = args.optionOr("--tail", "2").getDoubleValue();
+    const int bits = args.optionOr("--bits", "24").getIntValue();
+    const int voices = args.optionOr("--voices", juce::String(Colin::VoiceManager::DEFAULT_VOICES)).getIntValue();
+    const auto seed = static_cast<std::uint64_t>(args.optionOr("--seed", "1").getLargeIntValue());
+    if(sampleRate <= 0.0 || blockSize <= 0 || threads <= 0 || tail < 0.0) return args.fail("--rate, --block and --threads must be positive, --tail can't be negative");
+    if(voices < 1 || voices > Colin::VoiceManager::MAX_VOICES) return args.fail("--voices must be 1 - " + juce::String(Colin::VoiceManager::MAX_VOICES));
+    const auto interpolationName = args.optionOr("--interpolation", "sinc");
+    auto interpolation = Colin::Interpolation::end;
+    for(int q = static_cast<int>(Colin::Interpolation::draft); q < static_cast<int>(Colin::Interpolation::end); q++)
+        if(interpolationName == Colin::Interpolator::getName(static_cast<Colin::Interpolation>(q))) interpolation = static_cast<Colin::Interpolation>(q);
+    if(interpolation == Colin::Interpolation::end) return args.fail("--interpolation must be draft, linear, hermite or sinc");
+
+    /// The processor owns an oscilloscope component, which wants a message manager to exist
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    CapstoneAudioProcessor processor;
+    processor.setRenderThreads(threads);
+    processor.setPolyphony(voices);
+    processor.setInterpolation(interpolation);
+    processor.setNoiseSeed(seed);
+    processor.setSharedNoise(args.containsOption("--shared-noise"));
+
+    const auto sampleFile = args.getValueForOption("--sample");
+    if(sampleFile.isNotEmpty()) {
+        const auto file = juce::File::getCurrentWorkingDirectory().getChildFile(sampleFile);
+        if(!file.existsAsFile()) return args.fail("sample " + sampleFile + " does not exist");
+        processor.sampler->loadFile(file);
+    }
+
+    Colin::OfflineRenderer renderer(processor, sampleRate, blockSize);
+    auto error = renderer.loadPreset(files[0]);
+    if(error.isNotEmpty()) return args.fail(error);
+    error = renderer.loadMidi(files[1]);
+    if(error.isNotEmpty()) return args.fail(error);
+
+    const auto audio = renderer.render(tail);
+    error = Colin::OfflineRenderer::writeWav(audio, sampleRate, files[2], bits);
+    if(error.isNotEmpty()) return args.fail(error);
+
+    const double seconds = audio.getNumSamples() / sampleRate;
+    std::printf("%s: %.2f s of audio in %.3f s, %.1fx realtime (block %d, %d thread%s)\n",
+                files[2].getFileName().toRawUTF8(), seconds, renderer.getRenderSeconds(),
+                renderer.getRealtimeFactor(), blockSize, threads, threads == 1 ? "" : "s");
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+  ==============================================================================
+
+    OscillatorBankCheck.cpp
+    Author:  Colin Raab
+
+    Renders random voices (pitch, velocity, start sample, phase) through
+    the OscillatorBank and through WavetableOscillator::renderBlock one at
+    a time, and compares the two. Prints the largest difference, the phase drift and the time
+    each took, and exits with 1 if a sample is off by more than
+    OscillatorBank::TOLERANCE.
+
+      OscillatorBankCheck [--voices=64] [--blocks=2000] [--block=512]
+                          [--rate=48000] [--seed=1] [--interpolation=linear]
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <cstdio>
+#include <vector>
+#include "../Synth/OscillatorBank.h"
+#include "ToolArguments.h"
+
+namespace
+{
+
+/// A saw with a kink in it, so neighbouring samples differ and interpolation errors show
+std::vector<float> makeTable() {
+    std::vector<float> table(1024);
+    for(size_t i=0; i<table.size(); i++) {
+        const float x = static_cast<float>(i) / static_cast<float>(table.size());
+        table[i] = 2.f * x - 1.f + 0.3f * std::sin(juce::MathConstants<float>::twoPi * 3.f * x);
+    }
+    return table;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const Colin::ToolArguments args("OscillatorBankCheck", argc, argv);
+    if(args.showHelp("OscillatorBankCheck [--voices=64] [--blocks=2000] [--block=512] [--rate=48000] [--seed=1]\n"
+                     "                    [--interpolation=draft|linear|hermite|sinc]")) return 0;
+    const int voices = args.optionOr("--voices", juce::String(Colin::OscillatorBank::MAX_LANES)).getIntValue();
+    const int blocks = args.optionOr("--blocks", "2000").getIntValue();
+    const int blockSize = args.optionOr("--block", "512").getIntValue();
+    const double sampleRate = args.optionOr("--rate", "48000").getDoubleValue();
+    juce::Random random(args.optionOr("--seed", "1").getLargeIntValue());
+    if(voices < 1 || voices > Colin::OscillatorBank::MAX_LANES) return args.fail("--voices must be 1 - " + juce::String(Colin::OscillatorBank::MAX_LANES));
+    if(blocks <= 0 || blockSize <= 0 || sampleRate <= 0.0) return args.fail("--blocks, --block and --rate must be positive");
+    const auto interpolationName = args.optionOr("--interpolation", "linear");
+    auto interpolation = Colin::Interpolation::end;
+    for(int q = static_cast<int>(Colin::Interpolation::draft); q < static_cast<int>(Colin::Interpolation::end); q++)
+        if(interpolationName == Colin::Interpolator::getName(static_cast<Colin::Interpolation>(q))) interpolation = static_cast<Colin::Interpolation>(q);
+    if(interpolation == Colin::Interpolation::end) return args.fail("--interpolation must be draft, linear, hermite or sinc");
+
+    const Colin::WavetableMipmap table(makeTable());
+    const auto numVoices = static_cast<size_t>(voices);
+    Colin::OscillatorBank bank;
+    bank.setWavetable(table);
+    bank.setInterpolation(interpolation);
+
+    std::vector<Colin::WavetableOscillator> banked(numVoices), scalar(numVoices);
+    std::vector<float> gains(numVoices);
+    std::vector<int> starts(numVoices);
+    std::vector<std::vector<float>> bankOut(numVoices, std::vector<float>(static_cast<size_t>(blockSize)));
+    std::vector<std::vector<float>> scalarOut(bankOut);
+
+    for(size_t v=0; v<numVoices; v++) {
+        for(auto* osc : { &banked[v], &scalar[v] }) {
+            osc->prepare(sampleRate);
+            osc->setWavetable(table);
+            osc->setInterpolation(interpolation);
+        }
+        const int pitch = random.nextInt(juce::Range<int>(0, 128));
+        const auto phase = static_cast<std::uint32_t>(random.nextInt());
+        for(auto* osc : { &banked[v], &scalar[v] }) {
+            osc->setPitch(pitch);
+            osc->setPhase(phase);
+        }
+        gains[v] = random.nextFloat();
+    }
+
+    float maxError = 0.f;
+    std::uint32_t maxDrift = 0;
+    double bankSeconds = 0.0, scalarSeconds = 0.0;
+    for(int b=0; b<blocks; b++) {
+        /// The first block of a note starts part way in, the rest start at 0
+        for(size_t v=0; v<numVoices; v++) starts[v] = b == 0 || random.nextInt(16) == 0 ? random.nextInt(blockSize) : 0;
+
+        auto t0 = juce::Time::getHighResolutionTicks();
+        bank.clear();
+        for(size_t v=0; v<numVoices; v++) bank.addVoice(banked[v], gains[v], starts[v], bankOut[v].data());
+        bank.render(blockSize);
+        auto t1 = juce::Time::getHighResolutionTicks();
+        for(size_t v=0; v<numVoices; v++) {
+            /// What Voice::renderVoice does when the bank is off
+            float* out = scalarOut[v].data() + starts[v];
+            scalar[v].renderBlock(out, blockSize - starts[v]);
+            juce::FloatVectorOperations::multiply(out, gains[v], blockSize - starts[v]);
+        }
+        auto t2 = juce::Time::getHighResolutionTicks();
+        bankSeconds += juce::Time::highResolutionTicksToSeconds(t1 - t0);
+        scalarSeconds += juce::Time::highResolutionTicksToSeconds(t2 - t1);
+
+        for(size_t v=0; v<numVoices; v++) {
+            for(int t=starts[v]; t<blockSize; t++)
+                maxError = juce::jmax(maxError, std::abs(bankOut[v][static_cast<size_t>(t)] - scalarOut[v][static_cast<size_t>(t)]));
+            const std::uint32_t drift = banked[v].getPhase() - scalar[v].getPhase();
+            maxDrift = juce::jmax(maxDrift, juce::jmin(drift, 0u - drift));
+        }
+    }
+
+    const bool passed = maxError <= Colin::OscillatorBank::TOLERANCE;
+    std::printf("width %d, %d voices, %d blocks of %d, %s interpolation\n", Colin::OscillatorBank::WIDTH, voices, blocks, blockSize,
+                Colin::Interpolator::getName(interpolation));
+    std::printf("max error %.3g (tolerance %.3g), max phase drift %u steps\n", static_cast<double>(maxError),
+                static_cast<double>(Colin::OscillatorBank::TOLERANCE), maxDrift);
+    std::printf("bank %.3f ms, scalar %.3f ms, %.2fx\n", bankSeconds * 1000.0, scalarSeconds * 1000.0,
+                bankSeconds > 0.0 ? scalarSeconds / bankSeconds : 0.0);
+    return Colin::ToolArguments::finish(passed);
+}
@@ -0,0 +1,285 @@
+/*
+  ==============================================================================
+
+    RealtimeSafetyCheck.cpp
+    Author:  Colin Raab
+
+    Drives processBlock with scripted MIDI and parameter automation and
+    reports every heap allocation, free or mutex lock made on the thread
+    that is inside processBlock, with a stack trace. Exits with 1 if there
+    was any, so it can gate a release.
+
+      RealtimeSafetyCheck [--blocks=20000] [--block=512] [--rate=48000]
+                          [--threads=1] [--voices=16] [--seed=1] [--traces=10] [--abort]
+
+    malloc, calloc, realloc, free, the aligned allocators, operator new and
+    delete and pthread_mutex_lock are interposed by defining them in this
+    executable, so it needs glibc (Linux). Build with symbols exported
+    (CMake does) for readable traces, or feed the addresses to addr2line.
+
+    Only the thread calling processBlock is watched. With --threads above 1
+    that includes RenderPool::run, but not the workers' share of voices,
+    which is the same code --threads=1 checks on the calling thread.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <new>
+#include <pthread.h>
+#include <unistd.h>
+#include "../Source/PluginProcessor.h"
+
+extern "C" {
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+void* __libc_memalign(size_t, size_t);
+void __libc_free(void*);
+}
+
+namespace
+{
+
+thread_local bool watching = false;  /// true while this thread is inside processBlock
+thread_local bool reporting = false; /// the report itself may allocate, don't report that
+std::atomic<int> violations { 0 };
+int maxTraces = 10;
+bool abortOnViolation = false;
+
+/// Nothing in here allocates: snprintf into the stack, write() and backtrace_symbols_fd() rather than backtrace_symbols()
+void violation(const char* what, size_t size) {
+    if(!watching || reporting) return;
+    reporting = true;
+    const int n = ++violations;
+    if(n <= maxTraces) {
+        char line[160];
+        const int len = std::snprintf(line, sizeof(line), "\n[rt-safety] violation %d: %s (%zu bytes) inside processBlock\n", n, what, size);
+        if(len > 0) ::write(STDERR_FILENO, line, static_cast<size_t>(len));
+        void* frames[48];
+        const int numFrames = backtrace(frames, 48);
+        backtrace_symbols_fd(frames + 2, numFrames - 2, STDERR_FILENO); /// skip violation() and the hook
+    }
+    if(abortOnViolation) std::abort();
+    reporting = false;
+}
+
+using MutexLockFn = int (*)(pthread_mutex_t*);
+MutexLockFn realMutexLock = nullptr;
+
+/// Resolved before any audio runs, dlsym can allocate
+MutexLockFn getRealMutexLock() {
+    if(realMutexLock == nullptr) realMutexLock = reinterpret_cast<MutexLockFn>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+    return realMutexLock;
+}
+
+}
+
+//==============================================================================
+
+extern "C" {
+
+void* malloc(size_t size) {
+    violation("malloc", size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t num, size_t size) {
+    violation("calloc", num * size);
+    return __libc_calloc(num, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    violation("realloc", size);
+    return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) {
+    if(ptr != nullptr) violation("free", 0);
+    __libc_free(ptr);
+}
+
+void* memalign(size_t alignment, size_t size) {
+    violation("memalign", size);
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    violation("aligned_alloc", size);
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) {
+    violation("posix_memalign", size);
+    *ptr = __libc_memalign(alignment, size);
+    return *ptr == nullptr ? ENOMEM : 0;
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) {
+    violation("pthread_mutex_lock", 0);
+    return getRealMutexLock()(mutex);
+}
+
+}
+
+/// Replaced so the report names the C++ call, the aligned and sized forms end up in the hooks above
+void* operator new(std::size_t size) {
+    violation("operator new", size);
+    if(auto* p = __libc_malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    violation("operator new[]", size);
+    if(auto* p = __libc_malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    violation("operator new", size);
+    return __libc_malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    violation("operator new[]", size);
+    return __libc_malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* ptr) noexcept {
+    if(ptr != nullptr) violation("operator delete", 0);
+    __libc_free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    if(ptr != nullptr) violation("operator delete[]", 0);
+    __libc_free(ptr);
+}
+
+//==============================================================================
+
+namespace
+{
+
+struct Options {
+    int numBlocks = 20000;
+    int blockSize = 512;
+    double sampleRate = 48000.0;
+    int threads = 1;
+    int voices = Colin::VoiceManager::DEFAULT_VOICES;
+    juce::int64 seed = 1;
+};
+
+/// Random notes, chords past the voice limit so notes get stolen, releases, the odd all-notes-off and a
+/// sysex long enough that decoding it as a MidiMessage would allocate, each at a random offset inside the block
+void scriptMidi(juce::MidiBuffer& midi, juce::Random& random, int numSamples, int polyphony, std::array<bool, 128>& held) {
+    midi.clear();
+    const float r = random.nextFloat();
+    if(r < .15f) {
+        const int chord = 1 + random.nextInt(polyphony + 4);
+        for(int i=0; i<chord; i++) {
+            const int note = 24 + random.nextInt(84);
+            midi.addEvent(juce::MidiMessage::noteOn(1, note, static_cast<juce::uint8>(1 + random.nextInt(127))), random.nextInt(numSamples));
+            held[static_cast<size_t>(note)] = true;
+        }
+    }
+    else if(r < .35f) {
+        for(int note=0; note<128; note++) {
+            if(held[static_cast<size_t>(note)] && random.nextBool()) {
+                midi.addEvent(juce::MidiMessage::noteOff(1, note), random.nextInt(numSamples));
+                held[static_cast<size_t>(note)] = false;
+            }
+        }
+    }
+    else if(r < .36f) {
+        midi.addEvent(juce::MidiMessage::allNotesOff(1), random.nextInt(numSamples));
+        held.fill(false);
+    }
+    else if(r < .40f) {
+        std::array<juce::uint8, 64> sysex {};
+        for(auto& b : sysex) b = static_cast<juce::uint8>(random.nextInt(128));
+        midi.addEvent(juce::MidiMessage::createSysExMessage(sysex.data(), static_cast<int>(sysex.size())), random.nextInt(numSamples));
+    }
+}
+
+/// A few parameters move most blocks, every so often all of them jump, which flips every dirty group at once
+void scriptAutomation(CapstoneAudioProcessor& processor, juce::Random& random, int block) {
+    const auto& parameters = processor.getParameters();
+    if(parameters.isEmpty()) return;
+    if(block % 500 == 0) {
+        for(auto* p : parameters) p->setValue(random.nextFloat());
+        return;
+    }
+    if(random.nextFloat() < .3f) {
+        const int count = 1 + random.nextInt(4);
+        for(int i=0; i<count; i++) parameters[random.nextInt(parameters.size())]->setValue(random.nextFloat());
+    }
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    juce::ArgumentList args(argc, argv);
+    Options o;
+    if(args.containsOption("--blocks")) o.numBlocks = args.getValueForOption("--blocks").getIntValue();
+    if(args.containsOption("--block")) o.blockSize = args.getValueForOption("--block").getIntValue();
+    if(args.containsOption("--rate")) o.sampleRate = args.getValueForOption("--rate").getDoubleValue();
+    if(args.containsOption("--threads")) o.threads = args.getValueForOption("--threads").getIntValue();
+    if(args.containsOption("--voices")) o.voices = args.getValueForOption("--voices").getIntValue();
+    if(args.containsOption("--seed")) o.seed = args.getValueForOption("--seed").getLargeIntValue();
+    if(args.containsOption("--traces")) maxTraces = args.getValueForOption("--traces").getIntValue();
+    abortOnViolation = args.containsOption("--abort");
+    if(o.numBlocks <= 0 || o.blockSize <= 0 || o.sampleRate <= 0.0 || o.threads <= 0
+       || o.voices < 1 || o.voices > Colin::VoiceManager::MAX_VOICES) {
+        std::fprintf(stderr, "usage: RealtimeSafetyCheck [--blocks=20000] [--block=512] [--rate=48000] [--threads=1] [--voices=16] [--seed=1] [--traces=10] [--abort]\n");
+        return 1;
+    }
+
+    /// Anything that allocates on first use has to happen now: the lock lookup and libgcc's unwinder for backtrace()
+    getRealMutexLock();
+    void* warmup[2];
+    backtrace(warmup, 2);
+
+    /// The processor owns an oscilloscope component, which wants a message manager to exist
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    CapstoneAudioProcessor processor;
+    processor.setRenderThreads(o.threads);
+    processor.setPolyphony(o.voices);
+
+    /// A looping sample so the sampler source is exercised too
+    juce::AudioBuffer<float> sample(1, static_cast<int>(o.sampleRate));
+    for(int i=0; i<sample.getNumSamples(); i++) sample.setSample(0, i, std::sin(i * .05f) * .5f);
+    processor.sampler->loadBuffer(sample, o.sampleRate);
+
+    processor.setPlayConfigDetails(0, 2, o.sampleRate, o.blockSize);
+    processor.prepareToPlay(o.sampleRate, o.blockSize);
+
+    juce::AudioBuffer<float> buffer(2, o.blockSize);
+    juce::MidiBuffer midi;
+    midi.ensureSize(4096);
+    std::array<bool, 128> held {};
+    juce::Random random(o.seed);
+
+    for(int block=0; block<o.numBlocks; block++) {
+        /// Hosts don't always send full blocks
+        const int numSamples = random.nextFloat() < .1f ? 1 + random.nextInt(o.blockSize) : o.blockSize;
+        scriptMidi(midi, random, numSamples, processor.getPolyphony(), held);
+        scriptAutomation(processor, random, block);
+
+        juce::AudioBuffer<float> view(buffer.getArrayOfWritePointers(), 2, 0, numSamples);
+        watching = true;
+        processor.processBlock(view, midi);
+        watching = false;
+    }
+    processor.releaseResources();
+
+    const int total = violations.load();
+    std::printf("%d blocks of up to %d samples, %d thread%s, seed %lld: %d violation%s\n",
+                o.numBlocks, o.blockSize, o.threads, o.threads == 1 ? "" : "s", static_cast<long long>(o.seed),
+                total, total == 1 ? "" : "s");
+    return total == 0 ? 0 : 1;
+}
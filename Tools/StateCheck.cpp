@@ -0,0 +1,102 @@
+/*
+  ==============================================================================
+
+    StateCheck.cpp
+    Author:  Colin Raab
+
+    Checks that saved sessions still load. Builds a state blob the way
+    releases before the unison parameters wrote it (every int, then every
+    float, then every bool, by position) from random values, loads it into
+    a fresh processor and checks each older parameter got its value and the
+    newer ones their defaults. Then round trips the current format. Exits
+    with 1 on any mismatch.
+
+      StateCheck [--seed=1]
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <cstdio>
+#include <cstring>
+#include "../Source/PluginProcessor.h"
+#include "ToolArguments.h"
+
+namespace
+{
+
+/// Added after 1.0, in the appended section. Everything else is where 1.0 saved it
+const juce::StringArray appendedParameters { "osc1Unison", "osc2Unison", "osc1Detune", "osc2Detune", "osc1Spread", "osc2Spread", "noiseColour" };
+
+/// Random values anywhere in each parameter's range
+void randomise(AuxPort::ParameterMap& map, juce::Random& random) {
+    for(auto* p : map.getIntParameters()) *p = random.nextInt(p->getRange());
+    for(auto* p : map.getFloatParameters()) *p = p->getNormalisableRange().convertFrom0to1(random.nextFloat());
+    for(auto* p : map.getBoolParameters()) *p = random.nextBool();
+}
+
+/// The 1.0 layout, written out here rather than by ParameterMap so the check doesn't lean on the code it checks
+juce::MemoryBlock writeOldState(AuxPort::ParameterMap& map) {
+    juce::MemoryBlock data;
+    juce::MemoryOutputStream out(data, false);
+    for(auto* p : map.getIntParameters()) if(!appendedParameters.contains(p->getName(20))) out.writeInt(*p);
+    for(auto* p : map.getFloatParameters()) if(!appendedParameters.contains(p->getName(20))) out.writeFloat(*p);
+    for(auto* p : map.getBoolParameters()) if(!appendedParameters.contains(p->getName(20))) out.writeBool(*p);
+    out.flush();
+    return data;
+}
+
+/// Compares every parameter of loaded against expected, or against its default for the appended ones when
+/// appendedAtDefault is set. Returns the number of mismatches and prints each
+int compare(AuxPort::ParameterMap& loaded, AuxPort::ParameterMap& expected, AuxPort::ParameterMap& defaults, bool appendedAtDefault) {
+    int mismatches = 0;
+    auto check = [&](const auto& got, const auto& want, const auto& initial) {
+        for(size_t i=0; i<got.size(); i++) {
+            const auto name = got[i]->getName(20);
+            const bool useDefault = appendedAtDefault && appendedParameters.contains(name);
+            const float value = static_cast<float>(got[i]->get());
+            const float target = static_cast<float>(useDefault ? initial[i]->get() : want[i]->get());
+            if(std::abs(value - target) > 1.0e-6f * juce::jmax(1.f, std::abs(target))) {
+                std::printf("  %s is %g, should be %g\n", name.toRawUTF8(), static_cast<double>(value), static_cast<double>(target));
+                mismatches++;
+            }
+        }
+    };
+    check(loaded.getIntParameters(), expected.getIntParameters(), defaults.getIntParameters());
+    check(loaded.getFloatParameters(), expected.getFloatParameters(), defaults.getFloatParameters());
+    check(loaded.getBoolParameters(), expected.getBoolParameters(), defaults.getBoolParameters());
+    return mismatches;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const Colin::ToolArguments args("StateCheck", argc, argv);
+    if(args.showHelp("StateCheck [--seed=1]")) return 0;
+    juce::Random random(args.optionOr("--seed", "1").getLargeIntValue());
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    CapstoneAudioProcessor saved, defaults, loaded;
+
+    randomise(saved.parameterMap, random);
+    /// Start the newer parameters away from their defaults, so loading has to put them back
+    randomise(loaded.parameterMap, random);
+    const auto oldState = writeOldState(saved.parameterMap);
+    loaded.setStateInformation(oldState.getData(), static_cast<int>(oldState.getSize()));
+    const int oldMismatches = compare(loaded.parameterMap, saved.parameterMap, defaults.parameterMap, true);
+    std::printf("1.0 session, %d bytes: %d mismatches\n", static_cast<int>(oldState.getSize()), oldMismatches);
+
+    randomise(loaded.parameterMap, random);
+    juce::MemoryBlock state;
+    saved.getStateInformation(state);
+    loaded.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+    const int roundTripMismatches = compare(loaded.parameterMap, saved.parameterMap, defaults.parameterMap, false);
+    std::printf("current session, %d bytes: %d mismatches\n", static_cast<int>(state.getSize()), roundTripMismatches);
+
+    /// A 1.0 build reads the same positions, so the start of a current session has to be the 1.0 layout
+    const bool prefixMatches = state.getSize() >= oldState.getSize()
+                               && std::memcmp(state.getData(), oldState.getData(), oldState.getSize()) == 0;
+    std::printf("current session starts with the 1.0 layout: %s\n", prefixMatches ? "yes" : "no");
+
+    const bool passed = oldMismatches == 0 && roundTripMismatches == 0 && prefixMatches;
+    return Colin::ToolArguments::finish(passed);
+}
@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+
+    ToolArguments.h
+    Author:  Colin Raab
+
+    The command line handling the tools under Tools/ share: options with
+    defaults, --help, errors prefixed with the tool's name, and the closing
+    PASS / FAIL line of the checks.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <cstdio>
+
+namespace Colin
+{
+
+struct ToolArguments : public juce::ArgumentList {
+    ToolArguments(const char* tool, int argc, char* argv[]) : juce::ArgumentList(argc, argv), toolName(tool) {}
+    
+    /// The option's value, or fallback when it's missing or empty
+    juce::String optionOr(const juce::String& option, const juce::String& fallback) const {
+        auto value = getValueForOption(option);
+        return value.isEmpty() ? fallback : value;
+    }
+    
+    /// Prints usage when --help or -h was passed, main then returns 0
+    bool showHelp(const char* usage) const {
+        if(!containsOption("--help|-h")) return false;
+        std::printf("%s\n", usage);
+        return true;
+    }
+    
+    /// Prints the message after the tool's name to stderr, returns main's exit code
+    int fail(const juce::String& message) const {
+        std::fprintf(stderr, "%s: %s\n", toolName, message.toRawUTF8());
+        return 1;
+    }
+    
+    /// Prints a check's verdict, returns main's exit code
+    static int finish(bool passed) {
+        std::printf("%s\n", passed ? "PASS" : "FAIL");
+        return passed ? 0 : 1;
+    }
+    
+    const char* toolName;
+};
+
+}
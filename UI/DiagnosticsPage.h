@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    DiagnosticsPage.h
+    Author:  Colin Raab
+
+    Hidden tab showing where processBlock spends its time, toggled with
+    Cmd/Ctrl+Shift+D in builds with CAPSTONE_PROFILING
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "../Source/StageProfiler.h"
+
+#if CAPSTONE_PROFILING
+
+namespace Colin {
+
+class DiagnosticsPage : public juce::Component, private juce::Timer {
+public:
+    DiagnosticsPage(StageProfiler& p) : profiler(p) {
+        startTimerHz(5);
+    }
+
+    void paint(juce::Graphics& g) override {
+        const int rowHeight = 13;
+        const int cols[] = { 10, 150, 250, 350, 450 };
+        auto row = [&](int y, const juce::String& a, const juce::String& b, const juce::String& c, const juce::String& d) {
+            g.drawText(a, cols[0], y, cols[1] - cols[0], rowHeight, juce::Justification::centredLeft);
+            g.drawText(b, cols[1], y, cols[2] - cols[1], rowHeight, juce::Justification::centredRight);
+            g.drawText(c, cols[2], y, cols[3] - cols[2], rowHeight, juce::Justification::centredRight);
+            g.drawText(d, cols[3], y, cols[4] - cols[3], rowHeight, juce::Justification::centredRight);
+        };
+
+        g.setFont(11.f);
+        g.setColour(juce::Colours::lightblue);
+        row(4, "stage", "mean us", "p99 us", "% budget");
+        g.setColour(juce::Colours::white);
+        for(int s=0; s<StageProfiler::numStages; s++) {
+            const auto& stats = report.stages[static_cast<size_t>(s)];
+            row(4 + (s + 1) * rowHeight, StageProfiler::getStageName(s),
+                juce::String(stats.meanMicros, 1), juce::String(stats.p99Micros, 1), juce::String(stats.budgetPercent, 2));
+        }
+        g.setColour(juce::Colours::grey);
+        g.drawText(juce::String(report.numBlocks) + " blocks, budget " + juce::String(report.budgetMicros, 0) + " us, "
+                   + juce::String(droppedTotal) + " dropped. Source rows are summed over voices and render threads",
+                   cols[0], 4 + (StageProfiler::numStages + 1) * rowHeight, getWidth() - 20, rowHeight, juce::Justification::centredLeft);
+    }
+
+private:
+    /// Keeps draining while hidden so the ring doesn't fill up and drop blocks
+    void timerCallback() override {
+        report = profiler.collect();
+        droppedTotal += report.dropped;
+        if(isShowing()) repaint();
+    }
+
+    StageProfiler& profiler;
+    StageProfiler::Report report;
+    int droppedTotal = 0;
+};
+
+}
+
+#endif
@@ -11,24 +11,99 @@
   ==============================================================================
 */
 
+#include <array>
+#include <atomic>
 #include "JuceHeader.h"
 
 namespace Colin {
 
-class Oscilloscope : public juce::AudioVisualiserComponent {
-private:
-    juce::Colour newgold = juce::Colour(juce::uint8(74), juce::uint8(64), juce::uint8(15));
-    
+/// The main page's scope, drawn like juce::AudioVisualiserComponent: every SAMPLES_PER_LEVEL samples of the first
+/// channel become one min / max level. The levels live in a ring allocated once at the largest size the scope slider
+/// asks for. The audio thread writes into it and publishes the write position, the message thread draws the newest
+/// visibleLevels of it, and neither ever resizes it
+class Oscilloscope : public juce::Component, private juce::Timer {
 public:
-    Oscilloscope() : juce::AudioVisualiserComponent(1) {
-        setBufferSize(128);
-        setSamplesPerBlock(16);
-        setColours(newgold, juce::Colours::lightblue);
+    static constexpr int SAMPLES_PER_LEVEL = 16;
+    static constexpr int MAX_LEVELS = 99 * 2 + 32; /// the scope slider at its top, see CapstoneAudioProcessor::processBlock()
+    
+    Oscilloscope() {
+        clear();
+        setOpaque(true);
+        startTimerHz(60);
     }
     
-    void setBuffer(int bufSize) {
-        setBufferSize(bufSize);
+    ~Oscilloscope() override { stopTimer(); }
+    
+    /// Only changes how many levels are drawn, safe from the audio thread
+    void setBuffer(int numLevels) {
+        visibleLevels = juce::jlimit(1, MAX_LEVELS, numLevels);
     }
+    
+    void clear() {
+        for(size_t i=0; i<lows.size(); i++) {
+            lows[i].store(0.f, std::memory_order_relaxed);
+            highs[i].store(0.f, std::memory_order_relaxed);
+        }
+        subSample = 0;
+        writeIndex.store(0, std::memory_order_release);
+    }
+    
+    /// Audio thread only
+    void pushBuffer(const juce::AudioBuffer<float>& buffer) {
+        if(buffer.getNumChannels() < 1) return;
+        const float* samples = buffer.getReadPointer(0);
+        int next = writeIndex.load(std::memory_order_relaxed);
+        for(int i=0; i<buffer.getNumSamples(); i++) {
+            const float s = samples[i];
+            low = subSample == 0 ? s : juce::jmin(low, s);
+            high = subSample == 0 ? s : juce::jmax(high, s);
+            if(++subSample < SAMPLES_PER_LEVEL) continue;
+            subSample = 0;
+            lows[static_cast<size_t>(next)].store(low, std::memory_order_relaxed);
+            highs[static_cast<size_t>(next)].store(high, std::memory_order_relaxed);
+            next = (next + 1) % MAX_LEVELS;
+        }
+        writeIndex.store(next, std::memory_order_release);
+    }
+    
+    void paint(juce::Graphics& g) override {
+        g.fillAll(background);
+        const int numLevels = visibleLevels.load();
+        const int end = writeIndex.load(std::memory_order_acquire);
+        const auto level = [this, end, numLevels](int i, bool top) {
+            const auto index = static_cast<size_t>((end - numLevels + i + MAX_LEVELS) % MAX_LEVELS);
+            return top ? highs[index].load(std::memory_order_relaxed) : lows[index].load(std::memory_order_relaxed);
+        };
+        
+        /// Along the tops and back along the bottoms, in level / sample units, then stretched over the component
+        juce::Path path;
+        path.preallocateSpace(4 * numLevels + 8);
+        path.startNewSubPath(0.f, -level(0, true));
+        for(int i=1; i<numLevels; i++) path.lineTo(static_cast<float>(i), -level(i, true));
+        for(int i=numLevels-1; i>=0; i--) path.lineTo(static_cast<float>(i), -level(i, false));
+        path.closeSubPath();
+        
+        const auto area = getLocalBounds().toFloat();
+        path.applyTransform(juce::AffineTransform::fromTargetPoints(0.f, -1.f, area.getX(), area.getY(),
+                                                                   0.f, 1.f, area.getX(), area.getBottom(),
+                                                                   static_cast<float>(numLevels), -1.f, area.getRight(), area.getY()));
+        g.setColour(waveform);
+        g.fillPath(path);
+    }
+    
+private:
+    void timerCallback() override { repaint(); }
+    
+    juce::Colour background = juce::Colour(juce::uint8(74), juce::uint8(64), juce::uint8(15));
+    juce::Colour waveform = juce::Colours::lightblue;
+    std::array<std::atomic<float>, MAX_LEVELS> lows;
+    std::array<std::atomic<float>, MAX_LEVELS> highs;
+    std::atomic<int> writeIndex { 0 };
+    std::atomic<int> visibleLevels { 128 };
+    /// The level being gathered, audio thread only
+    int subSample = 0;
+    float low = 0.f;
+    float high = 0.f;
 };
 
 }
@@ -66,7 +66,7 @@ public:
 
 struct Osc1Page : public juce::Component
 {
-    Osc1Page(Colin::Synth* o, juce::AudioParameterInt* distSel, juce::AudioParameterFloat* drive, juce::AudioParameterFloat* coeff, juce::AudioParameterFloat* fm, juce::AudioParameterFloat* pitch, juce::AudioParameterInt* waveSel, juce::AudioParameterInt* filter, juce::AudioParameterFloat* cutoff, juce::AudioParameterFloat* res, juce::AudioParameterBool* key, juce::AudioParameterFloat* ktA, juce::AudioParameterFloat* atk, juce::AudioParameterFloat* dec, juce::AudioParameterFloat* sus, juce::AudioParameterFloat* rel, juce::AudioParameterFloat* depth, juce::AudioParameterBool* etV, juce::AudioParameterBool* etD, juce::AudioParameterBool* etF, juce::AudioParameterFloat* wSlider, juce::AudioParameterFloat* dSlider, AuxPort::Bezier* bezier, juce::AudioParameterFloat* xP, juce::AudioParameterFloat* yP, juce::AudioParameterFloat* slopeP)
+    Osc1Page(Colin::Synth* o, juce::AudioParameterInt* distSel, juce::AudioParameterFloat* drive, juce::AudioParameterFloat* coeff, juce::AudioParameterFloat* fm, juce::AudioParameterFloat* pitch, juce::AudioParameterInt* waveSel, juce::AudioParameterInt* filter, juce::AudioParameterFloat* cutoff, juce::AudioParameterFloat* res, juce::AudioParameterBool* key, juce::AudioParameterFloat* ktA, juce::AudioParameterFloat* atk, juce::AudioParameterFloat* dec, juce::AudioParameterFloat* sus, juce::AudioParameterFloat* rel, juce::AudioParameterFloat* depth, juce::AudioParameterBool* etV, juce::AudioParameterBool* etD, juce::AudioParameterBool* etF, juce::AudioParameterFloat* wSlider, juce::AudioParameterFloat* dSlider, AuxPort::Bezier* bezier, juce::AudioParameterFloat* xP, juce::AudioParameterFloat* yP, juce::AudioParameterFloat* slopeP, juce::AudioParameterInt* unisonSel, juce::AudioParameterFloat* detune, juce::AudioParameterFloat* spread)
     {
         osc1 = o;
         
@@ -162,6 +162,27 @@ struct Osc1Page : public juce::Component
         ktAmt->setBounds(435, 40, 30, 50);
         addAndMakeVisible(ktAmt);
         
+        unison = unisonSel;
+        unisonChoice.addItem("1 Voice", 1);
+        for(int voices = 2; voices <= 16; voices++) unisonChoice.addItem(juce::String(voices) + " Voices", voices);
+        unisonChoice.onChange = [this] {
+            *unison = unisonChoice.getSelectedId();
+        };
+        unisonChoice.setSelectedId(*unison);
+        unisonChoice.setBounds(290, 157, 75, 18);
+        unisonChoice.setColour(juce::ComboBox::ColourIds::backgroundColourId, juce::Colours::transparentBlack);
+        addAndMakeVisible(unisonChoice);
+        
+        osc1Detune = new TextSlider(detune);
+        osc1Detune->setRange(0, 99, 20, 1);
+        osc1Detune->setBounds(375, 155, 30, 50);
+        addAndMakeVisible(osc1Detune);
+        
+        osc1Spread = new TextSlider(spread);
+        osc1Spread->setRange(0, 99, 50, 1);
+        osc1Spread->setBounds(415, 155, 30, 50);
+        addAndMakeVisible(osc1Spread);
+        
         juce::Typeface::Ptr maintface = juce::Typeface::createSystemTypefaceFor(BinaryData::Avenir_Regular_ttf, BinaryData::Avenir_Regular_ttfSize);
         juce::Font mainFont = juce::Font(maintface);
         mainFont.setHeight(15);
@@ -210,6 +231,17 @@ struct Osc1Page : public juce::Component
         text = "Cutoff      Res";
         filterText.setText(text);
         
+        addAndMakeVisible(unisonText);
+        unisonText.setReadOnly(true);
+        unisonText.setInterceptsMouseClicks (false, false);
+        unisonText.setFont(mainFont);
+        unisonText.setBounds(375, 167, 150, 20);
+        unisonText.setColour(juce::TextEditor::ColourIds::textColourId, juce::Colours::gold);
+        unisonText.setColour(juce::TextEditor::ColourIds::backgroundColourId, juce::Colours::transparentBlack);
+        unisonText.setColour(juce::TextEditor::ColourIds::outlineColourId, juce::Colours::transparentBlack);
+        text = "Detune      Spread";
+        unisonText.setText(text);
+        
         osc1Attack = new TextSlider(atk);
         osc1Attack->setRange(0, 99, 10, 1);
         osc1Attack->setBounds(290, 110, 30, 50);
@@ -382,7 +414,7 @@ struct Osc1Page : public juce::Component
             g.setColour(juce::Colours::lightblue);
             int start_x = 26;
             int start_y = 82;
-            auto wavetable = osc1->getWavetable();
+            const auto& wavetable = osc1->getWavetable();
             p.startNewSubPath(start_x, start_y);
             auto ratio = osc1->WAVETABLE_LENGTH / 64;
             for (int sample = 0; sample < 64; sample++) {
@@ -420,6 +452,8 @@ struct Osc1Page : public juce::Component
         osc1Release->setValue();
         ADSRDepth->setValue();
         ktAmt->setValue();
+        osc1Detune->setValue();
+        osc1Spread->setValue();
         
         envToVol.setToggleState(*envV, juce::dontSendNotification);
         envToDist.setToggleState(*envD, juce::dontSendNotification);
@@ -428,6 +462,7 @@ struct Osc1Page : public juce::Component
         distortionChoice.setSelectedId(*dist);
         wavetableChoice.setSelectedId(*wave);
         filterChoice.setSelectedId(*filt);
+        unisonChoice.setSelectedId(*unison);
         waveSlider.setValue(*waveS);
         distSlider.setValue(*distS);
     }
@@ -445,6 +480,8 @@ struct Osc1Page : public juce::Component
         delete osc1Release;
         delete ADSRDepth;
         delete ktAmt;
+        delete osc1Detune;
+        delete osc1Spread;
         delete auxShaper;
     }
     
@@ -457,6 +494,7 @@ private:
     juce::TextEditor infoText;
     juce::TextEditor sliderText;
     juce::TextEditor filterText;
+    juce::TextEditor unisonText;
     customSlider cs;
     juce::Slider waveSlider;
     juce::Slider distSlider;
@@ -474,6 +512,8 @@ private:
     TextSlider* osc1Release;
     TextSlider* ADSRDepth;
     TextSlider* ktAmt;
+    TextSlider* osc1Detune;
+    TextSlider* osc1Spread;
     juce::ToggleButton envToVol {"Vol"};
     juce::ToggleButton envToDist {"Dist"};
     juce::ToggleButton envToFilter {"Filt"};
@@ -481,7 +521,9 @@ private:
     juce::ComboBox wavetableChoice;
     juce::ComboBox distortionChoice;
     juce::ComboBox filterChoice;
+    juce::ComboBox unisonChoice;
     juce::AudioParameterInt * filt;
+    juce::AudioParameterInt * unison;
     juce::AudioParameterInt * wave;
     juce::AudioParameterInt * dist;
     juce::AudioParameterBool * envV;
@@ -495,7 +537,7 @@ private:
 
 struct Osc2Page : public juce::Component
 {
-    Osc2Page(Colin::Synth* o, juce::AudioParameterInt* distSel, juce::AudioParameterFloat* drive, juce::AudioParameterFloat* coeff, juce::AudioParameterFloat* fm, juce::AudioParameterFloat* pitch, juce::AudioParameterInt* waveSel, juce::AudioParameterInt* filter, juce::AudioParameterFloat* cutoff, juce::AudioParameterFloat* res, juce::AudioParameterBool* key, juce::AudioParameterFloat* ktA, juce::AudioParameterFloat* atk, juce::AudioParameterFloat* dec, juce::AudioParameterFloat* sus, juce::AudioParameterFloat* rel, juce::AudioParameterFloat* depth, juce::AudioParameterBool* etV, juce::AudioParameterBool* etD, juce::AudioParameterBool* etF, juce::AudioParameterFloat* wSlider, juce::AudioParameterFloat* dSlider, AuxPort::Bezier* bezier, juce::AudioParameterFloat* xP, juce::AudioParameterFloat* yP, juce::AudioParameterFloat* slopeP)
+    Osc2Page(Colin::Synth* o, juce::AudioParameterInt* distSel, juce::AudioParameterFloat* drive, juce::AudioParameterFloat* coeff, juce::AudioParameterFloat* fm, juce::AudioParameterFloat* pitch, juce::AudioParameterInt* waveSel, juce::AudioParameterInt* filter, juce::AudioParameterFloat* cutoff, juce::AudioParameterFloat* res, juce::AudioParameterBool* key, juce::AudioParameterFloat* ktA, juce::AudioParameterFloat* atk, juce::AudioParameterFloat* dec, juce::AudioParameterFloat* sus, juce::AudioParameterFloat* rel, juce::AudioParameterFloat* depth, juce::AudioParameterBool* etV, juce::AudioParameterBool* etD, juce::AudioParameterBool* etF, juce::AudioParameterFloat* wSlider, juce::AudioParameterFloat* dSlider, AuxPort::Bezier* bezier, juce::AudioParameterFloat* xP, juce::AudioParameterFloat* yP, juce::AudioParameterFloat* slopeP, juce::AudioParameterInt* unisonSel, juce::AudioParameterFloat* detune, juce::AudioParameterFloat* spread)
     {
         osc2 = o;
         
@@ -591,6 +633,27 @@ struct Osc2Page : public juce::Component
         ktAmt->setBounds(435, 40, 30, 50);
         addAndMakeVisible(ktAmt);
         
+        unison = unisonSel;
+        unisonChoice.addItem("1 Voice", 1);
+        for(int voices = 2; voices <= 16; voices++) unisonChoice.addItem(juce::String(voices) + " Voices", voices);
+        unisonChoice.onChange = [this] {
+            *unison = unisonChoice.getSelectedId();
+        };
+        unisonChoice.setSelectedId(*unison);
+        unisonChoice.setBounds(290, 157, 75, 18);
+        unisonChoice.setColour(juce::ComboBox::ColourIds::backgroundColourId, juce::Colours::transparentBlack);
+        addAndMakeVisible(unisonChoice);
+        
+        osc2Detune = new TextSlider(detune);
+        osc2Detune->setRange(0, 99, 20, 1);
+        osc2Detune->setBounds(375, 155, 30, 50);
+        addAndMakeVisible(osc2Detune);
+        
+        osc2Spread = new TextSlider(spread);
+        osc2Spread->setRange(0, 99, 50, 1);
+        osc2Spread->setBounds(415, 155, 30, 50);
+        addAndMakeVisible(osc2Spread);
+        
         juce::Typeface::Ptr maintface = juce::Typeface::createSystemTypefaceFor(BinaryData::Avenir_Regular_ttf, BinaryData::Avenir_Regular_ttfSize);
         juce::Font mainFont = juce::Font(maintface);
         mainFont.setHeight(15);
@@ -639,6 +702,17 @@ struct Osc2Page : public juce::Component
         text = "Cutoff      Res";
         filterText.setText(text);
         
+        addAndMakeVisible(unisonText);
+        unisonText.setReadOnly(true);
+        unisonText.setInterceptsMouseClicks (false, false);
+        unisonText.setFont(mainFont);
+        unisonText.setBounds(375, 167, 150, 20);
+        unisonText.setColour(juce::TextEditor::ColourIds::textColourId, juce::Colours::gold);
+        unisonText.setColour(juce::TextEditor::ColourIds::backgroundColourId, juce::Colours::transparentBlack);
+        unisonText.setColour(juce::TextEditor::ColourIds::outlineColourId, juce::Colours::transparentBlack);
+        text = "Detune      Spread";
+        unisonText.setText(text);
+        
         osc2Attack = new TextSlider(atk);
         osc2Attack->setRange(0, 99, 10, 1);
         osc2Attack->setBounds(290, 110, 30, 50);
@@ -811,7 +885,7 @@ struct Osc2Page : public juce::Component
             g.setColour(juce::Colours::lightblue);
             int start_x = 26;
             int start_y = 82;
-            auto wavetable = osc2->getWavetable();
+            const auto& wavetable = osc2->getWavetable();
             p.startNewSubPath(start_x, start_y);
             auto ratio = osc2->WAVETABLE_LENGTH / 64;
             for (int sample = 0; sample < 64; sample++) {
@@ -849,6 +923,8 @@ struct Osc2Page : public juce::Component
         osc2Release->setValue();
         ADSRDepth->setValue();
         ktAmt->setValue();
+        osc2Detune->setValue();
+        osc2Spread->setValue();
         
         envToVol.setToggleState(*envV, juce::dontSendNotification);
         envToDist.setToggleState(*envD, juce::dontSendNotification);
@@ -857,6 +933,7 @@ struct Osc2Page : public juce::Component
         distortionChoice.setSelectedId(*dist);
         wavetableChoice.setSelectedId(*wave);
         filterChoice.setSelectedId(*filt);
+        unisonChoice.setSelectedId(*unison);
         waveSlider.setValue(*waveS);
         distSlider.setValue(*distS);
     }
@@ -874,6 +951,8 @@ struct Osc2Page : public juce::Component
         delete osc2Release;
         delete ADSRDepth;
         delete ktAmt;
+        delete osc2Detune;
+        delete osc2Spread;
         delete auxShaper;
     }
     
@@ -886,6 +965,7 @@ private:
     juce::TextEditor infoText;
     juce::TextEditor sliderText;
     juce::TextEditor filterText;
+    juce::TextEditor unisonText;
     customSlider cs;
     juce::Slider waveSlider;
     juce::Slider distSlider;
@@ -903,6 +983,8 @@ private:
     TextSlider* osc2Release;
     TextSlider* ADSRDepth;
     TextSlider* ktAmt;
+    TextSlider* osc2Detune;
+    TextSlider* osc2Spread;
     juce::ToggleButton envToVol {"Vol"};
     juce::ToggleButton envToDist {"Dist"};
     juce::ToggleButton envToFilter {"Filt"};
@@ -910,7 +992,9 @@ private:
     juce::ComboBox wavetableChoice;
     juce::ComboBox distortionChoice;
     juce::ComboBox filterChoice;
+    juce::ComboBox unisonChoice;
     juce::AudioParameterInt * filt;
+    juce::AudioParameterInt * unison;
     juce::AudioParameterInt * wave;
     juce::AudioParameterInt * dist;
     juce::AudioParameterBool * envV;
@@ -924,7 +1008,7 @@ private:
 
 struct NoisePage : public juce::Component
 {
-    NoisePage(Colin::Synth* n, juce::AudioParameterInt* distSel, juce::AudioParameterFloat* drive, juce::AudioParameterFloat* coeff, juce::AudioParameterInt* waveSel, juce::AudioParameterInt* filter, juce::AudioParameterFloat* cutoff, juce::AudioParameterFloat* res, juce::AudioParameterBool* key, juce::AudioParameterFloat* ktA, juce::AudioParameterFloat* atk, juce::AudioParameterFloat* dec, juce::AudioParameterFloat* sus, juce::AudioParameterFloat* rel, juce::AudioParameterFloat* depth, juce::AudioParameterBool* etV, juce::AudioParameterBool* etD, juce::AudioParameterBool* etF, juce::AudioParameterFloat* wSlider, juce::AudioParameterFloat* dSlider, AuxPort::Bezier* bezier, juce::AudioParameterFloat* xP, juce::AudioParameterFloat* yP, juce::AudioParameterFloat* slopeP)
+    NoisePage(Colin::Synth* n, juce::AudioParameterInt* distSel, juce::AudioParameterFloat* drive, juce::AudioParameterFloat* coeff, juce::AudioParameterInt* waveSel, juce::AudioParameterInt* filter, juce::AudioParameterFloat* cutoff, juce::AudioParameterFloat* res, juce::AudioParameterBool* key, juce::AudioParameterFloat* ktA, juce::AudioParameterFloat* atk, juce::AudioParameterFloat* dec, juce::AudioParameterFloat* sus, juce::AudioParameterFloat* rel, juce::AudioParameterFloat* depth, juce::AudioParameterBool* etV, juce::AudioParameterBool* etD, juce::AudioParameterBool* etF, juce::AudioParameterFloat* wSlider, juce::AudioParameterFloat* dSlider, AuxPort::Bezier* bezier, juce::AudioParameterFloat* xP, juce::AudioParameterFloat* yP, juce::AudioParameterFloat* slopeP, juce::AudioParameterInt* colourSel)
     {
         noise = n;
         
@@ -1152,15 +1236,25 @@ struct NoisePage : public juce::Component
         addAndMakeVisible(distortionChoice);
         
         wave = waveSel;
+        colour = colourSel;
         wavetableChoice.addItem("Gauss", 1);
         wavetableChoice.addItem("Binary", 2);
         wavetableChoice.addItem("LP", 3);
         wavetableChoice.addItem("HP", 4);
+        wavetableChoice.addItem("Pink", 5);
+        wavetableChoice.addItem("Brown", 6);
+        wavetableChoice.addItem("Velvet", 7);
+        /// Gauss to HP are noiseWave, pink to velvet are noiseColour, which overrides noiseWave while it's set
         wavetableChoice.onChange = [&]() {
-            *wave = wavetableChoice.getSelectedId();
+            const int id = wavetableChoice.getSelectedId();
+            if(id > 4) *colour = id - 4;
+            else {
+                *colour = 0;
+                *wave = id;
+            }
             repaint();
         };
-        wavetableChoice.setSelectedId(*wave);
+        wavetableChoice.setSelectedId(getNoiseId());
         wavetableChoice.setColour(juce::ComboBox::ColourIds::backgroundColourId, juce::Colours::transparentBlack);
         wavetableChoice.setBounds(25, 135, 100, 20);
         addAndMakeVisible(wavetableChoice);
@@ -1276,7 +1370,7 @@ struct NoisePage : public juce::Component
         envToVol.setToggleState(*envV, juce::dontSendNotification);
         envToFilter.setToggleState(*envF, juce::dontSendNotification);
         envToDist.setToggleState(*envD, juce::dontSendNotification);
-        wavetableChoice.setSelectedId(*wave);
+        wavetableChoice.setSelectedId(getNoiseId());
         filterChoice.setSelectedId(*filt);
         waveSlider.setValue(*waveS);
         distSlider.setValue(*distS);
@@ -1297,6 +1391,8 @@ struct NoisePage : public juce::Component
     }
     
 private:
+    int getNoiseId() const { return *colour > 0 ? 4 + *colour : *wave; }
+    
     Colin::Synth* noise;
     juce::TextEditor name;
     juce::TextEditor name2;
@@ -1330,6 +1426,7 @@ private:
     juce::AudioParameterInt * dist;
     juce::AudioParameterInt * filt;
     juce::AudioParameterInt * wave;
+    juce::AudioParameterInt * colour;
     juce::AudioParameterBool * envV;
     juce::AudioParameterBool * envD;
     juce::AudioParameterBool * envF;